@@ -28,6 +28,7 @@ public:
 	virtual litehtml::uint_ptr			create_font(const litehtml::tchar_t* faceName, int size, int weight, litehtml::font_style italic, unsigned int decoration, litehtml::font_metrics* fm);
 	virtual void						delete_font(litehtml::uint_ptr hFont);
 	virtual int						text_width(const litehtml::tchar_t* text, litehtml::uint_ptr hFont);
+	virtual void						text_width_batch(const litehtml::tchar_t** texts, int count, litehtml::uint_ptr hFont, int* widths);
 	virtual void						draw_text(litehtml::uint_ptr hdc, const litehtml::tchar_t* text, litehtml::uint_ptr hFont, litehtml::web_color color, const litehtml::position& pos);
 	virtual void						fill_rect(litehtml::uint_ptr hdc, const litehtml::position& pos, const litehtml::web_color color, const litehtml::css_border_radius& radius);
 	virtual int						pt_to_px(int pt);
@@ -0,0 +1,61 @@
+#include "html.h"
+#include "ancestor_filter.h"
+
+litehtml::ancestor_filter::ancestor_filter()
+{
+	memset(m_bits, 0, sizeof(m_bits));
+}
+
+void litehtml::ancestor_filter::add_element( const tchar_t* tag, const tchar_t* id, const tchar_t* classes )
+{
+	if(tag && tag[0])
+	{
+		add(hash(name_tag, tag));
+	}
+	if(id)
+	{
+		add(hash(name_id, id));
+	}
+	if(classes && classes[0])
+	{
+		// split the same way html_tag::select() does
+		string_vector tokens;
+		split_string(classes, tokens, _t(" "));
+		for(string_vector::iterator tok = tokens.begin(); tok != tokens.end(); tok++)
+		{
+			add(hash(name_class, tok->c_str()));
+		}
+	}
+}
+
+bool litehtml::ancestor_filter::may_contain_all( const std::vector<unsigned int>& hashes ) const
+{
+	for(std::vector<unsigned int>::const_iterator h = hashes.begin(); h != hashes.end(); h++)
+	{
+		if(!may_contain(*h))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+unsigned int litehtml::ancestor_filter::hash( name_kind kind, const tchar_t* name )
+{
+	// FNV-1a over ASCII-lowercased characters. Non-ASCII characters may be
+	// folded by the case-insensitive compare, so they all hash the same.
+	unsigned int h = 2166136261U ^ (unsigned int) kind;
+	for(const tchar_t* c = name; *c; c++)
+	{
+		unsigned int ch = (unsigned int) *c;
+		if(ch >= _t('A') && ch <= _t('Z'))
+		{
+			ch += _t('a') - _t('A');
+		} else if(ch >= 0x80)
+		{
+			ch = 0x80;
+		}
+		h = (h ^ ch) * 16777619U;
+	}
+	return h;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+namespace litehtml
+{
+	// Bloom filter of the tag, id and class names of an element's ancestors.
+	// A selector that needs an ancestor name missing from the filter cannot
+	// match, so the parent chain is not walked for it. Names are hashed
+	// case-insensitively, the filter may only give false positives.
+	const int ancestor_filter_bits = 1024;
+
+	class ancestor_filter
+	{
+		unsigned int	m_bits[ancestor_filter_bits / 32];
+	public:
+		enum name_kind
+		{
+			name_tag,
+			name_id,
+			name_class
+		};
+
+		ancestor_filter();
+
+		void	add(unsigned int hash);
+		void	add_element(const tchar_t* tag, const tchar_t* id, const tchar_t* classes);
+		bool	may_contain(unsigned int hash) const;
+		bool	may_contain_all(const std::vector<unsigned int>& hashes) const;
+
+		static unsigned int	hash(name_kind kind, const tchar_t* name);
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inline functions
+	//////////////////////////////////////////////////////////////////////////
+
+	inline void ancestor_filter::add(unsigned int hash)
+	{
+		unsigned int bit1 = hash % ancestor_filter_bits;
+		unsigned int bit2 = (hash >> 16) % ancestor_filter_bits;
+		m_bits[bit1 / 32] |= 1U << (bit1 % 32);
+		m_bits[bit2 / 32] |= 1U << (bit2 % 32);
+	}
+
+	inline bool ancestor_filter::may_contain(unsigned int hash) const
+	{
+		unsigned int bit1 = hash % ancestor_filter_bits;
+		unsigned int bit2 = (hash >> 16) % ancestor_filter_bits;
+		return (m_bits[bit1 / 32] & (1U << (bit1 % 32))) && (m_bits[bit2 / 32] & (1U << (bit2 % 32)));
+	}
+}
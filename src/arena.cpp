@@ -0,0 +1,124 @@
+#include "html.h"
+#include "arena.h"
+
+namespace
+{
+	// placed in front of the objects allocated in an arena only,
+	// heap objects have no header
+	union object_header
+	{
+		struct
+		{
+			litehtml::arena*	owner;
+			size_t				size;
+		}					alloc;
+		double				align;
+	};
+}
+
+litehtml::arena::arena()
+{
+	m_pos	= 0;
+	m_end	= 0;
+	for(size_t i = 0; i < sizeof(m_free) / sizeof(m_free[0]); i++)
+	{
+		m_free[i] = 0;
+	}
+}
+
+litehtml::arena::~arena()
+{
+	for(std::vector<char*>::iterator i = m_blocks.begin(); i != m_blocks.end(); i++)
+	{
+		::operator delete(*i);
+	}
+}
+
+void* litehtml::arena::alloc( size_t sz )
+{
+	sz = (sz + arena_granularity - 1) & ~(arena_granularity - 1);
+	if(sz > arena_max_small)
+	{
+		return ::operator new(sz);
+	}
+
+	free_item*& head = m_free[sz / arena_granularity];
+	if(head)
+	{
+		void* p = head;
+		head = head->next;
+		return p;
+	}
+
+	if(m_pos + sz > m_end)
+	{
+		m_pos = (char*) ::operator new(arena_block_size);
+		m_end = m_pos + arena_block_size;
+		m_blocks.push_back(m_pos);
+	}
+	void* p = m_pos;
+	m_pos += sz;
+	return p;
+}
+
+void litehtml::arena::free( void* p, size_t sz )
+{
+	sz = (sz + arena_granularity - 1) & ~(arena_granularity - 1);
+	if(sz > arena_max_small)
+	{
+		::operator delete(p);
+		return;
+	}
+
+	free_item* item = (free_item*) p;
+	item->next = m_free[sz / arena_granularity];
+	m_free[sz / arena_granularity] = item;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void* litehtml::object::operator new( size_t sz )
+{
+	return ::operator new(sz);
+}
+
+void* litehtml::object::operator new( size_t sz, arena* owner )
+{
+	if(!owner)
+	{
+		return ::operator new(sz);
+	}
+	object_header* hdr = (object_header*) owner->alloc(sz + sizeof(object_header));
+	hdr->alloc.owner	= owner;
+	hdr->alloc.size		= sz + sizeof(object_header);
+	return hdr + 1;
+}
+
+void litehtml::object::operator delete( void* p )
+{
+	::operator delete(p);
+}
+
+void litehtml::object::operator delete( void* p, arena* owner )
+{
+	// the constructor has thrown
+	if(owner)
+	{
+		object_header* hdr = (object_header*) p - 1;
+		owner->free(hdr, hdr->alloc.size);
+	} else
+	{
+		::operator delete(p);
+	}
+}
+
+// the header is in front of the most derived object, which placed() found
+// m_arena_offset bytes before obj
+void litehtml::object::delete_in_arena( object* obj )
+{
+	object_header* hdr = (object_header*) ((char*) obj - obj->m_arena_offset) - 1;
+	arena* owner	= hdr->alloc.owner;
+	size_t size		= hdr->alloc.size;
+	obj->~object();
+	owner->free(hdr, size);
+}
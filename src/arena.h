@@ -0,0 +1,35 @@
+#pragma once
+#include "object.h"
+
+namespace litehtml
+{
+	const size_t arena_block_size	= 64 * 1024;
+	const size_t arena_granularity	= 16;
+	const size_t arena_max_small	= 2048;	// bigger objects go to the heap
+
+	// Bump allocator owning the elements and boxes of one document.
+	// Freed memory goes to per-size free lists and is reused by the next
+	// render; the blocks are released all at once with the document, so
+	// an element::ptr kept by the container is valid while the document is.
+	class arena : public object
+	{
+	public:
+		typedef object_ptr<arena>	ptr;
+	private:
+		struct free_item
+		{
+			free_item*	next;
+		};
+
+		std::vector<char*>	m_blocks;
+		char*				m_pos;
+		char*				m_end;
+		free_item*			m_free[arena_max_small / arena_granularity + 1];
+	public:
+		arena();
+		virtual ~arena();
+
+		void*	alloc(size_t sz);
+		void	free(void* p, size_t sz);
+	};
+}
@@ -0,0 +1,122 @@
+#include "html.h"
+#include "atoms.h"
+
+#if defined( WIN32 ) || defined( WINCE )
+#include <windows.h>
+#endif
+
+// In the order of litehtml::known_atom
+static const litehtml::tchar_t* g_known_atoms[] =
+{
+	_t(""),
+
+	_t("a"),
+	_t("base"),
+	_t("body"),
+	_t("br"),
+	_t("div"),
+	_t("font"),
+	_t("head"),
+	_t("html"),
+	_t("img"),
+	_t("link"),
+	_t("p"),
+	_t("script"),
+	_t("style"),
+	_t("table"),
+	_t("td"),
+	_t("th"),
+	_t("title"),
+	_t("tr"),
+
+	_t("align"),
+	_t("background"),
+	_t("border"),
+	_t("cellspacing"),
+	_t("class"),
+	_t("clear"),
+	_t("color"),
+	_t("colspan"),
+	_t("face"),
+	_t("height"),
+	_t("href"),
+	_t("id"),
+	_t("media"),
+	_t("rel"),
+	_t("rowspan"),
+	_t("size"),
+	_t("src"),
+	_t("valign"),
+	_t("width"),
+};
+
+// pools are created by documents on any thread
+static int next_generation()
+{
+	static volatile long generation = 0;
+#if defined( WIN32 ) || defined( WINCE )
+	return (int) InterlockedIncrement(&generation);
+#else
+	return (int) __sync_add_and_fetch(&generation, 1);
+#endif
+}
+
+litehtml::atom_pool::atom_pool()
+{
+	m_generation		= next_generation();
+	m_base_generation	= 0;
+	for(int i = 0; i < atom_known_count; i++)
+	{
+		get(g_known_atoms[i]);
+	}
+}
+
+litehtml::atom_pool::atom_pool( const atom_pool& val ) : m_atoms(val.m_atoms)
+{
+	m_generation		= next_generation();
+	m_base_generation	= val.m_generation;
+	copy_names();
+}
+
+litehtml::atom_pool& litehtml::atom_pool::operator=( const atom_pool& val )
+{
+	if(this != &val)
+	{
+		m_atoms				= val.m_atoms;
+		m_generation		= next_generation();
+		m_base_generation	= val.m_generation;
+		copy_names();
+	}
+	return *this;
+}
+
+// names point into the keys of our own map
+void litehtml::atom_pool::copy_names()
+{
+	m_names.assign(m_atoms.size(), (const tchar_t*) 0);
+	for(std::map<tstring, atom>::const_iterator i = m_atoms.begin(); i != m_atoms.end(); i++)
+	{
+		m_names[i->second] = i->first.c_str();
+	}
+}
+
+litehtml::atom litehtml::atom_pool::get( const tchar_t* name )
+{
+	std::pair<std::map<tstring, atom>::iterator, bool> res = m_atoms.insert(std::make_pair(tstring(name), (atom) m_names.size()));
+	if(res.second)
+	{
+		// map keys never move, so the name can be referenced directly
+		m_names.push_back(res.first->first.c_str());
+	}
+	return res.first->second;
+}
+
+litehtml::atom litehtml::atom_pool::find( const tchar_t* name ) const
+{
+	std::map<tstring, atom>::const_iterator i = m_atoms.find(name);
+	if(i != m_atoms.end())
+	{
+		return i->second;
+	}
+	return atom_empty;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+namespace litehtml
+{
+	// Interned tag, attribute, id or class name. Equal names get equal
+	// atoms within one atom_pool (i.e. one litehtml::document).
+	typedef int atom;
+
+	// Names known to litehtml have fixed atoms in every table.
+	// Keep in sync with the names list in atoms.cpp
+	enum known_atom
+	{
+		atom_empty,
+
+		// tags
+		atom_a,
+		atom_base,
+		atom_body,
+		atom_br,
+		atom_div,
+		atom_font,
+		atom_head,
+		atom_html,
+		atom_img,
+		atom_link,
+		atom_p,
+		atom_script,
+		atom_style,
+		atom_table,
+		atom_td,
+		atom_th,
+		atom_title,
+		atom_tr,
+
+		// attributes
+		atom_align,
+		atom_background,
+		atom_border,
+		atom_cellspacing,
+		atom_class,
+		atom_clear,
+		atom_color,
+		atom_colspan,
+		atom_face,
+		atom_height,
+		atom_href,
+		atom_id,
+		atom_media,
+		atom_rel,
+		atom_rowspan,
+		atom_size,
+		atom_src,
+		atom_valign,
+		atom_width,
+
+		atom_known_count
+	};
+
+	// Every pool gets a generation number that is never reused, so atoms
+	// cached for one pool are not taken for atoms of a later pool at the
+	// same address. A copy starts with the atoms of its source and knows
+	// the source generation: the context pool with the names of the master
+	// stylesheet is copied into every document.
+	class atom_pool
+	{
+		std::map<tstring, atom>			m_atoms;
+		std::vector<const tchar_t*>		m_names;
+		int								m_generation;
+		int								m_base_generation;	// generation of the copied pool, 0 if none
+	public:
+		atom_pool();
+		atom_pool(const atom_pool& val);
+		atom_pool& operator=(const atom_pool& val);
+
+		// returns the atom for name, adding it to the table if needed
+		atom			get(const tchar_t* name);
+		// returns atom_empty if name was never added
+		atom			find(const tchar_t* name) const;
+		const tchar_t*	name(atom id) const;
+		int				generation() const;
+		// true if atoms cached for a pool of this generation are valid here
+		bool			has_generation(int generation) const;
+	private:
+		void			copy_names();
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inline functions
+	//////////////////////////////////////////////////////////////////////////
+
+	inline const tchar_t* atom_pool::name(atom id) const
+	{
+		return m_names[id];
+	}
+
+	inline int atom_pool::generation() const
+	{
+		return m_generation;
+	}
+
+	inline bool atom_pool::has_generation(int generation) const
+	{
+		return generation == m_generation || (generation && generation == m_base_generation);
+	}
+}
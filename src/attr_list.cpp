@@ -0,0 +1,142 @@
+#include "html.h"
+#include "attr_list.h"
+
+litehtml::attr_list::attr_list()
+{
+	m_count				= 0;
+	m_values			= 0;
+	m_values_size		= 0;
+	m_values_capacity	= 0;
+	m_owner				= 0;
+}
+
+litehtml::attr_list::~attr_list()
+{
+	reserve(0);
+}
+
+const litehtml::tchar_t* litehtml::attr_list::get( atom name ) const
+{
+	const item* it = items();
+	for(int i = 0; i < m_count && it[i].name <= name; i++)
+	{
+		if(it[i].name == name)
+		{
+			return m_values + it[i].value;
+		}
+	}
+	return 0;
+}
+
+bool litehtml::attr_list::equal( const attr_list& val, atom skip ) const
+{
+	const item* it1 = items();
+	const item* it2 = val.items();
+	int i1 = 0;
+	int i2 = 0;
+	while(true)
+	{
+		if(i1 < m_count && it1[i1].name == skip) i1++;
+		if(i2 < val.m_count && it2[i2].name == skip) i2++;
+		if(i1 == m_count || i2 == val.m_count)
+		{
+			break;
+		}
+		if(it1[i1].name != it2[i2].name || t_strcmp(m_values + it1[i1].value, val.m_values + it2[i2].value))
+		{
+			return false;
+		}
+		i1++;
+		i2++;
+	}
+	return i1 == m_count && i2 == val.m_count;
+}
+
+void litehtml::attr_list::set( atom name, const tchar_t* val )
+{
+	set(name, val, t_strlen(val));
+}
+
+void litehtml::attr_list::set( atom name, const tchar_t* val, size_t len )
+{
+	item* it = items();
+	int pos = 0;
+	while(pos < m_count && it[pos].name < name)
+	{
+		pos++;
+	}
+
+	unsigned int offset = m_values_size;
+	if(m_values_size + len + 1 > m_values_capacity)
+	{
+		unsigned int capacity = m_values_capacity ? m_values_capacity * 2 : attr_values_min;
+		while(capacity < m_values_size + len + 1)
+		{
+			capacity *= 2;
+		}
+		reserve(capacity);
+	}
+	memcpy(m_values + m_values_size, val, len * sizeof(tchar_t));
+	m_values[m_values_size + len] = 0;
+	m_values_size += (unsigned int) len + 1;
+
+	// a replaced value stays in the buffer, attributes are rarely set twice
+	if(pos < m_count && it[pos].name == name)
+	{
+		it[pos].value = offset;
+		return;
+	}
+
+	if(m_more.empty() && m_count == attr_list_inline)
+	{
+		m_more.assign(m_inline, m_inline + m_count);
+	}
+	if(m_more.empty())
+	{
+		for(int i = m_count; i > pos; i--)
+		{
+			m_inline[i] = m_inline[i - 1];
+		}
+		m_inline[pos].name	= name;
+		m_inline[pos].value	= offset;
+	} else
+	{
+		item new_item;
+		new_item.name	= name;
+		new_item.value	= offset;
+		m_more.insert(m_more.begin() + pos, new_item);
+	}
+	m_count++;
+}
+
+// moves the values into a buffer of size characters, 0 frees it
+void litehtml::attr_list::reserve( unsigned int size )
+{
+	tchar_t* values = 0;
+	if(size)
+	{
+		if(m_owner)
+		{
+			values = (tchar_t*) m_owner->alloc(size * sizeof(tchar_t));
+		} else
+		{
+			values = new tchar_t[size];
+		}
+		if(m_values_size)
+		{
+			memcpy(values, m_values, m_values_size * sizeof(tchar_t));
+		}
+	}
+	if(m_values)
+	{
+		if(m_owner)
+		{
+			m_owner->free(m_values, m_values_capacity * sizeof(tchar_t));
+		} else
+		{
+			delete[] m_values;
+		}
+	}
+	m_values			= values;
+	m_values_capacity	= size;
+}
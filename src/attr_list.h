@@ -0,0 +1,74 @@
+#pragma once
+
+namespace litehtml
+{
+	class arena;
+
+	// Attributes of html_tag: (atom, value) pairs sorted by atom.
+	// Up to attr_list_inline items live in the object itself, all values
+	// share one zero-separated buffer, taken from the document arena if it
+	// has one. A pointer returned by get() stays valid until the next set().
+	const int attr_list_inline = 4;
+	const int attr_values_min = 32;		// first size of the values buffer
+
+	class attr_list
+	{
+		struct item
+		{
+			atom			name;
+			unsigned int	value;	// offset in m_values
+		};
+
+		item				m_inline[attr_list_inline];
+		std::vector<item>	m_more;		// all items once m_inline is full
+		int					m_count;
+		tchar_t*			m_values;
+		unsigned int		m_values_size;
+		unsigned int		m_values_capacity;
+		arena*				m_owner;	// of m_values, 0 for the heap
+	public:
+		attr_list();
+		~attr_list();
+
+		// the values buffer comes from owner, called before the first set()
+		void			set_arena(arena* owner);
+
+		const tchar_t*	get(atom name) const;
+		void			set(atom name, const tchar_t* val);
+		void			set(atom name, const tchar_t* val, size_t len);
+		int				count() const;
+		// compares names and values, ignoring the skip attribute
+		bool			equal(const attr_list& val, atom skip) const;
+	private:
+		attr_list(const attr_list& val);
+		attr_list& operator=(const attr_list& val);
+
+		const item*		items() const;
+		item*			items();
+		void			reserve(unsigned int size);
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inline functions
+	//////////////////////////////////////////////////////////////////////////
+
+	inline int attr_list::count() const
+	{
+		return m_count;
+	}
+
+	inline void attr_list::set_arena(arena* owner)
+	{
+		m_owner = owner;
+	}
+
+	inline const attr_list::item* attr_list::items() const
+	{
+		return m_more.empty() ? m_inline : &m_more[0];
+	}
+
+	inline attr_list::item* attr_list::items()
+	{
+		return m_more.empty() ? m_inline : &m_more[0];
+	}
+}
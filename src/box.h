@@ -53,12 +53,20 @@ namespace litehtml
 	class block_box : public box
 	{
 		element*	m_element;
+		int			m_ret_width;		// returned by html_tag::place_element()
+		int			m_floats_query;		// the bottom y of the floats the element looked at
 	public:
 		block_box(int top, int left, int right) : box(top, left, right)
 		{
-			m_element = 0;
+			m_element		= 0;
+			m_ret_width		= 0;
+			m_floats_query	= INT_MAX;
 		}
 
+		void	set_placement(int ret_width, int floats_query)	{ m_ret_width = ret_width; m_floats_query = floats_query;	}
+		int		ret_width()										{ return m_ret_width;										}
+		int		floats_query()									{ return m_floats_query;									}
+
 		virtual litehtml::box_type	get_type();
 		virtual int					height();
 		virtual int					width();
@@ -0,0 +1,155 @@
+#include "html.h"
+#include "cascade.h"
+#include "thread_pool.h"
+#include "stylesheet.h"
+
+namespace
+{
+	struct tree_node
+	{
+		litehtml::element*	el;
+		int					parent;
+		int					size;	// nodes in the subtree
+	};
+
+	// the elements html_tag::apply_stylesheet() visits, in its order
+	void flatten(litehtml::element* el, int parent, std::vector<tree_node>& nodes)
+	{
+		int idx = (int) nodes.size();
+		tree_node node;
+		node.el		= el;
+		node.parent	= parent;
+		node.size	= 1;
+		nodes.push_back(node);
+
+		for(size_t i = 0; i < el->get_children_count(); i++)
+		{
+			litehtml::element::ptr child = el->get_child((int) i);
+			if(child->get_display() != litehtml::display_inline_text)
+			{
+				flatten(child, idx, nodes);
+			}
+		}
+		nodes[idx].size = (int) nodes.size() - idx;
+	}
+
+	class cascade_runner : public litehtml::parallel_tasks
+	{
+		std::vector<litehtml::cascade_task>&	m_tasks;
+		const litehtml::css&					m_stylesheet;
+	public:
+		cascade_runner(std::vector<litehtml::cascade_task>& tasks, const litehtml::css& stylesheet)
+			: m_tasks(tasks), m_stylesheet(stylesheet)
+		{
+		}
+
+		virtual void run_task(int idx)
+		{
+			litehtml::cascade_task& task = m_tasks[idx];
+			task.root->match_stylesheet(m_stylesheet, task.parents, task, task.subtree);
+		}
+	};
+}
+
+litehtml::cascade_matches::cascade_matches()
+{
+	m_task		= 0;
+	m_element	= 0;
+}
+
+void litehtml::cascade_matches::match( element* root, const css& stylesheet, thread_pool& pool, int threads )
+{
+	clear();
+	if(!root)
+	{
+		return;
+	}
+
+	std::vector<tree_node> nodes;
+	flatten(root, -1, nodes);
+
+	// Subtrees up to grain nodes become one task. Larger ones are split:
+	// their root is a task of its own and their children are split again.
+	int grain = (int) nodes.size() / (threads * 8);
+	if(grain < 64)
+	{
+		grain = 64;
+	}
+
+	// filter for the children of each split node
+	std::vector<ancestor_filter>	filters;
+	std::vector<int>				filter_of(nodes.size(), -1);
+
+	int i = 0;
+	while(i < (int) nodes.size())
+	{
+		cascade_task task;
+		task.root		= nodes[i].el;
+		task.subtree	= nodes[i].size <= grain;
+		if(nodes[i].parent >= 0)
+		{
+			task.parents = filters[filter_of[nodes[i].parent]];
+		}
+		task.stats.ancestor_checks	= 0;
+		task.stats.ancestor_rejects	= 0;
+		task.stats.styles_shared	= 0;
+		task.stats.computed_shared	= 0;
+
+		if(task.subtree)
+		{
+			i += nodes[i].size;
+		} else
+		{
+			ancestor_filter filter = task.parents;
+			filter.add_element(task.root->get_tagName(), task.root->get_attr(_t("id")), task.root->get_attr(_t("class")));
+			filter_of[i] = (int) filters.size();
+			filters.push_back(filter);
+			i++;
+		}
+		m_tasks.push_back(task);
+	}
+
+	cascade_runner runner(m_tasks, stylesheet);
+	pool.run(runner, (int) m_tasks.size(), threads);
+}
+
+bool litehtml::cascade_matches::take( const element* el, const selector_match*& matches, int& count )
+{
+	while(m_task < m_tasks.size() && m_element >= m_tasks[m_task].elements.size())
+	{
+		m_task++;
+		m_element = 0;
+	}
+	if(m_task >= m_tasks.size())
+	{
+		return false;
+	}
+
+	const cascade_task& task = m_tasks[m_task];
+	const cascade_task::element_matches& rec = task.elements[m_element];
+	if(rec.el != el)
+	{
+		return false;
+	}
+	m_element++;
+
+	matches	= rec.count ? &task.matches[rec.first] : 0;
+	count	= rec.count;
+	return true;
+}
+
+void litehtml::cascade_matches::add_stats( cascade_stats& stats ) const
+{
+	for(std::vector<cascade_task>::const_iterator task = m_tasks.begin(); task != m_tasks.end(); task++)
+	{
+		stats.ancestor_checks	+= task->stats.ancestor_checks;
+		stats.ancestor_rejects	+= task->stats.ancestor_rejects;
+	}
+}
+
+void litehtml::cascade_matches::clear()
+{
+	m_tasks.clear();
+	m_task		= 0;
+	m_element	= 0;
+}
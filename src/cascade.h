@@ -0,0 +1,68 @@
+#pragma once
+
+namespace litehtml
+{
+	class css;
+	class element;
+	class thread_pool;
+
+	// Counters of html_tag::apply_stylesheet() and html_tag::parse_styles()
+	struct cascade_stats
+	{
+		int		ancestor_checks;	// selectors with ancestor names tested against the filter
+		int		ancestor_rejects;	// selectors rejected without walking the parent chain
+		int		styles_shared;		// m_style copied from an element in the style_cache
+		int		computed_shared;	// computed values copied from a sibling
+	};
+
+	// selector_match::apply of a selector html_tag::apply_stylesheet() has to select() itself
+	const int select_deferred = -1;
+
+	struct selector_match
+	{
+		typedef std::vector<selector_match>	vector;
+
+		int		index;	// position in css::selectors()
+		int		apply;	// result of html_tag::select() or select_deferred
+	};
+
+	// One subtree (or one element) matched by a worker thread
+	struct cascade_task
+	{
+		struct element_matches
+		{
+			const element*	el;
+			int				first;	// position in matches
+			int				count;
+		};
+
+		element*						root;
+		bool							subtree;
+		ancestor_filter					parents;
+		std::vector<element_matches>	elements;	// in the cascade order
+		selector_match::vector			matches;
+		cascade_stats					stats;
+	};
+
+	// Selector matching done on worker threads ahead of the cascade,
+	// see context::set_cascade_threads().
+	// Only selectors without sibling combinators are matched there: without
+	// pseudo classes they depend on the tags and attributes of the element
+	// and its ancestors, which the cascade does not change. Sibling selectors
+	// can see the ::before and ::after elements the cascade creates, they are
+	// deferred to the serial pass, so the result is the same as without threads.
+	class cascade_matches
+	{
+		std::vector<cascade_task>	m_tasks;
+		size_t						m_task;		// next take() position
+		size_t						m_element;
+	public:
+		cascade_matches();
+
+		void	match(element* root, const css& stylesheet, thread_pool& pool, int threads);
+		// matches of el, if it is the next element matched ahead
+		bool	take(const element* el, const selector_match*& matches, int& count);
+		void	add_stats(cascade_stats& stats) const;
+		void	clear();
+	};
+}
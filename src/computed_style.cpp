@@ -0,0 +1,168 @@
+#include "html.h"
+#include "computed_style.h"
+
+static bool same_length(const litehtml::css_length& a, const litehtml::css_length& b)
+{
+	if(a.is_predefined() != b.is_predefined())
+	{
+		return false;
+	}
+	if(a.is_predefined())
+	{
+		return a.predef() == b.predef();
+	}
+	return a.val() == b.val() && a.units() == b.units();
+}
+
+static bool same_margins(const litehtml::css_margins& a, const litehtml::css_margins& b)
+{
+	return	same_length(a.left,		b.left)		&&
+			same_length(a.right,	b.right)	&&
+			same_length(a.top,		b.top)		&&
+			same_length(a.bottom,	b.bottom);
+}
+
+static bool same_color(const litehtml::web_color& a, const litehtml::web_color& b)
+{
+	return a.red == b.red && a.green == b.green && a.blue == b.blue && a.alpha == b.alpha;
+}
+
+static bool same_border(const litehtml::css_border& a, const litehtml::css_border& b)
+{
+	return a.style == b.style && same_length(a.width, b.width) && same_color(a.color, b.color);
+}
+
+litehtml::computed_box::computed_box( const computed_box& val ) : object()
+{
+	margins		= val.margins;
+	padding		= val.padding;
+	width		= val.width;
+	height		= val.height;
+	min_width	= val.min_width;
+	min_height	= val.min_height;
+	max_width	= val.max_width;
+	max_height	= val.max_height;
+}
+
+bool litehtml::computed_box::equal( const computed_box& val ) const
+{
+	return	same_margins(margins, val.margins)			&&
+			same_margins(padding, val.padding)			&&
+			same_length(width,		val.width)			&&
+			same_length(height,		val.height)			&&
+			same_length(min_width,	val.min_width)		&&
+			same_length(min_height,	val.min_height)		&&
+			same_length(max_width,	val.max_width)		&&
+			same_length(max_height,	val.max_height);
+}
+
+litehtml::computed_border::computed_border( const computed_border& val ) : object()
+{
+	// css_borders copy constructor does not copy the radius
+	borders = val.borders;
+}
+
+bool litehtml::computed_border::equal( const computed_border& val ) const
+{
+	const css_border_radius& r1 = borders.radius;
+	const css_border_radius& r2 = val.borders.radius;
+
+	return	same_border(borders.left,	val.borders.left)	&&
+			same_border(borders.top,	val.borders.top)	&&
+			same_border(borders.right,	val.borders.right)	&&
+			same_border(borders.bottom,	val.borders.bottom)	&&
+			same_length(r1.top_left_x,		r2.top_left_x)		&&
+			same_length(r1.top_left_y,		r2.top_left_y)		&&
+			same_length(r1.top_right_x,		r2.top_right_x)		&&
+			same_length(r1.top_right_y,		r2.top_right_y)		&&
+			same_length(r1.bottom_right_x,	r2.bottom_right_x)	&&
+			same_length(r1.bottom_right_y,	r2.bottom_right_y)	&&
+			same_length(r1.bottom_left_x,	r2.bottom_left_x)	&&
+			same_length(r1.bottom_left_y,	r2.bottom_left_y);
+}
+
+bool litehtml::computed_border::same_layout( const computed_border& val ) const
+{
+	return	borders.left.style		== val.borders.left.style		&& same_length(borders.left.width,		val.borders.left.width)		&&
+			borders.top.style		== val.borders.top.style		&& same_length(borders.top.width,		val.borders.top.width)		&&
+			borders.right.style		== val.borders.right.style		&& same_length(borders.right.width,		val.borders.right.width)	&&
+			borders.bottom.style	== val.borders.bottom.style		&& same_length(borders.bottom.width,	val.borders.bottom.width);
+}
+
+litehtml::computed_background::computed_background( const computed_background& val ) : object()
+{
+	bg = val.bg;
+}
+
+bool litehtml::computed_background::equal( const computed_background& val ) const
+{
+	return	bg.m_attachment	== val.bg.m_attachment	&&
+			bg.m_repeat		== val.bg.m_repeat		&&
+			bg.m_clip		== val.bg.m_clip		&&
+			bg.m_origin		== val.bg.m_origin		&&
+			same_color(bg.m_color, val.bg.m_color)	&&
+			same_length(bg.m_position.x,		val.bg.m_position.x)		&&
+			same_length(bg.m_position.y,		val.bg.m_position.y)		&&
+			same_length(bg.m_position.width,	val.bg.m_position.width)	&&
+			same_length(bg.m_position.height,	val.bg.m_position.height)	&&
+			bg.m_image		== val.bg.m_image		&&
+			bg.m_baseurl	== val.bg.m_baseurl;
+}
+
+litehtml::computed_text::computed_text()
+{
+	font				= 0;
+	font_size			= 0;
+	line_height			= 0;
+	lh_predefined		= false;
+	list_type			= list_style_type_none;
+	list_position		= list_style_position_outside;
+}
+
+litehtml::computed_text::computed_text( const computed_text& val ) : object()
+{
+	font				= val.font;
+	font_size			= val.font_size;
+	metrics				= val.metrics;
+	line_height			= val.line_height;
+	lh_predefined		= val.lh_predefined;
+	text_indent			= val.text_indent;
+	list_type			= val.list_type;
+	list_position		= val.list_position;
+}
+
+bool litehtml::computed_text::equal( const computed_text& val ) const
+{
+	return	font				== val.font					&&
+			font_size			== val.font_size			&&
+			metrics.height		== val.metrics.height		&&
+			metrics.ascent		== val.metrics.ascent		&&
+			metrics.descent		== val.metrics.descent		&&
+			metrics.x_height	== val.metrics.x_height		&&
+			metrics.draw_spaces	== val.metrics.draw_spaces	&&
+			line_height			== val.line_height			&&
+			lh_predefined		== val.lh_predefined		&&
+			list_type			== val.list_type			&&
+			list_position		== val.list_position		&&
+			same_length(text_indent, val.text_indent);
+}
+
+litehtml::computed_position::computed_position()
+{
+	z_index = 0;
+}
+
+litehtml::computed_position::computed_position( const computed_position& val ) : object()
+{
+	offsets	= val.offsets;
+	z_index	= val.z_index;
+}
+
+bool litehtml::computed_position::equal( const computed_position& val ) const
+{
+	return	z_index == val.z_index						&&
+			same_length(offsets.left,	val.offsets.left)	&&
+			same_length(offsets.top,	val.offsets.top)	&&
+			same_length(offsets.right,	val.offsets.right)	&&
+			same_length(offsets.bottom,	val.offsets.bottom);
+}
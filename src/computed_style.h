@@ -0,0 +1,166 @@
+#pragma once
+#include "object.h"
+#include "css_length.h"
+#include "css_margins.h"
+#include "css_offsets.h"
+#include "borders.h"
+#include "background.h"
+
+namespace litehtml
+{
+	// Computed values of html_tag in immutable groups. A group is filled
+	// once by html_tag::parse_computed_style() and then shared: siblings
+	// with equal styles copy the pointers, and equal groups built one after
+	// another are replaced by the first one (see computed_styles::share).
+	// Elements with the same group pointer have the same values; code that
+	// changes a parsed group must call write_group() first.
+
+	struct computed_box : public object
+	{
+		typedef object_ptr<computed_box>	ptr;
+
+		css_margins		margins;
+		css_margins		padding;
+		css_length		width;
+		css_length		height;
+		css_length		min_width;
+		css_length		min_height;
+		css_length		max_width;
+		css_length		max_height;
+
+		computed_box() {}
+		computed_box(const computed_box& val);
+		bool equal(const computed_box& val) const;
+	};
+
+	struct computed_border : public object
+	{
+		typedef object_ptr<computed_border>	ptr;
+
+		css_borders		borders;
+
+		computed_border() {}
+		computed_border(const computed_border& val);
+		bool equal(const computed_border& val) const;
+		// compares widths and styles only, colors do not change the layout
+		bool same_layout(const computed_border& val) const;
+	};
+
+	struct computed_background : public object
+	{
+		typedef object_ptr<computed_background>	ptr;
+
+		background		bg;
+
+		computed_background() {}
+		computed_background(const computed_background& val);
+		bool equal(const computed_background& val) const;
+	};
+
+	struct computed_text : public object
+	{
+		typedef object_ptr<computed_text>	ptr;
+
+		uint_ptr			font;
+		int					font_size;
+		font_metrics		metrics;
+		int					line_height;
+		bool				lh_predefined;
+		css_length			text_indent;
+		list_style_type		list_type;
+		list_style_position	list_position;
+
+		computed_text();
+		computed_text(const computed_text& val);
+		bool equal(const computed_text& val) const;
+	};
+
+	struct computed_position : public object
+	{
+		typedef object_ptr<computed_position>	ptr;
+
+		css_offsets		offsets;
+		int				z_index;
+
+		computed_position();
+		computed_position(const computed_position& val);
+		bool equal(const computed_position& val) const;
+	};
+
+	// makes group the only owner of its values before they are changed
+	template<class T>
+	T* write_group(object_ptr<T>& group)
+	{
+		if(group->is_shared())
+		{
+			group = new T(*group);
+		}
+		return group;
+	}
+
+	const int computed_recent_size = 4;
+
+	// Default values and the last groups built in the current parse pass
+	// for one group type.
+	template<class T>
+	class computed_group_pool
+	{
+		typename T::ptr		m_default;
+		typename T::ptr		m_recent[computed_recent_size];
+		int					m_next;
+	public:
+		computed_group_pool()
+		{
+			m_default	= new T;
+			m_next		= 0;
+		}
+
+		const typename T::ptr& get_default() const
+		{
+			return m_default;
+		}
+
+		// replaces group by an equal recent one, or remembers it
+		void share(typename T::ptr& group)
+		{
+			for(int i = 0; i < computed_recent_size; i++)
+			{
+				if(m_recent[i] && m_recent[i]->equal(*group))
+				{
+					group = m_recent[i];
+					return;
+				}
+			}
+			m_recent[m_next] = group;
+			m_next = (m_next + 1) % computed_recent_size;
+		}
+
+		void clear()
+		{
+			for(int i = 0; i < computed_recent_size; i++)
+			{
+				m_recent[i] = 0;
+			}
+			m_next = 0;
+		}
+	};
+
+	class computed_styles
+	{
+	public:
+		computed_group_pool<computed_box>			box;
+		computed_group_pool<computed_border>		border;
+		computed_group_pool<computed_background>	background;
+		computed_group_pool<computed_text>			text;
+		computed_group_pool<computed_position>		position;
+
+		void clear()
+		{
+			box.clear();
+			border.clear();
+			background.clear();
+			text.clear();
+			position.clear();
+		}
+	};
+}
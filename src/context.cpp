@@ -9,4 +9,8 @@ void litehtml::context::load_master_stylesheet( const tchar_t* str )
 
 	m_master_css.parse_stylesheet(str, 0, 0, media);
 	m_master_css.sort_selectors();
+
+	// documents copy the pool, so they don't write the shared selectors
+	m_atoms = atom_pool();
+	m_master_css.resolve_atoms(m_atoms);
 }
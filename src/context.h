@@ -1,16 +1,67 @@
 #pragma once
 #include "stylesheet.h"
+#include "thread_pool.h"
 
 namespace litehtml
 {
 	class context
 	{
-		litehtml::css	m_master_css;
+		litehtml::css			m_master_css;
+		litehtml::atom_pool		m_atoms;	// names of the master stylesheet, copied into every document
+		bool					m_use_arena;
+		int						m_cascade_threads;
+		int						m_layout_threads;
+		litehtml::thread_pool	m_thread_pool;
 	public:
-		void			load_master_stylesheet(const tchar_t* str);
-		litehtml::css&	master_css()
+		context() : m_use_arena(false), m_cascade_threads(1), m_layout_threads(1) {}
+
+		void					load_master_stylesheet(const tchar_t* str);
+		litehtml::css&			master_css()
 		{
 			return m_master_css;
 		}
+		const litehtml::atom_pool&	atoms() const
+		{
+			return m_atoms;
+		}
+		// documents created after this call allocate their elements
+		// and boxes from a per-document litehtml::arena. Their elements
+		// must not be kept after the document is released.
+		void					set_use_arena(bool use)
+		{
+			m_use_arena = use;
+		}
+		bool					use_arena() const
+		{
+			return m_use_arena;
+		}
+		// number of threads matching selectors ahead of the cascade,
+		// see litehtml::cascade_matches. 1 keeps the cascade serial.
+		void					set_cascade_threads(int threads)
+		{
+			m_cascade_threads = threads;
+		}
+		int						cascade_threads() const
+		{
+			return m_cascade_threads;
+		}
+		// number of threads laying out blocks of fixed width ahead of the
+		// document (see document::prelayout()) and measuring table cells.
+		// The container must answer get_image_size() and pt_to_px() from
+		// any thread. Not used for documents with an arena, nor for
+		// render_positioned(). 1 keeps the layout serial.
+		void					set_layout_threads(int threads)
+		{
+			m_layout_threads = threads;
+		}
+		int						layout_threads() const
+		{
+			return m_layout_threads;
+		}
+		// the threads of both, shared by the documents of this context
+		litehtml::thread_pool&	threads()
+		{
+			return m_thread_pool;
+		}
 	};
 }
\ No newline at end of file
@@ -1,17 +1,26 @@
 #include "html.h"
 #include "css_length.h"
 
-void litehtml::css_length::fromString( const tstring& str, const tstring& predefs, int defValue )
+void litehtml::css_length::fromString( const tstring& str, const tchar_t* predefs, int defValue )
+{
+	parse(str, value_index(str.c_str(), predefs, -1), defValue);
+}
+
+void litehtml::css_length::fromString( const tstring& str, const keyword_table* predefs, int defValue )
+{
+	parse(str, predefs ? keyword_index(*predefs, str.c_str()) : -1, defValue);
+}
+
+void litehtml::css_length::parse( const tstring& str, int predef, int defValue )
 {
 	// TODO: Make support for calc
-	if(str.substr(0, 4) == _t("calc"))
+	if(!t_strncmp(str.c_str(), _t("calc"), 4))
 	{
 		m_is_predefined = true;
 		m_predef		= 0;
 		return;
 	}
 
-	int predef = value_index(str.c_str(), predefs.c_str(), -1);
 	if(predef >= 0)
 	{
 		m_is_predefined = true;
@@ -43,7 +52,7 @@ void litehtml::css_length::fromString( const tstring& str, const tstring& predef
 		if(!num.empty())
 		{
 			m_value = (float) t_strtod(num.c_str(), 0);
-			m_units	= (css_units) value_index(un.c_str(), css_units_strings, css_units_none);
+			m_units	= (css_units) keyword_index(css_units_keywords, un.c_str(), css_units_none);
 		} else
 		{
 			// not a number so it is predefined
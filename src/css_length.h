@@ -3,6 +3,8 @@
 
 namespace litehtml
 {
+	struct keyword_table;
+
 	class css_length
 	{
 		union
@@ -24,7 +26,10 @@ namespace litehtml
 		float		val() const;
 		css_units	units() const;
 		int			calc_percent(int width) const;
-		void		fromString(const tstring& str, const tstring& predefs = _t(""), int defValue = 0);
+		void		fromString(const tstring& str, const tchar_t* predefs = _t(""), int defValue = 0);
+		void		fromString(const tstring& str, const keyword_table* predefs, int defValue = 0);
+	private:
+		void		parse(const tstring& str, int predef, int defValue);
 	};
 
 	// css_length inlines
@@ -4,6 +4,8 @@
 
 void litehtml::css_element_selector::parse( const tstring& txt )
 {
+	m_atoms_generation = 0;
+
 	tstring::size_type el_end = txt.find_first_of(_t(".#[:"));
 	m_tag = txt.substr(0, el_end);
 	litehtml::lcase(m_tag);
@@ -151,6 +153,34 @@ void litehtml::css_element_selector::parse( const tstring& txt )
 	}
 }
 
+void litehtml::css_element_selector::add_atoms( atom_pool& atoms ) const
+{
+	m_tag_id = (m_tag.empty() || m_tag == _t("*")) ? atom_empty : atoms.get(m_tag.c_str());
+	for(css_attribute_selector::vector::const_iterator i = m_attrs.begin(); i != m_attrs.end(); i++)
+	{
+		i->attribute_id = atoms.get(i->attribute.c_str());
+		i->val_ids.clear();
+		if(i->condition == select_equal && (i->attribute_id == atom_id || i->attribute_id == atom_class))
+		{
+			tstring names = i->val;
+			lcase(names);
+			if(i->attribute_id == atom_class)
+			{
+				string_vector tokens;
+				split_string(names, tokens, _t(" "));
+				for(string_vector::const_iterator tok = tokens.begin(); tok != tokens.end(); tok++)
+				{
+					i->val_ids.push_back(atoms.get(tok->c_str()));
+				}
+			} else
+			{
+				i->val_ids.push_back(atoms.get(names.c_str()));
+			}
+		}
+	}
+	m_atoms_generation = atoms.generation();
+}
+
 
 bool litehtml::css_selector::parse( const tstring& text )
 {
@@ -257,6 +287,42 @@ void litehtml::css_selector::calc_specificity()
 	}
 }
 
+void litehtml::css_selector::calc_ancestor_hashes()
+{
+	m_ancestor_hashes.clear();
+
+	// the compounds to the left of a sibling combinator are not ancestors
+	const css_selector* sel = this;
+	while(sel->m_left && (sel->m_combinator == combinator_descendant || sel->m_combinator == combinator_child))
+	{
+		sel = sel->m_left;
+		const css_element_selector& el = sel->m_right;
+		if(!el.m_tag.empty() && el.m_tag != _t("*"))
+		{
+			m_ancestor_hashes.push_back(ancestor_filter::hash(ancestor_filter::name_tag, el.m_tag.c_str()));
+		}
+		for(css_attribute_selector::vector::const_iterator i = el.m_attrs.begin(); i != el.m_attrs.end(); i++)
+		{
+			if(i->condition != select_equal)
+			{
+				continue;
+			}
+			if(i->attribute == _t("id"))
+			{
+				m_ancestor_hashes.push_back(ancestor_filter::hash(ancestor_filter::name_id, i->val.c_str()));
+			} else if(i->attribute == _t("class"))
+			{
+				string_vector tokens;
+				split_string(i->val, tokens, _t(" "));
+				for(string_vector::iterator tok = tokens.begin(); tok != tokens.end(); tok++)
+				{
+					m_ancestor_hashes.push_back(ancestor_filter::hash(ancestor_filter::name_class, tok->c_str()));
+				}
+			}
+		}
+	}
+}
+
 void litehtml::css_selector::add_media_to_doc( document* doc ) const
 {
 	if(m_media_query && doc)
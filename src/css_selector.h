@@ -135,17 +135,22 @@ namespace litehtml
 		tstring					attribute;
 		tstring					val;
 		attr_select_condition	condition;
+		mutable atom			attribute_id;
+		mutable std::vector<atom>	val_ids;	// lowercase id or class names of val for select_equal
 
 		css_attribute_selector()
 		{
-			condition = select_exists;
+			condition		= select_exists;
+			attribute_id	= atom_empty;
 		}
 
 		css_attribute_selector(const css_attribute_selector& val)
 		{
-			this->val	= val.val;
-			condition	= val.condition;
-			attribute	= val.attribute;
+			this->val		= val.val;
+			condition		= val.condition;
+			attribute		= val.attribute;
+			attribute_id	= val.attribute_id;
+			val_ids			= val.val_ids;
 		}
 	};
 
@@ -156,21 +161,40 @@ namespace litehtml
 	public:
 		tstring							m_tag;
 		css_attribute_selector::vector	m_attrs;
+		// atoms of m_tag and of the attribute names, see resolve_atoms()
+		mutable atom					m_tag_id;
+		mutable int						m_atoms_generation;
 	public:
 		css_element_selector()
 		{
-
+			m_tag_id			= atom_empty;
+			m_atoms_generation	= 0;
 		}
 
 		css_element_selector(const css_element_selector& val)
 		{
-			m_tag	= val.m_tag;
-			m_attrs	= val.m_attrs;
+			m_tag				= val.m_tag;
+			m_attrs				= val.m_attrs;
+			m_tag_id			= val.m_tag_id;
+			m_atoms_generation	= val.m_atoms_generation;
 		}
 
 		void parse(const tstring& txt);
+		void resolve_atoms(atom_pool& atoms) const;
+	private:
+		void add_atoms(atom_pool& atoms) const;
 	};
 
+	// Selectors are parsed without a document, so the names are
+	// interned on the first match against the elements of a document.
+	inline void css_element_selector::resolve_atoms(atom_pool& atoms) const
+	{
+		if(!atoms.has_generation(m_atoms_generation))
+		{
+			add_atoms(atoms);
+		}
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 
 	enum css_combinator
@@ -196,6 +220,8 @@ namespace litehtml
 		style::ptr				m_style;
 		int						m_order;
 		media_query_list::ptr	m_media_query;
+		// ancestor_filter hashes of the names the ancestors must have
+		std::vector<unsigned int>	m_ancestor_hashes;
 	public:
 		css_selector(media_query_list::ptr media)
 		{
@@ -222,14 +248,29 @@ namespace litehtml
 			m_specificity	= val.m_specificity;
 			m_order			= val.m_order;
 			m_media_query	= val.m_media_query;
+			m_ancestor_hashes	= val.m_ancestor_hashes;
 		}
 
 		bool parse(const tstring& text);
 		void calc_specificity();
+		void calc_ancestor_hashes();
+		bool has_sibling_combinator() const;
 		bool is_media_valid() const;
 		void add_media_to_doc(document* doc) const;
 	};
 
+	inline bool css_selector::has_sibling_combinator() const
+	{
+		for(const css_selector* sel = this; sel->m_left; sel = sel->m_left)
+		{
+			if(sel->m_combinator == combinator_adjacent_sibling || sel->m_combinator == combinator_general_sibling)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
 	inline bool css_selector::is_media_valid() const
 	{
 		if(!m_media_query)
@@ -260,12 +301,12 @@ namespace litehtml
 		return (v1.m_specificity < v2.m_specificity);
 	}
 
-	inline bool operator > (css_selector::ptr v1, css_selector::ptr v2)
+	inline bool operator > (const css_selector::ptr& v1, const css_selector::ptr& v2)
 	{
 		return (*v1 > *v2);
 	}
 
-	inline bool operator < (css_selector::ptr v1, css_selector::ptr v2)
+	inline bool operator < (const css_selector::ptr& v1, const css_selector::ptr& v2)
 	{
 		return (*v1 < *v2);
 	}
@@ -280,10 +321,12 @@ namespace litehtml
 
 		css_selector::ptr	m_selector;
 		bool				m_used;
+		bool				m_dynamic;	// the result depends on pseudo classes
 
 		used_selector(css_selector::ptr selector, bool used)
 		{
 			m_used		= used;
+			m_dynamic	= false;
 			m_selector	= selector;
 		}
 	};
@@ -16,6 +16,7 @@
 #include "el_div.h"
 #include "el_font.h"
 #include "el_tr.h"
+#include "utf8_scanner.h"
 #include <math.h>
 #include <stdio.h>
 #include <algorithm>
@@ -27,10 +28,22 @@ litehtml::stop_tags_t litehtml::document::m_stop_tags[] =
 	{ 0,	0},
 };
 
-litehtml::document::document(litehtml::document_container* objContainer, litehtml::context* ctx)
+litehtml::document::document(litehtml::document_container* objContainer, litehtml::context* ctx) : m_atoms(ctx->atoms())
 {
 	m_container	= objContainer;
 	m_context	= ctx;
+	m_cascade_stats.ancestor_checks		= 0;
+	m_cascade_stats.ancestor_rejects	= 0;
+	m_cascade_stats.styles_shared		= 0;
+	m_cascade_stats.computed_shared		= 0;
+	m_layout_width		= -1;
+	m_layout_ret		= 0;
+	m_layout_generation	= 0;
+	m_layout_tasks		= false;
+	if(ctx->use_arena())
+	{
+		m_arena = new arena;
+	}
 }
 
 litehtml::document::~document()
@@ -45,105 +58,76 @@ litehtml::document::~document()
 	}
 }
 
-litehtml::document::ptr litehtml::document::createFromStream(litehtml::instream& str, litehtml::document_container* objPainter, litehtml::context* ctx, litehtml::css* user_styles)
+// Both scanners return the same tokens, values are passed on as
+// (pointer, length) pairs without copying them.
+template<class scanner_type>
+void litehtml::document::parse( scanner_type& sc )
 {
-	litehtml::document::ptr doc = new litehtml::document(objPainter, ctx);
-	litehtml::scanner sc(str);
-
-	doc->begin_parse();
+	begin_parse();
 
 	int t = 0;
 	tstring tmp_str;
-	while((t = sc.get_token()) != litehtml::scanner::TT_EOF && !doc->m_parse_stack.empty())
+	while((t = sc.get_token()) != litehtml::scanner::TT_EOF && !m_parse_stack.empty())
 	{
 		switch(t)
 		{
 		case litehtml::scanner::TT_CDATA_START:
-			doc->parse_cdata_start();
+			parse_cdata_start();
 			break;
 		case litehtml::scanner::TT_CDATA_END:
-			doc->parse_cdata_end();
+			parse_cdata_end();
 			break;
 		case litehtml::scanner::TT_COMMENT_START:
-			doc->parse_comment_start();
+			parse_comment_start();
 			break;
 		case litehtml::scanner::TT_COMMENT_END:
-			doc->parse_comment_end();
+			parse_comment_end();
 			break;
 		case litehtml::scanner::TT_DATA:
-			doc->parse_data(sc.get_value());
+			parse_data(sc.get_value(), sc.get_value_length());
 			break;
 		case litehtml::scanner::TT_TAG_START:
 			{
-				tmp_str = sc.get_tag_name();
+				tmp_str.assign(sc.get_tag_name(), sc.get_tag_name_length());
 				if(!tmp_str.empty() && tmp_str[0] != '!')
 				{
 					litehtml::lcase(tmp_str);
-					doc->parse_tag_start(tmp_str.c_str());
+					parse_tag_start(tmp_str.c_str());
 				}
 			}
 			break;
 		case litehtml::scanner::TT_TAG_END_EMPTY:
 		case litehtml::scanner::TT_TAG_END:
 			{
-				tmp_str = sc.get_tag_name();
+				tmp_str.assign(sc.get_tag_name(), sc.get_tag_name_length());
 				litehtml::lcase(tmp_str);
-				doc->parse_tag_end(tmp_str.c_str());
+				parse_tag_end(tmp_str.c_str());
 			}
 			break;
 		case litehtml::scanner::TT_ATTR:
 			{
-				tmp_str = sc.get_attr_name();
+				tmp_str.assign(sc.get_attr_name(), sc.get_attr_name_length());
 				litehtml::lcase(tmp_str);
-				doc->parse_attribute(tmp_str.c_str(), sc.get_value());
+				parse_attribute(tmp_str.c_str(), sc.get_value(), sc.get_value_length());
 			}
 			break;
 		case litehtml::scanner::TT_WORD: 
-			doc->parse_word(sc.get_value());
+			parse_word(sc.get_value(), sc.get_value_length());
 			break;
 		case litehtml::scanner::TT_SPACE:
-			doc->parse_space(sc.get_value());
+			parse_space(sc.get_value(), sc.get_value_length());
 			break;
 		}
 	}
+}
 
-	if(doc->m_root)
-	{
-		doc->m_root->apply_stylesheet(ctx->master_css());
-
-		doc->m_root->parse_attributes();
-
-		media_query_list::ptr media;
-
-		for(css_text::vector::iterator css = doc->m_css.begin(); css != doc->m_css.end(); css++)
-		{
-			if(!css->media.empty())
-			{
-				media = media_query_list::create_from_string(css->media, doc);
-			} else
-			{
-				media = 0;
-			}
-			doc->m_styles.parse_stylesheet(css->text.c_str(), css->baseurl.c_str(), doc, media);
-		}
-		doc->m_styles.sort_selectors();
-
-		if(!doc->m_media_lists.empty())
-		{
-			media_features features;
-			doc->container()->get_media_features(features);
-			doc->update_media_lists(features);
-		}
-
-		doc->m_root->apply_stylesheet(doc->m_styles);
-
-		if(user_styles)
-		{
-			doc->m_root->apply_stylesheet(*user_styles);
-		}
+litehtml::document::ptr litehtml::document::createFromStream(litehtml::instream& str, litehtml::document_container* objPainter, litehtml::context* ctx, litehtml::css* user_styles)
+{
+	litehtml::document::ptr doc = new litehtml::document(objPainter, ctx);
+	litehtml::scanner sc(str);
 
-		doc->m_root->parse_styles();
-	}
+	doc->parse(sc);
+	doc->end_parse(user_styles);
 
 	return doc;
 }
@@ -151,17 +135,27 @@ litehtml::document::ptr litehtml::document::createFromStream(litehtml::instream&
 litehtml::document::ptr litehtml::document::createFromString( const tchar_t* str, litehtml::document_container* objPainter, litehtml::context* ctx, litehtml::css* user_styles)
 {
 #ifdef LITEHTML_UTF8
-	utf8_instream si((const byte*) str);
+	return createFromUTF8((const byte*) str, objPainter, ctx, user_styles);
 #else
 	str_instream si(str);
-#endif
 	return createFromStream(si, objPainter, ctx, user_styles);
+#endif
 }
 
 litehtml::document::ptr litehtml::document::createFromUTF8(const byte* str, litehtml::document_container* objPainter, litehtml::context* ctx, litehtml::css* user_styles)
 {
+#ifdef LITEHTML_UTF8
+	litehtml::document::ptr doc = new litehtml::document(objPainter, ctx);
+	litehtml::utf8_scanner sc((const tchar_t*) str);
+
+	doc->parse(sc);
+	doc->end_parse(user_styles);
+
+	return doc;
+#else
 	utf8_instream si(str);
 	return createFromStream(si, objPainter, ctx, user_styles);
+#endif
 }
 
 litehtml::uint_ptr litehtml::document::add_font( const tchar_t* name, int size, const tchar_t* weight, const tchar_t* style, const tchar_t* decoration, font_metrics* fm )
@@ -193,8 +187,8 @@ litehtml::uint_ptr litehtml::document::add_font( const tchar_t* name, int size,
 
 	if(m_fonts.find(key) == m_fonts.end())
 	{
-		font_style fs = (font_style) value_index(style, font_style_strings, fontStyleNormal);
-		int	fw = value_index(weight, font_weight_strings, -1);
+		font_style fs = (font_style) keyword_index(font_style_keywords, style, fontStyleNormal);
+		int	fw = keyword_index(font_weight_keywords, weight, -1);
 		if(fw >= 0)
 		{
 			switch(fw)
@@ -293,11 +287,70 @@ litehtml::uint_ptr litehtml::document::get_font( const tchar_t* name, int size,
 	return add_font(name, size, weight, style, decoration, fm);
 }
 
+void litehtml::document::queue_text_width( object* owner, const tchar_t* text, uint_ptr hFont, int* width )
+{
+	text_request req;
+	req.owner	= owner;
+	req.text	= text;
+	req.font	= hFont;
+	req.width	= width;
+	req.index	= -1;
+	m_text_queue.push_back(req);
+}
+
+// Measures the queued words: cached widths are copied, the others go to
+// the container in one text_width_batch() call per run of the same font.
+// Fonts live as long as the document, so a handle always means one font.
+void litehtml::document::flush_text_widths()
+{
+	size_t first = 0;
+	while(first < m_text_queue.size())
+	{
+		uint_ptr font = m_text_queue[first].font;
+		size_t last = first;
+
+		std::vector<const tchar_t*>	texts;
+		std::map<tstring, int>		batch;
+		for(; last < m_text_queue.size() && m_text_queue[last].font == font; last++)
+		{
+			text_request& req = m_text_queue[last];
+			if(!m_text_cache.find(font, req.text, *req.width))
+			{
+				std::pair<std::map<tstring, int>::iterator, bool> ins = batch.insert(std::make_pair(tstring(req.text), (int) texts.size()));
+				if(ins.second)
+				{
+					texts.push_back(req.text);
+				}
+				req.index = ins.first->second;
+			}
+		}
+
+		if(!texts.empty())
+		{
+			std::vector<int> widths(texts.size(), 0);
+			m_container->text_width_batch(&texts[0], (int) texts.size(), font, &widths[0]);
+			for(size_t i = 0; i < texts.size(); i++)
+			{
+				m_text_cache.add(font, texts[i], widths[i]);
+			}
+			for(size_t i = first; i < last; i++)
+			{
+				if(m_text_queue[i].index >= 0)
+				{
+					*m_text_queue[i].width = widths[m_text_queue[i].index];
+				}
+			}
+		}
+		first = last;
+	}
+	m_text_queue.clear();
+}
+
 litehtml::element* litehtml::document::add_root()
 {
 	if(!m_root)
 	{
-		m_root = new html_tag(this);
+		m_root = placed(new (m_arena) html_tag(this), m_arena);
 		m_root->addRef();
 		m_root->set_tagName(_t("html"));
 	}
@@ -310,13 +363,23 @@ litehtml::element* litehtml::document::add_body()
 	{
 		add_root();
 	}
-	element* el = new el_body(this);
+	element* el = placed(new (m_arena) el_body(this), m_arena);
 	el->set_tagName(_t("body"));
 	m_root->appendChild(el);
 	return el;
 }
 
 int litehtml::document::render( int max_width, render_type rt )
+{
+	// layouts kept by the elements may depend on images loaded since
+	if(rt != render_fixed_only)
+	{
+		m_layout_generation++;
+	}
+	return layout(max_width, rt);
+}
+
+int litehtml::document::layout( int max_width, render_type rt )
 {
 	int ret = 0;
 	if(m_root)
@@ -327,6 +390,7 @@ int litehtml::document::render( int max_width, render_type rt )
 			m_root->render_positioned(rt);
 		} else
 		{
+			prelayout(max_width);
 			ret = m_root->render(0, 0, max_width);
 			if(m_root->fetch_positioned())
 			{
@@ -336,11 +400,79 @@ int litehtml::document::render( int max_width, render_type rt )
 			m_size.width	= 0;
 			m_size.height	= 0;
 			m_root->calc_document_size(m_size);
+
+			m_layout_width	= (rt == render_all) ? max_width : -1;
+			m_layout_ret	= ret;
 		}
 	}
 	return ret;
 }
 
+namespace
+{
+	class prelayout_runner : public litehtml::parallel_tasks
+	{
+		litehtml::elements_vector&	m_elements;
+		int							m_max_width;
+	public:
+		prelayout_runner(litehtml::elements_vector& elements, int max_width)
+			: m_elements(elements), m_max_width(max_width)
+		{
+		}
+
+		virtual void run_task(int task)
+		{
+			m_elements[task]->render(0, 0, m_max_width);
+		}
+	};
+}
+
+// Lays out the blocks of fixed width on the layout threads. The subtrees
+// don't share anything, the layout of each one is kept by its root and
+// taken by the serial render (see html_tag::reuse_layout), which gives
+// the same result as without threads. render_positioned() is not done
+// here, the positioned boxes are placed by the serial render after it.
+void litehtml::document::prelayout( int max_width )
+{
+	if(layout_threads() <= 1)
+	{
+		return;
+	}
+
+	elements_vector els;
+	m_root->find_prelayout(els);
+	if(els.size() > 1)
+	{
+		prelayout_runner runner(els, max_width);
+		run_layout_tasks(runner, (int) els.size());
+	}
+}
+
+void litehtml::document::run_layout_tasks( parallel_tasks& tasks, int count )
+{
+	int threads = layout_threads();
+	m_layout_tasks = true;
+	m_context->threads().run(tasks, count, threads);
+	m_layout_tasks = false;
+}
+
+// Same as render() after on_mouse_over() and the other event handlers, or
+// when the window is resized: the elements keep their layout while their
+// styles and available width stay the same.
+int litehtml::document::relayout( int max_width )
+{
+	if(!m_root)
+	{
+		return 0;
+	}
+	// after a paint only change the last layout is still valid
+	if(max_width == m_layout_width && !m_root->need_layout())
+	{
+		return m_layout_ret;
+	}
+	return layout(max_width, render_all);
+}
+
 void litehtml::document::draw( uint_ptr hdc, int x, int y, const position* clip )
 {
 	if(m_root)
@@ -420,6 +552,39 @@ void litehtml::document::add_stylesheet( const tchar_t* str, const tchar_t* base
 	}
 }
 
+static litehtml::element* common_ancestor( litehtml::element* a, litehtml::element* b )
+{
+	for(litehtml::element* el = a; el; el = el->parent())
+	{
+		for(litehtml::element* p = b; p; p = p->parent())
+		{
+			if(el == p)
+			{
+				return el;
+			}
+		}
+	}
+	return 0;
+}
+
+// Moving the pointer from old_el to new_el changes :hover below their common
+// ancestor only, :active can be lost by old_el itself. Pseudo classes of an
+// element also affect selectors of its siblings.
+static litehtml::element* hover_changes_root( litehtml::element* old_el, litehtml::element* new_el )
+{
+	litehtml::element* top = common_ancestor(old_el, new_el);
+	if(top && top == old_el && top->parent())
+	{
+		top = top->parent();
+	}
+	return top;
+}
+
+static litehtml::element* active_changes_root( litehtml::element* el )
+{
+	return el->parent() ? el->parent() : el;
+}
+
 bool litehtml::document::on_mouse_over( int x, int y, int client_x, int client_y, position::vector& redraw_boxes )
 {
 	if(!m_root)
@@ -430,6 +595,7 @@ bool litehtml::document::on_mouse_over( int x, int y, int client_x, int client_y
 	element::ptr over_el = m_root->get_element_by_point(x, y, client_x, client_y);
 
 	bool state_was_changed = false;
+	element* changes_root = 0;
 
 	if(over_el != m_over_element)
 	{
@@ -440,6 +606,7 @@ bool litehtml::document::on_mouse_over( int x, int y, int client_x, int client_y
 				state_was_changed = true;
 			}
 		}
+		changes_root = hover_changes_root(m_over_element, over_el);
 		m_over_element = over_el;
 	}
 
@@ -458,7 +625,7 @@ bool litehtml::document::on_mouse_over( int x, int y, int client_x, int client_y
 	
 	if(state_was_changed)
 	{
-		return m_root->find_styles_changes(redraw_boxes, 0, 0);
+		return restyle(changes_root ? changes_root : (element*) m_root, redraw_boxes);
 	}
 	return false;
 }
@@ -473,7 +640,7 @@ bool litehtml::document::on_mouse_leave( position::vector& redraw_boxes )
 	{
 		if(m_over_element->on_mouse_leave())
 		{
-			return m_root->find_styles_changes(redraw_boxes, 0, 0);
+			return restyle(m_root, redraw_boxes);
 		}
 	}
 	return false;
@@ -489,6 +656,7 @@ bool litehtml::document::on_lbutton_down( int x, int y, int client_x, int client
 	element::ptr over_el = m_root->get_element_by_point(x, y, client_x, client_y);
 
 	bool state_was_changed = false;
+	element* changes_root = 0;
 
 	if(over_el != m_over_element)
 	{
@@ -499,6 +667,11 @@ bool litehtml::document::on_lbutton_down( int x, int y, int client_x, int client
 				state_was_changed = true;
 			}
 		}
+		changes_root = hover_changes_root(m_over_element, over_el);
+		if(!changes_root)
+		{
+			changes_root = m_root;
+		}
 		m_over_element = over_el;
 		if(m_over_element)
 		{
@@ -516,6 +689,8 @@ bool litehtml::document::on_lbutton_down( int x, int y, int client_x, int client
 		if(m_over_element->on_lbutton_down())
 		{
 			state_was_changed = true;
+			element* active_root = active_changes_root(m_over_element);
+			changes_root = changes_root ? common_ancestor(changes_root, active_root) : active_root;
 		}
 		cursor = m_over_element->get_cursor();
 	}
@@ -524,7 +699,7 @@ bool litehtml::document::on_lbutton_down( int x, int y, int client_x, int client
 
 	if(state_was_changed)
 	{
-		return m_root->find_styles_changes(redraw_boxes, 0, 0);
+		return restyle(changes_root ? changes_root : (element*) m_root, redraw_boxes);
 	}
 
 	return false;
@@ -540,12 +715,41 @@ bool litehtml::document::on_lbutton_up( int x, int y, int client_x, int client_y
 	{
 		if(m_over_element->on_lbutton_up())
 		{
-			return m_root->find_styles_changes(redraw_boxes, 0, 0);
+			return restyle(active_changes_root(m_over_element), redraw_boxes);
 		}
 	}
 	return false;
 }
 
+bool litehtml::document::restyle( element* subtree, position::vector& redraw_boxes )
+{
+	// the same origin as find_styles_changes() passes down from the root:
+	// the sum of parent positions, up to the nearest fixed parent
+	int x = 0;
+	int y = 0;
+	element* parent = subtree->parent();
+	if(parent)
+	{
+		position pos = parent->get_placement();
+		for(element* el = parent; el; el = el->parent())
+		{
+			if(el->get_element_position() == element_position_fixed)
+			{
+				if(el->parent())
+				{
+					position above = el->parent()->get_placement();
+					pos.x -= above.x;
+					pos.y -= above.y;
+				}
+				break;
+			}
+		}
+		x = pos.x;
+		y = pos.y;
+	}
+	return subtree->find_styles_changes(redraw_boxes, x, y);
+}
+
 litehtml::element::ptr litehtml::document::create_element( const tchar_t* tag_name )
 {
 	element::ptr newTag = NULL;
@@ -555,54 +759,57 @@ litehtml::element::ptr litehtml::document::create_element( const tchar_t* tag_na
 	}
 	if(!newTag)
 	{
-		if(!t_strcmp(tag_name, _t("br")))
-		{
-			newTag = new litehtml::el_break(this);
-		} else if(!t_strcmp(tag_name, _t("p")))
-		{
-			newTag = new litehtml::el_para(this);
-		} else if(!t_strcmp(tag_name, _t("img")))
-		{
-			newTag = new litehtml::el_image(this);
-		} else if(!t_strcmp(tag_name, _t("table")))
-		{
-			newTag = new litehtml::el_table(this);
-		} else if(!t_strcmp(tag_name, _t("td")) || !t_strcmp(tag_name, _t("th")))
-		{
-			newTag = new litehtml::el_td(this);
-		} else if(!t_strcmp(tag_name, _t("link")))
-		{
-			newTag = new litehtml::el_link(this);
-		} else if(!t_strcmp(tag_name, _t("title")))
+		switch(atoms().get(tag_name))
 		{
-			newTag = new litehtml::el_title(this);
-		} else if(!t_strcmp(tag_name, _t("a")))
-		{
-			newTag = new litehtml::el_anchor(this);
-		} else if(!t_strcmp(tag_name, _t("tr")))
-		{
-			newTag = new litehtml::el_tr(this);
-		} else if(!t_strcmp(tag_name, _t("style")))
-		{
-			newTag = new litehtml::el_style(this);
-		} else if(!t_strcmp(tag_name, _t("base")))
-		{
-			newTag = new litehtml::el_base(this);
-		} else if(!t_strcmp(tag_name, _t("body")))
-		{
-			newTag = new litehtml::el_body(this);
-		} else if(!t_strcmp(tag_name, _t("div")))
-		{
-			newTag = new litehtml::el_div(this);
-		} else if(!t_strcmp(tag_name, _t("script")))
-		{
-			newTag = new litehtml::el_script(this);
-		} else if(!t_strcmp(tag_name, _t("font")))
-		{
-			newTag = new litehtml::el_font(this);
-		} else
-		{
-			newTag = new litehtml::html_tag(this);
+		case atom_br:
+			newTag = placed(new (m_arena) litehtml::el_break(this), m_arena);
+			break;
+		case atom_p:
+			newTag = placed(new (m_arena) litehtml::el_para(this), m_arena);
+			break;
+		case atom_img:
+			newTag = placed(new (m_arena) litehtml::el_image(this), m_arena);
+			break;
+		case atom_table:
+			newTag = placed(new (m_arena) litehtml::el_table(this), m_arena);
+			break;
+		case atom_td:
+		case atom_th:
+			newTag = placed(new (m_arena) litehtml::el_td(this), m_arena);
+			break;
+		case atom_link:
+			newTag = placed(new (m_arena) litehtml::el_link(this), m_arena);
+			break;
+		case atom_title:
+			newTag = placed(new (m_arena) litehtml::el_title(this), m_arena);
+			break;
+		case atom_a:
+			newTag = placed(new (m_arena) litehtml::el_anchor(this), m_arena);
+			break;
+		case atom_tr:
+			newTag = placed(new (m_arena) litehtml::el_tr(this), m_arena);
+			break;
+		case atom_style:
+			newTag = placed(new (m_arena) litehtml::el_style(this), m_arena);
+			break;
+		case atom_base:
+			newTag = placed(new (m_arena) litehtml::el_base(this), m_arena);
+			break;
+		case atom_body:
+			newTag = placed(new (m_arena) litehtml::el_body(this), m_arena);
+			break;
+		case atom_div:
+			newTag = placed(new (m_arena) litehtml::el_div(this), m_arena);
+			break;
+		case atom_script:
+			newTag = placed(new (m_arena) litehtml::el_script(this), m_arena);
+			break;
+		case atom_font:
+			newTag = placed(new (m_arena) litehtml::el_font(this), m_arena);
+			break;
+		default:
+			newTag = placed(new (m_arena) litehtml::html_tag(this), m_arena);
+			break;
 		}
 	}
 
@@ -672,6 +879,67 @@ void litehtml::document::begin_parse()
 	m_parse_stack.push_back(m_root);
 }
 
+void litehtml::document::end_parse(litehtml::css* user_styles)
+{
+	if(m_root)
+	{
+		apply_stylesheet(m_context->master_css());
+
+		m_root->parse_attributes();
+
+		media_query_list::ptr media;
+
+		for(css_text::vector::iterator css = m_css.begin(); css != m_css.end(); css++)
+		{
+			if(!css->media.empty())
+			{
+				media = media_query_list::create_from_string(css->media, this);
+			} else
+			{
+				media = 0;
+			}
+			m_styles.parse_stylesheet(css->text.c_str(), css->baseurl.c_str(), this, media);
+		}
+		m_styles.sort_selectors();
+
+		if(!m_media_lists.empty())
+		{
+			media_features features;
+			container()->get_media_features(features);
+			update_media_lists(features);
+		}
+
+		apply_stylesheet(m_styles);
+
+		if(user_styles)
+		{
+			apply_stylesheet(*user_styles);
+		}
+
+		m_root->parse_styles();
+		flush_text_widths();
+		m_computed_styles.clear();
+	}
+
+}
+
+void litehtml::document::apply_stylesheet( const litehtml::css& stylesheet )
+{
+	int threads = m_context->cascade_threads();
+	if(threads > 1)
+	{
+		// the workers must not add atoms
+		stylesheet.resolve_atoms(atoms());
+		m_cascade_matches.match(m_root, stylesheet, m_context->threads(), threads);
+	}
+
+	m_root->apply_stylesheet(stylesheet, ancestor_filter());
+
+	m_cascade_matches.add_stats(m_cascade_stats);
+	m_cascade_matches.clear();
+	m_style_cache.clear();
+}
+
 void litehtml::document::parse_push_element( element::ptr el )
 {
 	if(!m_parse_stack.empty())
@@ -681,15 +949,15 @@ void litehtml::document::parse_push_element( element::ptr el )
 	}
 }
 
-void litehtml::document::parse_attribute( const tchar_t* attr_name, const tchar_t* attr_value )
+void litehtml::document::parse_attribute( const tchar_t* attr_name, const tchar_t* attr_value, size_t len )
 {
 	if(!m_parse_stack.empty())
 	{
-		m_parse_stack.back()->set_attr(attr_name, attr_value);
+		m_parse_stack.back()->set_attr(attr_name, attr_value, len);
 	}
 }
 
-void litehtml::document::parse_word( const tchar_t* val )
+void litehtml::document::parse_word( const tchar_t* val, size_t len )
 {
 	if(!t_strcmp(m_parse_stack.back()->get_tagName(), _t("html")))
 	{
@@ -700,17 +968,17 @@ void litehtml::document::parse_word( const tchar_t* val )
 
 	if(!m_parse_stack.empty())
 	{
-		element::ptr el = new litehtml::el_text(val, this);
+		element::ptr el = placed(new (m_arena) litehtml::el_text(val, len, this), m_arena);
 		m_parse_stack.back()->appendChild(el);
 	}
 }
 
-void litehtml::document::parse_space(const tchar_t* val)
+void litehtml::document::parse_space( const tchar_t* val, size_t len )
 {
 	parse_pop_void_element();
 	if(!m_parse_stack.empty())
 	{
-		element::ptr el = new litehtml::el_space(val, this);
+		element::ptr el = placed(new (m_arena) litehtml::el_space(val, len, this), m_arena);
 		m_parse_stack.back()->appendChild(el);
 	}
 }
@@ -718,7 +986,7 @@ void litehtml::document::parse_space(const tchar_t* val)
 void litehtml::document::parse_comment_start()
 {
 	parse_pop_void_element();
-	parse_push_element(new litehtml::el_comment(this));
+	parse_push_element(placed(new (m_arena) litehtml::el_comment(this), m_arena));
 }
 
 void litehtml::document::parse_comment_end()
@@ -729,7 +997,7 @@ void litehtml::document::parse_comment_end()
 void litehtml::document::parse_cdata_start()
 {
 	parse_pop_void_element();
-	parse_push_element(new litehtml::el_cdata(this));
+	parse_push_element(placed(new (m_arena) litehtml::el_cdata(this), m_arena));
 }
 
 void litehtml::document::parse_cdata_end()
@@ -737,11 +1005,11 @@ void litehtml::document::parse_cdata_end()
 	parse_pop_element();
 }
 
-void litehtml::document::parse_data( const tchar_t* val )
+void litehtml::document::parse_data( const tchar_t* val, size_t len )
 {
 	if(!m_parse_stack.empty())
 	{
-		m_parse_stack.back()->set_data(val);
+		m_parse_stack.back()->set_data(val, len);
 	}
 }
 
@@ -840,6 +1108,8 @@ bool litehtml::document::media_changed()
 		{
 			m_root->refresh_styles();
 			m_root->parse_styles();
+			flush_text_widths();
+			m_computed_styles.clear();
 			return true;
 		}
 	}
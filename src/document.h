@@ -4,6 +4,9 @@
 #include "types.h"
 #include "xh_scanner.h"
 #include "context.h"
+#include "style_cache.h"
+#include "text_cache.h"
+#include "thread_pool.h"
 
 namespace litehtml
 {
@@ -53,6 +56,7 @@ namespace litehtml
 	public:
 		typedef object_ptr<document>	ptr;
 	private:
+		arena::ptr							m_arena;
 		element::ptr						m_root;
 		document_container*					m_container;
 		fonts_map							m_fonts;
@@ -60,6 +64,7 @@ namespace litehtml
 		litehtml::css						m_styles;
 		litehtml::web_color					m_def_color;
 		litehtml::context*					m_context;
+		litehtml::atom_pool					m_atoms;
 		litehtml::size						m_size;
 		static stop_tags_t 					m_stop_tags[];
 		static ommited_end_tags_t			m_ommited_end_tags[];
@@ -67,6 +72,16 @@ namespace litehtml
 		position::vector					m_fixed_boxes;
 		media_query_list::vector			m_media_lists;
 		element::ptr						m_over_element;
+		litehtml::cascade_stats				m_cascade_stats;
+		litehtml::cascade_matches			m_cascade_matches;
+		litehtml::style_cache				m_style_cache;
+		litehtml::text_cache				m_text_cache;
+		text_request::vector				m_text_queue;
+		litehtml::computed_styles			m_computed_styles;
+		int									m_layout_width;			// max_width of the last render(), -1 if unknown
+		int									m_layout_ret;
+		int									m_layout_generation;	// layouts kept by elements are valid for this value
+		bool								m_layout_tasks;			// run_layout_tasks() is running
 	public:
 		document(litehtml::document_container* objContainer, litehtml::context* ctx);
 		virtual ~document();
@@ -74,6 +89,10 @@ namespace litehtml
 		litehtml::document_container*	container()	{ return m_container; }
 		uint_ptr						get_font(const tchar_t* name, int size, const tchar_t* weight, const tchar_t* style, const tchar_t* decoration, font_metrics* fm);
 		int								render(int max_width, render_type rt = render_all);
+		int								relayout(int max_width);
+		int								layout_generation() const;
+		int								layout_threads() const;
+		void							run_layout_tasks(parallel_tasks& tasks, int count);
 		void							draw(uint_ptr hdc, int x, int y, const position* clip);
 		web_color						get_def_color()	{ return m_def_color; }
 		int								cvt_units(const tchar_t* str, int fontSize, bool* is_percent = 0) const;
@@ -86,11 +105,20 @@ namespace litehtml
 		bool							on_lbutton_up(int x, int y, int client_x, int client_y, position::vector& redraw_boxes);
 		bool							on_mouse_leave(position::vector& redraw_boxes);
 		litehtml::element::ptr			create_element(const tchar_t* tag_name);
+		litehtml::atom_pool&			atoms();
+		litehtml::arena*				get_arena();
 		element::ptr					root();
 		void							get_fixed_boxes(position::vector& fixed_boxes);
 		void							add_fixed_box(const position& pos);
 		void							add_media_list(media_query_list::ptr list);
 		bool							media_changed();
+		litehtml::cascade_stats&		get_cascade_stats();
+		bool							take_matches(const element* el, const selector_match*& matches, int& count);
+		litehtml::style_cache&			get_style_cache();
+		litehtml::text_cache&			get_text_cache();
+		void							queue_text_width(object* owner, const tchar_t* text, uint_ptr hFont, int* width);
+		void							flush_text_widths();
+		litehtml::computed_styles&		get_computed_styles();
 
 		static litehtml::document::ptr createFromString(const tchar_t* str, litehtml::document_container* objPainter, litehtml::context* ctx, litehtml::css* user_styles = 0);
 		static litehtml::document::ptr createFromUTF8(const byte* str, litehtml::document_container* objPainter, litehtml::context* ctx, litehtml::css* user_styles = 0);
@@ -102,18 +130,24 @@ namespace litehtml
 		litehtml::element*	add_body();
 		litehtml::uint_ptr	add_font(const tchar_t* name, int size, const tchar_t* weight, const tchar_t* style, const tchar_t* decoration, font_metrics* fm);
 
+		template<class scanner_type> void parse(scanner_type& sc);
 		void begin_parse();
+		void end_parse(litehtml::css* user_styles);
+		void apply_stylesheet(const litehtml::css& stylesheet);
+		int layout(int max_width, render_type rt);
+		void prelayout(int max_width);
+		bool restyle(litehtml::element* subtree, position::vector& redraw_boxes);
 
 		void parse_tag_start(const tchar_t* tag_name);
 		void parse_tag_end(const tchar_t* tag_name);
-		void parse_attribute(const tchar_t* attr_name, const tchar_t* attr_value);
-		void parse_word(const tchar_t* val);
-		void parse_space(const tchar_t* val);
+		void parse_attribute(const tchar_t* attr_name, const tchar_t* attr_value, size_t len);
+		void parse_word(const tchar_t* val, size_t len);
+		void parse_space(const tchar_t* val, size_t len);
 		void parse_comment_start();
 		void parse_comment_end();
 		void parse_cdata_start();
 		void parse_cdata_end();
-		void parse_data(const tchar_t* val);
+		void parse_data(const tchar_t* val, size_t len);
 		void parse_push_element(element::ptr el);
 		bool parse_pop_element();
 		bool parse_pop_element(const tchar_t* tag, const tchar_t* stop_tags = _t(""));
@@ -128,4 +162,51 @@ namespace litehtml
 	{
 		return m_root;
 	}
+
+	inline litehtml::cascade_stats& document::get_cascade_stats()
+	{
+		return m_cascade_stats;
+	}
+
+	inline bool document::take_matches(const element* el, const selector_match*& matches, int& count)
+	{
+		return m_cascade_matches.take(el, matches, count);
+	}
+
+	inline litehtml::style_cache& document::get_style_cache()
+	{
+		return m_style_cache;
+	}
+
+	inline litehtml::text_cache& document::get_text_cache()
+	{
+		return m_text_cache;
+	}
+
+	inline litehtml::computed_styles& document::get_computed_styles()
+	{
+		return m_computed_styles;
+	}
+
+	inline int document::layout_generation() const
+	{
+		return m_layout_generation;
+	}
+
+	// threads for run_layout_tasks(), 1 if the elements must be laid out
+	// serially: the arena is not shared and tasks run no tasks of their own
+	inline int document::layout_threads() const
+	{
+		return (m_arena || m_layout_tasks) ? 1 : m_context->layout_threads();
+	}
+
+	inline litehtml::atom_pool& document::atoms()
+	{
+		return m_atoms;
+	}
+
+	inline litehtml::arena* document::get_arena()
+	{
+		return m_arena;
+	}
 }
@@ -13,7 +13,7 @@ litehtml::el_anchor::~el_anchor()
 
 void litehtml::el_anchor::on_click()
 {
-	const tchar_t* href = get_attr(_t("href"));
+	const tchar_t* href = get_attr(atom_href);
 
 	if(href)
 	{
@@ -21,11 +21,11 @@ void litehtml::el_anchor::on_click()
 	}
 }
 
-void litehtml::el_anchor::apply_stylesheet( const litehtml::css& stylesheet )
+void litehtml::el_anchor::apply_stylesheet( const litehtml::css& stylesheet, const ancestor_filter& parents )
 {
-	if( get_attr(_t("href")) )
+	if( get_attr(atom_href) )
 	{
 		m_pseudo_classes.push_back(_t("link"));
 	}
-	html_tag::apply_stylesheet(stylesheet);
+	html_tag::apply_stylesheet(stylesheet, parents);
 }
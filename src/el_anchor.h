@@ -10,6 +10,6 @@ namespace litehtml
 		virtual ~el_anchor();
 
 		virtual void	on_click();
-		virtual void	apply_stylesheet(const litehtml::css& stylesheet);
+		virtual void	apply_stylesheet(const litehtml::css& stylesheet, const ancestor_filter& parents);
 	};
 }
\ No newline at end of file
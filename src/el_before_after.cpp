@@ -3,6 +3,7 @@
 #include "el_text.h"
 #include "el_space.h"
 #include "el_image.h"
+#include "document.h"
 
 litehtml::el_before_after_base::el_before_after_base( litehtml::document* doc, bool before ) : html_tag(doc)
 {
@@ -24,10 +25,10 @@ void litehtml::el_before_after_base::add_style( litehtml::style::ptr st )
 {
 	html_tag::add_style(st);
 
-	tstring content = get_style_property(_t("content"), false, _t(""));
+	tstring content = get_style_property(prop_content, false, _t(""));
 	if(!content.empty())
 	{
-		int idx = value_index(content.c_str(), content_property_string);
+		int idx = keyword_index(content_property_keywords, content.c_str());
 		if(idx < 0)
 		{
 			tstring fnc;
@@ -80,6 +81,7 @@ void litehtml::el_before_after_base::add_style( litehtml::style::ptr st )
 
 void litehtml::el_before_after_base::add_text( const tstring& txt )
 {
+	arena* owner = m_doc->get_arena();
 	tstring word;
 	tstring esc;
 	for(tstring::size_type i = 0; i < txt.length(); i++)
@@ -90,12 +92,12 @@ void litehtml::el_before_after_base::add_text( const tstring& txt )
 			{
 				if(!word.empty())
 				{
-					element* el = new el_text(word.c_str(), m_doc);
+					element* el = placed(new (owner) el_text(word.c_str(), m_doc), owner);
 					appendChild(el);
 					word.clear();
 				}
 
-				element* el = new el_space(txt.substr(i, 1).c_str(), m_doc);
+				element* el = placed(new (owner) el_space(txt.substr(i, 1).c_str(), m_doc), owner);
 				appendChild(el);
 			} else
 			{
@@ -124,7 +126,7 @@ void litehtml::el_before_after_base::add_text( const tstring& txt )
 	}
 	if(!word.empty())
 	{
-		element* el = new el_text(word.c_str(), m_doc);
+		element* el = placed(new (owner) el_text(word.c_str(), m_doc), owner);
 		appendChild(el);
 		word.clear();
 	}
@@ -172,7 +174,8 @@ void litehtml::el_before_after_base::add_function( const tstring& fnc, const tst
 			}
 			if(!p_url.empty())
 			{
-				element* el = new el_image(m_doc);
+				arena* owner = m_doc->get_arena();
+				element* el = placed(new (owner) el_image(m_doc), owner);
 				el->set_attr(_t("src"), p_url.c_str());
 				el->set_attr(_t("style"), _t("display:inline-block"));
 				el->set_tagName(_t("img"));
@@ -190,7 +193,12 @@ litehtml::tchar_t litehtml::el_before_after_base::convert_escape( const tchar_t*
 	return (tchar_t) t_strtol(txt, &sss, 16);
 }
 
-void litehtml::el_before_after_base::apply_stylesheet( const litehtml::css& stylesheet )
+void litehtml::el_before_after_base::apply_stylesheet( const litehtml::css& stylesheet, const ancestor_filter& parents )
+{
+
+}
+
+void litehtml::el_before_after_base::match_stylesheet( const litehtml::css& stylesheet, const ancestor_filter& parents, cascade_task& task, bool subtree )
 {
 
 }
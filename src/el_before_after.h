@@ -10,7 +10,8 @@ namespace litehtml
 		virtual ~el_before_after_base();
 
 		virtual void add_style(litehtml::style::ptr st);
-		virtual void apply_stylesheet(const litehtml::css& stylesheet);
+		virtual void apply_stylesheet(const litehtml::css& stylesheet, const ancestor_filter& parents);
+		virtual void match_stylesheet(const litehtml::css& stylesheet, const ancestor_filter& parents, cascade_task& task, bool subtree);
 	private:
 		void	add_text(const tstring& txt);
 		void	add_function(const tstring& fnc, const tstring& params);
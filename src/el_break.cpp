@@ -18,7 +18,7 @@ bool litehtml::el_break::is_break() const
 
 void litehtml::el_break::parse_attributes()
 {
-	const tchar_t* attr_clear = get_attr(_t("clear"));
+	const tchar_t* attr_clear = get_attr(atom_clear);
 	if(attr_clear)
 	{
 		m_style.add_property(_t("clear"), attr_clear, 0, false);
@@ -16,10 +16,10 @@ void litehtml::el_cdata::get_text( tstring& text )
 	text += m_text;
 }
 
-void litehtml::el_cdata::set_data( const tchar_t* data )
+void litehtml::el_cdata::set_data( const tchar_t* data, size_t len )
 {
 	if(data)
 	{
-		m_text += data;
+		m_text.append(data, len);
 	}
 }
@@ -11,6 +11,6 @@ namespace litehtml
 		virtual ~el_cdata();
 
 		virtual void	get_text(tstring& text);
-		virtual void	set_data(const tchar_t* data);
+		virtual void	set_data(const tchar_t* data, size_t len);
 	};
 }
@@ -14,7 +14,7 @@ litehtml::el_div::~el_div()
 
 void litehtml::el_div::parse_attributes()
 {
-	const tchar_t* str = get_attr(_t("align"));
+	const tchar_t* str = get_attr(atom_align);
 	if(str)
 	{
 		m_style.add_property(_t("text-align"), str, 0, false);
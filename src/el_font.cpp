@@ -14,19 +14,19 @@ litehtml::el_font::~el_font()
 
 void litehtml::el_font::parse_attributes()
 {
-	const tchar_t* str = get_attr(_t("color"));
+	const tchar_t* str = get_attr(atom_color);
 	if(str)
 	{
 		m_style.add_property(_t("color"), str, 0, false);
 	}
 
-	str = get_attr(_t("face"));
+	str = get_attr(atom_face);
 	if(str)
 	{
 		m_style.add_property(_t("font-face"), str, 0, false);
 	}
 
-	str = get_attr(_t("size"));
+	str = get_attr(atom_size);
 	if(str)
 	{
 		int sz = t_atoi(str);
@@ -29,11 +29,13 @@ bool litehtml::el_image::is_replaced() const
 
 int litehtml::el_image::render( int x, int y, int max_width, bool second_pass )
 {
+	m_dirty = 0;
+
 	int parent_width = max_width;
 
 	// restore margins after collapse
-	m_margins.top		= m_doc->cvt_units(m_css_margins.top,		m_font_size);
-	m_margins.bottom	= m_doc->cvt_units(m_css_margins.bottom,	m_font_size);
+	m_margins.top		= m_doc->cvt_units(m_css_box->margins.top,		m_css_text->font_size);
+	m_margins.bottom	= m_doc->cvt_units(m_css_box->margins.bottom,	m_css_text->font_size);
 
 	m_pos.move_to(x, y);
 
@@ -43,15 +45,15 @@ int litehtml::el_image::render( int x, int y, int max_width, bool second_pass )
 	m_pos.width		= sz.width;
 	m_pos.height	= sz.height;
 
-	if(m_css_height.is_predefined() && m_css_width.is_predefined())
+	if(m_css_box->height.is_predefined() && m_css_box->width.is_predefined())
 	{
 		m_pos.height	= sz.height;
 		m_pos.width		= sz.width;
 
 		// check for max-height
-		if(!m_css_max_width.is_predefined())
+		if(!m_css_box->max_width.is_predefined())
 		{
-			int max_width = m_doc->cvt_units(m_css_max_width, m_font_size, parent_width);
+			int max_width = m_doc->cvt_units(m_css_box->max_width, m_css_text->font_size, parent_width);
 			if(m_pos.width > max_width)
 			{
 				m_pos.width = max_width;
@@ -66,9 +68,9 @@ int litehtml::el_image::render( int x, int y, int max_width, bool second_pass )
 		}
 
 		// check for max-height
-		if(!m_css_max_height.is_predefined())
+		if(!m_css_box->max_height.is_predefined())
 		{
-			int max_height = m_doc->cvt_units(m_css_max_height, m_font_size);
+			int max_height = m_doc->cvt_units(m_css_box->max_height, m_css_text->font_size);
 			if(m_pos.height > max_height)
 			{
 				m_pos.height = max_height;
@@ -81,14 +83,14 @@ int litehtml::el_image::render( int x, int y, int max_width, bool second_pass )
 				m_pos.width = sz.width;
 			}
 		}
-	} else if(!m_css_height.is_predefined() && m_css_width.is_predefined())
+	} else if(!m_css_box->height.is_predefined() && m_css_box->width.is_predefined())
 	{
-		m_pos.height = (int) m_css_height.val();
+		m_pos.height = (int) m_css_box->height.val();
 
 		// check for max-height
-		if(!m_css_max_height.is_predefined())
+		if(!m_css_box->max_height.is_predefined())
 		{
-			int max_height = m_doc->cvt_units(m_css_max_height, m_font_size);
+			int max_height = m_doc->cvt_units(m_css_box->max_height, m_css_text->font_size);
 			if(m_pos.height > max_height)
 			{
 				m_pos.height = max_height;
@@ -102,14 +104,14 @@ int litehtml::el_image::render( int x, int y, int max_width, bool second_pass )
 		{
 			m_pos.width = sz.width;
 		}
-	} else if(m_css_height.is_predefined() && !m_css_width.is_predefined())
+	} else if(m_css_box->height.is_predefined() && !m_css_box->width.is_predefined())
 	{
-		m_pos.width = (int) m_css_width.calc_percent(parent_width);
+		m_pos.width = (int) m_css_box->width.calc_percent(parent_width);
 
 		// check for max-width
-		if(!m_css_max_width.is_predefined())
+		if(!m_css_box->max_width.is_predefined())
 		{
-			int max_width = m_doc->cvt_units(m_css_max_width, m_font_size, parent_width);
+			int max_width = m_doc->cvt_units(m_css_box->max_width, m_css_text->font_size, parent_width);
 			if(m_pos.width > max_width)
 			{
 				m_pos.width = max_width;
@@ -125,13 +127,13 @@ int litehtml::el_image::render( int x, int y, int max_width, bool second_pass )
 		}
 	} else
 	{
-		m_pos.width		= (int) m_css_width.calc_percent(parent_width);
-		m_pos.height	= (int) m_css_height.val();
+		m_pos.width		= (int) m_css_box->width.calc_percent(parent_width);
+		m_pos.height	= (int) m_css_box->height.val();
 
 		// check for max-height
-		if(!m_css_max_height.is_predefined())
+		if(!m_css_box->max_height.is_predefined())
 		{
-			int max_height = m_doc->cvt_units(m_css_max_height, m_font_size);
+			int max_height = m_doc->cvt_units(m_css_box->max_height, m_css_text->font_size);
 			if(m_pos.height > max_height)
 			{
 				m_pos.height = max_height;
@@ -139,9 +141,9 @@ int litehtml::el_image::render( int x, int y, int max_width, bool second_pass )
 		}
 
 		// check for max-height
-		if(!m_css_max_width.is_predefined())
+		if(!m_css_box->max_width.is_predefined())
 		{
-			int max_width = m_doc->cvt_units(m_css_max_width, m_font_size, parent_width);
+			int max_width = m_doc->cvt_units(m_css_box->max_width, m_css_text->font_size, parent_width);
 			if(m_pos.width > max_width)
 			{
 				m_pos.width = max_width;
@@ -159,14 +161,14 @@ int litehtml::el_image::render( int x, int y, int max_width, bool second_pass )
 
 void litehtml::el_image::parse_attributes()
 {
-	m_src = get_attr(_t("src"), _t(""));
+	m_src = get_attr(atom_src, _t(""));
 
-	const tchar_t* attr_height = get_attr(_t("height"));
+	const tchar_t* attr_height = get_attr(atom_height);
 	if(attr_height)
 	{
 		m_style.add_property(_t("height"), attr_height, 0, false);
 	}
-	const tchar_t* attr_width = get_attr(_t("width"));
+	const tchar_t* attr_width = get_attr(atom_width);
 	if(attr_width)
 	{
 		m_style.add_property(_t("width"), attr_width, 0, false);
@@ -193,7 +195,7 @@ void litehtml::el_image::draw( uint_ptr hdc, int x, int y, const position* clip
 		bg.repeat				= background_repeat_no_repeat;
 		bg.image_size.width		= pos.width;
 		bg.image_size.height	= pos.height;
-		bg.border_radius		= m_css_borders.radius;
+		bg.border_radius		= m_css_border->borders.radius;
 		bg.position_x			= pos.x;
 		bg.position_y			= pos.y;
 		m_doc->container()->draw_background(hdc, bg);
@@ -206,7 +208,7 @@ void litehtml::el_image::parse_styles( bool is_reparse /*= false*/ )
 
 	if(!m_src.empty())
 	{
-		if(!m_css_height.is_predefined() && !m_css_width.is_predefined())
+		if(!m_css_box->height.is_predefined() && !m_css_box->width.is_predefined())
 		{
 			m_doc->container()->load_image(m_src.c_str(), 0, true);
 		} else
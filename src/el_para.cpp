@@ -13,7 +13,7 @@ litehtml::el_para::~el_para()
 
 void litehtml::el_para::parse_attributes()
 {
-	const tchar_t* str = get_attr(_t("align"));
+	const tchar_t* str = get_attr(atom_align);
 	if(str)
 	{
 		m_style.add_property(_t("text-align"), str, 0, false);
@@ -6,6 +6,10 @@ litehtml::el_space::el_space( const tchar_t* text, litehtml::document* doc ) : e
 {
 }
 
+litehtml::el_space::el_space( const tchar_t* text, size_t len, litehtml::document* doc ) : el_text(text, len, doc)
+{
+}
+
 litehtml::el_space::~el_space()
 {
 
@@ -8,6 +8,7 @@ namespace litehtml
 	{
 	public:
 		el_space(const tchar_t* text, litehtml::document* doc);
+		el_space(const tchar_t* text, size_t len, litehtml::document* doc);
 		virtual ~el_space();
 
 		virtual bool	is_white_space();
@@ -10,6 +10,8 @@ litehtml::el_table::el_table( litehtml::document* doc ) : html_tag(doc)
 	m_border_spacing_x	= 0;
 	m_border_spacing_y	= 0;
 	m_border_collapse	= border_collapse_separate;
+	m_table_layout		= table_layout_auto;
+	m_measuring			= false;
 }
 
 
@@ -18,16 +20,51 @@ litehtml::el_table::~el_table()
 
 }
 
+namespace
+{
+	// The text of a cell that was not changed measures as it did at
+	// measured_width, and at any greater max_width if it was one line
+	bool keep_measure(litehtml::table_cell* cell, int max_width)
+	{
+		if(	cell->measured_width < 0 ||
+			cell->el->need_layout() ||
+			(max_width != cell->measured_width && (!cell->measured_line || !cell->measured_width || max_width < cell->measured_width)))
+		{
+			return false;
+		}
+		cell->measure_kept = true;
+		return true;
+	}
+
+	class cell_measure_runner : public litehtml::parallel_tasks
+	{
+		litehtml::el_table&					m_table;
+		std::vector<litehtml::cell_measure>&	m_measures;
+	public:
+		cell_measure_runner(litehtml::el_table& table, std::vector<litehtml::cell_measure>& measures)
+			: m_table(table), m_measures(measures)
+		{
+		}
+
+		virtual void run_task(int task)
+		{
+			m_table.measure_cell(m_measures[task]);
+		}
+	};
+}
+
 int litehtml::el_table::render( int x, int y, int max_width, bool second_pass )
 {
+	m_dirty = 0;
+
 	int parent_width = max_width;
 
 	// reset auto margins
-	if(m_css_margins.left.is_predefined())
+	if(m_css_box->margins.left.is_predefined())
 	{
 		m_margins.left = 0;
 	}
-	if(m_css_margins.right.is_predefined())
+	if(m_css_box->margins.right.is_predefined())
 	{
 		m_margins.right = 0;
 	}
@@ -40,7 +77,7 @@ int litehtml::el_table::render( int x, int y, int max_width, bool second_pass )
 
 	def_value<int>	block_width(0);
 	
-	if(!m_css_width.is_predefined())
+	if(!m_css_box->width.is_predefined())
 	{
 		max_width = block_width = calc_width(parent_width - (content_margins_left() + content_margins_right()));
 	} else
@@ -75,116 +112,35 @@ int litehtml::el_table::render( int x, int y, int max_width, bool second_pass )
 	}
 
 
-	// Calculate the minimum content width (MCW) of each cell: the formatted content may span any number of lines but may not overflow the cell box. 
-	// If the specified 'width' (W) of the cell is greater than MCW, W is the minimum cell width. A value of 'auto' means that MCW is the minimum 
-	// cell width.
-	// 
-	// Also, calculate the "maximum" cell width of each cell: formatting the content without breaking lines other than where explicit line breaks occur.
+	int table_width = 0;
+	bool fixed_layout = (m_table_layout == table_layout_fixed && !block_width.is_default());
 
-	if(m_grid.cols_count() == 1 && !block_width.is_default())
+	if(fixed_layout)
 	{
-		for(int row = 0; row < m_grid.rows_count(); row++)
-		{
-			table_cell* cell = m_grid.cell(0, row);
-			if(cell && cell->el)
-			{
-				cell->min_width = cell->max_width = cell->el->render(0, 0, max_width - table_width_spacing);
-				cell->el->m_pos.width = cell->min_width - cell->el->content_margins_left() - cell->el->content_margins_right();
-			}
-		}
+		// the contents of the cells don't change the columns, the cells
+		// are only rendered at the widths of their columns below
+		table_width = m_grid.calc_fixed_table_width(block_width - table_width_spacing);
 	} else
 	{
-		for(int row = 0; row < m_grid.rows_count(); row++)
-		{
-			for(int col = 0; col < m_grid.cols_count(); col++)
-			{
-				table_cell* cell = m_grid.cell(col, row);
-				if(cell && cell->el)
-				{
-					if(!m_grid.column(col).css_width.is_predefined() && m_grid.column(col).css_width.units() != css_units_percentage)
-					{
-						int css_w = m_grid.column(col).css_width.calc_percent(block_width);
-						int el_w = cell->el->render(0, 0, css_w);
-						cell->min_width = cell->max_width = std::max(css_w, el_w);
-						cell->el->m_pos.width = cell->min_width - cell->el->content_margins_left() - cell->el->content_margins_right();
-					} else
-					{
-						// calculate minimum content width
-						cell->min_width = cell->el->render(0, 0, 1);
-						// calculate maximum content width
-						cell->max_width = cell->el->render(0, 0, max_width - table_width_spacing);
-					}
-				}
-			}
-		}
-	}
+		measure_columns(block_width, max_width - table_width_spacing);
 
-	// For each column, determine a maximum and minimum column width from the cells that span only that column. 
-	// The minimum is that required by the cell with the largest minimum cell width (or the column 'width', whichever is larger). 
-	// The maximum is that required by the cell with the largest maximum cell width (or the column 'width', whichever is larger).
+		// If the 'table' or 'inline-table' element's 'width' property has a computed value (W) other than 'auto', the used width is the 
+		// greater of W, CAPMIN, and the minimum width required by all the columns plus cell spacing or borders (MIN). 
+		// If the used width is greater than MIN, the extra width should be distributed over the columns.
+		//
+		// If the 'table' or 'inline-table' element has 'width: auto', the used width is the greater of the table's containing block width, 
+		// CAPMIN, and MIN. However, if either CAPMIN or the maximum width required by the columns plus cell spacing or borders (MAX) is 
+		// less than that of the containing block, use max(MAX, CAPMIN).
 
-	for(int col = 0; col < m_grid.cols_count(); col++)
-	{
-		m_grid.column(col).max_width = 0;
-		m_grid.column(col).min_width = 0;
-		for(int row = 0; row < m_grid.rows_count(); row++)
+		if(!block_width.is_default())
 		{
-			if(m_grid.cell(col, row)->colspan <= 1)
-			{
-				m_grid.column(col).max_width = std::max(m_grid.column(col).max_width, m_grid.cell(col, row)->max_width);
-				m_grid.column(col).min_width = std::max(m_grid.column(col).min_width, m_grid.cell(col, row)->min_width);
-			}
-		}
-	}
-
-	// For each cell that spans more than one column, increase the minimum widths of the columns it spans so that together, 
-	// they are at least as wide as the cell. Do the same for the maximum widths. 
-	// If possible, widen all spanned columns by approximately the same amount.
-
-	for(int col = 0; col < m_grid.cols_count(); col++)
-	{
-		for(int row = 0; row < m_grid.rows_count(); row++)
+			table_width = m_grid.calc_table_width(block_width - table_width_spacing, false);
+		} else
 		{
-			if(m_grid.cell(col, row)->colspan > 1)
-			{
-				int max_total_width = m_grid.column(col).max_width;
-				int min_total_width = m_grid.column(col).min_width;
-				for(int col2 = col + 1; col2 < col + m_grid.cell(col, row)->colspan; col2++)
-				{
-					max_total_width += m_grid.column(col2).max_width;
-					min_total_width += m_grid.column(col2).min_width;
-				}
-				if(min_total_width < m_grid.cell(col, row)->min_width)
-				{
-					m_grid.distribute_min_width(m_grid.cell(col, row)->min_width - min_total_width, col, col + m_grid.cell(col, row)->colspan - 1);
-				}
-				if(max_total_width < m_grid.cell(col, row)->max_width)
-				{
-					m_grid.distribute_max_width(m_grid.cell(col, row)->max_width - max_total_width, col, col + m_grid.cell(col, row)->colspan - 1);
-				}
-			}
+			table_width = m_grid.calc_table_width(max_width - table_width_spacing, true);
 		}
 	}
 
-	// If the 'table' or 'inline-table' element's 'width' property has a computed value (W) other than 'auto', the used width is the 
-	// greater of W, CAPMIN, and the minimum width required by all the columns plus cell spacing or borders (MIN). 
-	// If the used width is greater than MIN, the extra width should be distributed over the columns.
-	//
-	// If the 'table' or 'inline-table' element has 'width: auto', the used width is the greater of the table's containing block width, 
-	// CAPMIN, and MIN. However, if either CAPMIN or the maximum width required by the columns plus cell spacing or borders (MAX) is 
-	// less than that of the containing block, use max(MAX, CAPMIN).
-
-
-	int table_width = 0;
-
-	if(!block_width.is_default())
-	{
-		table_width = m_grid.calc_table_width(block_width - table_width_spacing, false);
-	} else
-	{
-		table_width = m_grid.calc_table_width(max_width - table_width_spacing, true);
-	}
-
 	table_width += table_width_spacing;
 	m_grid.calc_horizontal_positions(m_borders, m_border_collapse, m_border_spacing_x);
 	
@@ -206,7 +162,7 @@ int litehtml::el_table::render( int x, int y, int max_width, bool second_pass )
 				}
 				int cell_width = m_grid.column(span_col).right - m_grid.column(col).left;
 				
-				if(cell->el->m_pos.width != cell_width - cell->el->content_margins_left() - cell->el->content_margins_right())
+				if(fixed_layout || cell->measure_kept || cell->el->m_pos.width != cell_width - cell->el->content_margins_left() - cell->el->content_margins_right())
 				{
 					cell->el->render(m_grid.column(col).left, 0, cell_width);
 					cell->el->m_pos.width = cell_width - cell->el->content_margins_left() - cell->el->content_margins_right();
@@ -306,6 +262,98 @@ int litehtml::el_table::render( int x, int y, int max_width, bool second_pass )
 	return table_width;
 }
 
+void litehtml::el_table::measure_columns( def_value<int>& block_width, int max_width )
+{
+	// Calculate the minimum content width (MCW) of each cell: the formatted content may span any number of lines but may not overflow the cell box. 
+	// If the specified 'width' (W) of the cell is greater than MCW, W is the minimum cell width. A value of 'auto' means that MCW is the minimum 
+	// cell width.
+	// 
+	// Also, calculate the "maximum" cell width of each cell: formatting the content without breaking lines other than where explicit line breaks occur.
+
+	std::vector<cell_measure> measures;
+	if(m_grid.cols_count() == 1 && !block_width.is_default())
+	{
+		for(int row = 0; row < m_grid.rows_count(); row++)
+		{
+			table_cell* cell = m_grid.cell(0, row);
+			if(cell && cell->el)
+			{
+				cell_measure measure = { cell, cell_measure_table, max_width };
+				measures.push_back(measure);
+			}
+		}
+	} else
+	{
+		for(int row = 0; row < m_grid.rows_count(); row++)
+		{
+			for(int col = 0; col < m_grid.cols_count(); col++)
+			{
+				table_cell* cell = m_grid.cell(col, row);
+				if(cell && cell->el)
+				{
+					if(!m_grid.column(col).css_width.is_predefined() && m_grid.column(col).css_width.units() != css_units_percentage)
+					{
+						cell_measure measure = { cell, cell_measure_column, m_grid.column(col).css_width.calc_percent(block_width) };
+						measures.push_back(measure);
+					} else if(!keep_measure(cell, max_width))
+					{
+						cell_measure measure = { cell, cell_measure_content, max_width };
+						measures.push_back(measure);
+					}
+				}
+			}
+		}
+	}
+	measure_cells(measures);
+
+	// For each column, determine a maximum and minimum column width from the cells that span only that column. 
+	// The minimum is that required by the cell with the largest minimum cell width (or the column 'width', whichever is larger). 
+	// The maximum is that required by the cell with the largest maximum cell width (or the column 'width', whichever is larger).
+
+	for(int col = 0; col < m_grid.cols_count(); col++)
+	{
+		m_grid.column(col).max_width = 0;
+		m_grid.column(col).min_width = 0;
+		for(int row = 0; row < m_grid.rows_count(); row++)
+		{
+			if(m_grid.cell(col, row)->colspan <= 1)
+			{
+				m_grid.column(col).max_width = std::max(m_grid.column(col).max_width, m_grid.cell(col, row)->max_width);
+				m_grid.column(col).min_width = std::max(m_grid.column(col).min_width, m_grid.cell(col, row)->min_width);
+			}
+		}
+	}
+
+	// For each cell that spans more than one column, increase the minimum widths of the columns it spans so that together, 
+	// they are at least as wide as the cell. Do the same for the maximum widths. 
+	// If possible, widen all spanned columns by approximately the same amount.
+
+	for(int col = 0; col < m_grid.cols_count(); col++)
+	{
+		for(int row = 0; row < m_grid.rows_count(); row++)
+		{
+			if(m_grid.cell(col, row)->colspan > 1)
+			{
+				int max_total_width = m_grid.column(col).max_width;
+				int min_total_width = m_grid.column(col).min_width;
+				for(int col2 = col + 1; col2 < col + m_grid.cell(col, row)->colspan; col2++)
+				{
+					max_total_width += m_grid.column(col2).max_width;
+					min_total_width += m_grid.column(col2).min_width;
+				}
+				if(min_total_width < m_grid.cell(col, row)->min_width)
+				{
+					m_grid.distribute_min_width(m_grid.cell(col, row)->min_width - min_total_width, col, col + m_grid.cell(col, row)->colspan - 1);
+				}
+				if(max_total_width < m_grid.cell(col, row)->max_width)
+				{
+					m_grid.distribute_max_width(m_grid.cell(col, row)->max_width - max_total_width, col, col + m_grid.cell(col, row)->colspan - 1);
+				}
+			}
+		}
+	}
+}
+
 bool litehtml::el_table::appendChild( litehtml::element* el )
 {
 	if(!el)	return false;
@@ -318,14 +366,23 @@ bool litehtml::el_table::appendChild( litehtml::element* el )
 
 void litehtml::el_table::parse_styles(bool is_reparse)
 {
+	// init() builds a new grid, it has to be laid out again
+	bool restyled = (m_dirty & dirty_style) != 0;
+
 	html_tag::parse_styles(is_reparse);
 
-	m_border_collapse = (border_collapse) value_index(get_style_property(_t("border-collapse"), true, _t("separate")), border_collapse_strings, border_collapse_separate);
+	if(restyled)
+	{
+		set_layout_dirty();
+	}
+
+	m_border_collapse	= (border_collapse) get_style_keyword(prop_border_collapse, true, border_collapse_separate);
+	m_table_layout		= (table_layout) get_style_keyword(prop_table_layout, false, table_layout_auto);
 
 	if(m_border_collapse == border_collapse_separate)
 	{
-		m_css_border_spacing_x.fromString(get_style_property(_t("-litehtml-border-spacing-x"), true, _t("0px")));
-		m_css_border_spacing_y.fromString(get_style_property(_t("-litehtml-border-spacing-y"), true, _t("0px")));
+		m_css_border_spacing_x	= get_style_length(prop_litehtml_border_spacing_x, true);
+		m_css_border_spacing_y	= get_style_length(prop_litehtml_border_spacing_y, true);
 
 		int fntsz = get_font_size();
 		m_border_spacing_x = m_doc->cvt_units(m_css_border_spacing_x, fntsz);
@@ -338,10 +395,11 @@ void litehtml::el_table::parse_styles(bool is_reparse)
 		m_padding.top		= 0;
 		m_padding.left		= 0;
 		m_padding.right		= 0;
-		m_css_padding.bottom.set_value(0, css_units_px);
-		m_css_padding.top.set_value(0, css_units_px);
-		m_css_padding.left.set_value(0, css_units_px);
-		m_css_padding.right.set_value(0, css_units_px);
+		computed_box* box = write_group(m_css_box);
+		box->padding.bottom.set_value(0, css_units_px);
+		box->padding.top.set_value(0, css_units_px);
+		box->padding.left.set_value(0, css_units_px);
+		box->padding.right.set_value(0, css_units_px);
 	}
 }
 
@@ -374,6 +432,88 @@ void litehtml::el_table::init()
 	m_grid.finish();
 }
 
+void litehtml::el_table::find_prelayout( elements_vector& els )
+{
+	// the table keeps no layout, the blocks in its cells do
+	if(m_display != display_none)
+	{
+		for(elements_vector::iterator i = m_children.begin(); i != m_children.end(); i++)
+		{
+			(*i)->find_prelayout(els);
+		}
+	}
+}
+
+// Each cell is a subtree of its own, so the cells are measured on the
+// layout threads. The columns take the results in the grid order later,
+// the same ones as without threads.
+void litehtml::el_table::measure_cells( std::vector<cell_measure>& measures )
+{
+	if(measures.size() > 1 && m_doc->layout_threads() > 1)
+	{
+		m_measuring = true;
+		cell_measure_runner runner(*this, measures);
+		m_doc->run_layout_tasks(runner, (int) measures.size());
+		m_measuring = false;
+
+		// the cells could not tell whether they changed the holders around
+		html_tag::unstable_layout();
+	} else
+	{
+		for(size_t i = 0; i < measures.size(); i++)
+		{
+			measure_cell(measures[i]);
+		}
+	}
+}
+
+void litehtml::el_table::measure_cell( const cell_measure& measure )
+{
+	table_cell* cell = measure.cell;
+	cell->measure_kept		= false;
+	cell->measured_width	= -1;
+
+	switch(measure.type)
+	{
+	case cell_measure_table:
+		cell->min_width = cell->max_width = cell->el->render(0, 0, measure.max_width);
+		cell->el->m_pos.width = cell->min_width - cell->el->content_margins_left() - cell->el->content_margins_right();
+		break;
+	case cell_measure_column:
+		{
+			int el_w = cell->el->render(0, 0, measure.max_width);
+			cell->min_width = cell->max_width = std::max(measure.max_width, el_w);
+			cell->el->m_pos.width = cell->min_width - cell->el->content_margins_left() - cell->el->content_margins_right();
+		}
+		break;
+	case cell_measure_content:
+		{
+			// calculate minimum content width
+			cell->min_width = cell->el->render(0, 0, 1);
+			// calculate maximum content width
+			cell->max_width = cell->el->render(0, 0, measure.max_width);
+
+			int lines = cell->el->text_lines();
+			if(lines >= 0)
+			{
+				cell->measured_width	= measure.max_width;
+				cell->measured_line		= (lines <= 1);
+			}
+		}
+		break;
+	}
+}
+
+// The holders around the table are shared by the layout threads, while
+// the cells are measured measure_cells() changes them instead.
+void litehtml::el_table::unstable_layout()
+{
+	if(!m_measuring)
+	{
+		html_tag::unstable_layout();
+	}
+}
+
 void litehtml::el_table::draw_children( uint_ptr hdc, int x, int y, const position* clip, draw_flag flag, int zindex )
 {
 	position pos = m_pos;
@@ -402,13 +542,13 @@ void litehtml::el_table::draw_children( uint_ptr hdc, int x, int y, const positi
 
 void litehtml::el_table::parse_attributes()
 {
-	const tchar_t* str = get_attr(_t("width"));
+	const tchar_t* str = get_attr(atom_width);
 	if(str)
 	{
 		m_style.add_property(_t("width"), str, 0, false);
 	}
 
-	str = get_attr(_t("align"));
+	str = get_attr(atom_align);
 	if(str)
 	{
 		int align = value_index(str, _t("left;center;right"));
@@ -425,7 +565,7 @@ void litehtml::el_table::parse_attributes()
 		}
 	}
 
-	str = get_attr(_t("cellspacing"));
+	str = get_attr(atom_cellspacing);
 	if(str)
 	{
 		tstring val = str;
@@ -434,7 +574,7 @@ void litehtml::el_table::parse_attributes()
 		m_style.add_property(_t("border-spacing"), val.c_str(), 0, false);
 	}
 	
-	str = get_attr(_t("border"));
+	str = get_attr(atom_border);
 	if(str)
 	{
 		m_style.add_property(_t("border-width"), str, 0, false);
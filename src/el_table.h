@@ -10,6 +10,21 @@ namespace litehtml
 		bool	is_auto;
 	};
 
+	// how el_table::render() finds the min and max widths of a cell
+	enum cell_measure_type
+	{
+		cell_measure_table,		// the width at max_width, the table has one column of fixed width
+		cell_measure_column,	// the width at max_width or more, the column has a fixed width
+		cell_measure_content	// the min and max content widths
+	};
+
+	struct cell_measure
+	{
+		table_cell*			cell;
+		cell_measure_type	type;
+		int					max_width;
+	};
+
 
 	class el_table : public html_tag
 	{
@@ -19,6 +34,8 @@ namespace litehtml
 		int				m_border_spacing_x;
 		int				m_border_spacing_y;
 		border_collapse	m_border_collapse;
+		table_layout	m_table_layout;
+		bool			m_measuring;		// the cells are measured on the layout threads
 	public:
 		el_table(litehtml::document* doc);
 		virtual ~el_table();
@@ -28,8 +45,15 @@ namespace litehtml
 		virtual void	parse_styles(bool is_reparse = false);
 		virtual void	draw_children( uint_ptr hdc, int x, int y, const position* clip, draw_flag flag, int zindex );
 		virtual void	parse_attributes();
+		virtual void	find_prelayout(elements_vector& els);
+		virtual void	unstable_layout();
+
+		void			measure_cell(const cell_measure& measure);
 
 	protected:
 		virtual void	init();
+	private:
+		void			measure_columns(def_value<int>& block_width, int max_width);
+		void			measure_cells(std::vector<cell_measure>& measures);
 	};
 }
\ No newline at end of file
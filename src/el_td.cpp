@@ -14,12 +14,12 @@ litehtml::el_td::~el_td()
 
 void litehtml::el_td::parse_attributes()
 {
-	const tchar_t* str = get_attr(_t("width"));
+	const tchar_t* str = get_attr(atom_width);
 	if(str)
 	{
 		m_style.add_property(_t("width"), str, 0, false);
 	}
-	str = get_attr(_t("background"));
+	str = get_attr(atom_background);
 	if(str)
 	{
 		tstring url = _t("url('");
@@ -27,13 +27,13 @@ void litehtml::el_td::parse_attributes()
 		url += _t("')");
 		m_style.add_property(_t("background-image"), url.c_str(), 0, false);
 	}
-	str = get_attr(_t("align"));
+	str = get_attr(atom_align);
 	if(str)
 	{
 		m_style.add_property(_t("text-align"), str, 0, false);
 	}
 
-	str = get_attr(_t("valign"));
+	str = get_attr(atom_valign);
 	if(str)
 	{
 		m_style.add_property(_t("vertical-align"), str, 0, false);
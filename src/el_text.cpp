@@ -13,6 +13,13 @@ litehtml::el_text::el_text( const tchar_t* text, litehtml::document* doc ) : ele
 	m_draw_spaces		= true;
 }
 
+litehtml::el_text::el_text( const tchar_t* text, size_t len, litehtml::document* doc ) : element(doc), m_text(text, len)
+{
+	m_text_transform	= text_transform_none;
+	m_use_transformed	= false;
+	m_draw_spaces		= true;
+}
+
 litehtml::el_text::~el_text()
 {
 
@@ -28,18 +35,27 @@ void litehtml::el_text::get_text( tstring& text )
 	text += m_text;
 }
 
-const litehtml::tchar_t* litehtml::el_text::get_style_property( const tchar_t* name, bool inherited, const tchar_t* def /*= 0*/ )
+const litehtml::property_value* litehtml::el_text::get_style_value( property_id id, bool inherited )
+{
+	if(inherited)
+	{
+		return m_parent->get_style_value(id, inherited);
+	}
+	return 0;
+}
+
+const litehtml::property_value* litehtml::el_text::get_style_value( const tchar_t* name, bool inherited )
 {
 	if(inherited)
 	{
-		return m_parent->get_style_property(name, inherited, def);
+		return m_parent->get_style_value(name, inherited);
 	}
-	return def;
+	return 0;
 }
 
 void litehtml::el_text::parse_styles(bool is_reparse)
 {
-	m_text_transform	= (text_transform)	value_index(get_style_property(_t("text-transform"), true,	_t("none")),	text_transform_strings,	text_transform_none);
+	m_text_transform	= (text_transform)	get_style_keyword(prop_text_transform, true, text_transform_none);
 	if(m_text_transform != text_transform_none)
 	{
 		m_transformed_text	= m_text;
@@ -74,7 +90,8 @@ void litehtml::el_text::parse_styles(bool is_reparse)
 	} else
 	{
 		m_size.height	= fm.height;
-		m_size.width	= m_doc->container()->text_width(m_use_transformed ? m_transformed_text.c_str() : m_text.c_str(), font);
+		m_size.width	= 0;
+		m_doc->queue_text_width(this, m_use_transformed ? m_transformed_text.c_str() : m_text.c_str(), font, &m_size.width);
 	}
 	m_draw_spaces = fm.draw_spaces;
 }
@@ -98,7 +115,7 @@ void litehtml::el_text::draw( uint_ptr hdc, int x, int y, const position* clip )
 	if(pos.does_intersect(clip))
 	{
 		uint_ptr font = m_parent->get_font();
-		litehtml::web_color color = m_parent->get_color(_t("color"), true, m_doc->get_def_color());
+		litehtml::web_color color = m_parent->get_color(prop_color, true, m_doc->get_def_color());
 		m_doc->container()->draw_text(hdc, m_use_transformed ? m_transformed_text.c_str() : m_text.c_str(), font, color, pos);
 	}
 }
@@ -155,3 +172,8 @@ litehtml::css_offsets litehtml::el_text::get_css_offsets() const
 	}
 	return css_offsets();
 }
+
+bool litehtml::el_text::is_text() const
+{
+	return true;
+}
@@ -15,10 +15,12 @@ namespace litehtml
 		bool			m_draw_spaces;
 	public:
 		el_text(const tchar_t* text, litehtml::document* doc);
+		el_text(const tchar_t* text, size_t len, litehtml::document* doc);
 		virtual ~el_text();
 
 		virtual void				get_text(tstring& text);
-		virtual const tchar_t*		get_style_property(const tchar_t* name, bool inherited, const tchar_t* def = 0);
+		virtual const property_value*	get_style_value(property_id id, bool inherited);
+		virtual const property_value*	get_style_value(const tchar_t* name, bool inherited);
 		virtual void				parse_styles(bool is_reparse);
 		virtual int					get_base_line();
 		virtual void				draw(uint_ptr hdc, int x, int y, const position* clip);
@@ -28,6 +30,7 @@ namespace litehtml
 		virtual white_space			get_white_space() const;
 		virtual element_position	get_element_position(css_offsets* offsets = 0) const;
 		virtual css_offsets			get_css_offsets() const;
+		virtual bool				is_text() const;
 
 	protected:
 		virtual void				get_content_size(size& sz, int max_width);
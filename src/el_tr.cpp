@@ -14,12 +14,12 @@ litehtml::el_tr::~el_tr()
 
 void litehtml::el_tr::parse_attributes()
 {
-	const tchar_t* str = get_attr(_t("align"));
+	const tchar_t* str = get_attr(atom_align);
 	if(str)
 	{
 		m_style.add_property(_t("text-align"), str, 0, false);
 	}
-	str = get_attr(_t("valign"));
+	str = get_attr(atom_valign);
 	if(str)
 	{
 		m_style.add_property(_t("vertical-align"), str, 0, false);
@@ -11,6 +11,8 @@ litehtml::element::element( litehtml::document* doc )
 	m_doc		= doc;
 	m_parent	= 0;
 	m_skip		= false;
+	m_dirty		= 0;
+	m_float_origin	= -1;
 }
 
 litehtml::element::~element()
@@ -48,14 +50,66 @@ bool litehtml::element::is_point_inside( int x, int y )
 	return false;
 }
 
-litehtml::web_color litehtml::element::get_color( const tchar_t* prop_name, bool inherited, const litehtml::web_color& def_color )
+litehtml::web_color litehtml::element::get_color( property_id prop, bool inherited, const litehtml::web_color& def_color )
 {
-	const tchar_t* clrstr = get_style_property(prop_name, inherited, 0);
-	if(!clrstr)
+	const property_value* val = get_style_value(prop, inherited);
+	if(!val)
 	{
-		return def_color;
+		val = property_value::get_default(prop);
+		if(!val)
+		{
+			return def_color;
+		}
 	}
-	return web_color::from_string(clrstr);
+	return val->m_color;
+}
+
+int litehtml::element::get_style_keyword( property_id prop, bool inherited, int invalid )
+{
+	const property_value* val = get_style_value(prop, inherited);
+	if(!val)
+	{
+		val = property_value::get_default(prop);
+	}
+	if(!val || val->m_keyword < 0)
+	{
+		return invalid;
+	}
+	return val->m_keyword;
+}
+
+litehtml::css_length litehtml::element::get_style_length( property_id prop, bool inherited )
+{
+	const property_value* val = get_style_value(prop, inherited);
+	if(!val)
+	{
+		val = property_value::get_default(prop);
+		if(!val)
+		{
+			return css_length();
+		}
+	}
+	return val->m_length;
+}
+
+const litehtml::tchar_t* litehtml::element::get_style_property( property_id id, bool inherited, const tchar_t* def /*= 0*/ )
+{
+	const property_value* val = get_style_value(id, inherited);
+	if(!val)
+	{
+		return def;
+	}
+	return val->m_value.c_str();
+}
+
+const litehtml::tchar_t* litehtml::element::get_style_property( const tchar_t* name, bool inherited, const tchar_t* def /*= 0*/ )
+{
+	const property_value* val = get_style_value(name, inherited);
+	if(!val)
+	{
+		return def;
+	}
+	return val->m_value.c_str();
 }
 
 litehtml::position litehtml::element::get_placement() const
@@ -251,6 +305,11 @@ int litehtml::element::get_inline_shift_right()
 	return ret;
 }
 
+void litehtml::element::set_attr( const tchar_t* name, const tchar_t* val )
+{
+	set_attr(name, val, val ? t_strlen(val) : 0);
+}
+
 litehtml::background* litehtml::element::get_background(bool own_only)				LITEHTML_RETURN_FUNC(0)
 litehtml::element* litehtml::element::get_element_by_point( int x, int y, int client_x, int client_y )	LITEHTML_RETURN_FUNC(0)
 litehtml::element* litehtml::element::get_child_by_point( int x, int y, int client_x, int client_y, draw_flag flag, int zindex ) LITEHTML_RETURN_FUNC(0)
@@ -288,14 +347,19 @@ int litehtml::element::place_element( element* el, int max_width )					LITEHTML_
 int litehtml::element::render_inline( element* container, int max_width )			LITEHTML_RETURN_FUNC(0)
 void litehtml::element::add_positioned( element* el )									LITEHTML_EMPTY_FUNC
 int litehtml::element::find_next_line_top( int top, int width, int def_right )		LITEHTML_RETURN_FUNC(0)
+int litehtml::element::floats_query_begin()											LITEHTML_RETURN_FUNC(0)
+int litehtml::element::floats_query_end( int saved )								LITEHTML_RETURN_FUNC(INT_MAX)
+void litehtml::element::unstable_layout()												LITEHTML_EMPTY_FUNC
+void litehtml::element::find_prelayout( elements_vector& els )						LITEHTML_EMPTY_FUNC
+int litehtml::element::text_lines() const											LITEHTML_RETURN_FUNC(-1)
 litehtml::element_float litehtml::element::get_float() const						LITEHTML_RETURN_FUNC(float_none)
 void litehtml::element::add_float( element* el, int x, int y )						LITEHTML_EMPTY_FUNC
 void litehtml::element::update_floats( int dy, element* parent )					LITEHTML_EMPTY_FUNC
 int litehtml::element::get_line_left( int y )										LITEHTML_RETURN_FUNC(0)
 int litehtml::element::get_line_right( int y, int def_right )						LITEHTML_RETURN_FUNC(def_right)
-int litehtml::element::get_left_floats_height() const								LITEHTML_RETURN_FUNC(0)
-int litehtml::element::get_right_floats_height() const								LITEHTML_RETURN_FUNC(0)
-int litehtml::element::get_floats_height(element_float el_float) const				LITEHTML_RETURN_FUNC(0)
+int litehtml::element::get_left_floats_height()										LITEHTML_RETURN_FUNC(0)
+int litehtml::element::get_right_floats_height()									LITEHTML_RETURN_FUNC(0)
+int litehtml::element::get_floats_height(element_float el_float)					LITEHTML_RETURN_FUNC(0)
 bool litehtml::element::is_floats_holder() const									LITEHTML_RETURN_FUNC(false)
 void litehtml::element::get_content_size( size& sz, int max_width )					LITEHTML_EMPTY_FUNC
 void litehtml::element::init()														LITEHTML_EMPTY_FUNC
@@ -303,9 +367,10 @@ int litehtml::element::render( int x, int y, int max_width, bool second_pass )
 bool litehtml::element::appendChild( litehtml::element* el )						LITEHTML_RETURN_FUNC(false)
 const litehtml::tchar_t* litehtml::element::get_tagName() const						LITEHTML_RETURN_FUNC(_t(""))
 void litehtml::element::set_tagName( const tchar_t* tag )							LITEHTML_EMPTY_FUNC
-void litehtml::element::set_data( const tchar_t* data )								LITEHTML_EMPTY_FUNC
-void litehtml::element::set_attr( const tchar_t* name, const tchar_t* val )			LITEHTML_EMPTY_FUNC
-void litehtml::element::apply_stylesheet( const litehtml::css& stylesheet )			LITEHTML_EMPTY_FUNC
+void litehtml::element::set_data( const tchar_t* data, size_t len )					LITEHTML_EMPTY_FUNC
+void litehtml::element::set_attr( const tchar_t* name, const tchar_t* val, size_t val_len )	LITEHTML_EMPTY_FUNC
+void litehtml::element::apply_stylesheet( const litehtml::css& stylesheet, const ancestor_filter& parents )	LITEHTML_EMPTY_FUNC
+void litehtml::element::match_stylesheet( const litehtml::css& stylesheet, const ancestor_filter& parents, cascade_task& task, bool subtree )	LITEHTML_EMPTY_FUNC
 void litehtml::element::refresh_styles()											LITEHTML_EMPTY_FUNC
 void litehtml::element::on_click()													LITEHTML_EMPTY_FUNC
 void litehtml::element::init_font()													LITEHTML_EMPTY_FUNC
@@ -315,12 +380,14 @@ const litehtml::tchar_t* litehtml::element::get_attr( const tchar_t* name, const
 bool litehtml::element::is_white_space()											LITEHTML_RETURN_FUNC(false)
 bool litehtml::element::is_body() const												LITEHTML_RETURN_FUNC(false)
 bool litehtml::element::is_break() const											LITEHTML_RETURN_FUNC(false)
+bool litehtml::element::is_text() const												LITEHTML_RETURN_FUNC(false)
 int litehtml::element::get_base_line()												LITEHTML_RETURN_FUNC(0)
 bool litehtml::element::on_mouse_over()												LITEHTML_RETURN_FUNC(false)
 bool litehtml::element::on_mouse_leave()											LITEHTML_RETURN_FUNC(false)
 bool litehtml::element::on_lbutton_down()											LITEHTML_RETURN_FUNC(false)
 bool litehtml::element::on_lbutton_up()												LITEHTML_RETURN_FUNC(false)
 bool litehtml::element::find_styles_changes( position::vector& redraw_boxes, int x, int y )	LITEHTML_RETURN_FUNC(false)
+bool litehtml::element::has_dynamic_styles() const										LITEHTML_RETURN_FUNC(false)
 const litehtml::tchar_t* litehtml::element::get_cursor()							LITEHTML_RETURN_FUNC(0)
 litehtml::white_space litehtml::element::get_white_space() const					LITEHTML_RETURN_FUNC(white_space_normal)
 litehtml::style_display litehtml::element::get_display() const						LITEHTML_RETURN_FUNC(display_none)
@@ -330,7 +397,8 @@ bool litehtml::element::is_replaced() const											LITEHTML_RETURN_FUNC(false
 int litehtml::element::line_height() const											LITEHTML_RETURN_FUNC(0)
 void litehtml::element::draw( uint_ptr hdc, int x, int y, const position* clip )	LITEHTML_EMPTY_FUNC
 void litehtml::element::draw_background( uint_ptr hdc, int x, int y, const position* clip )	LITEHTML_EMPTY_FUNC
-const litehtml::tchar_t* litehtml::element::get_style_property( const tchar_t* name, bool inherited, const tchar_t* def /*= 0*/ )	LITEHTML_RETURN_FUNC(0)
+const litehtml::property_value* litehtml::element::get_style_value( property_id id, bool inherited )	LITEHTML_RETURN_FUNC(0)
+const litehtml::property_value* litehtml::element::get_style_value( const tchar_t* name, bool inherited )	LITEHTML_RETURN_FUNC(0)
 litehtml::uint_ptr litehtml::element::get_font( font_metrics* fm /*= 0*/ )			LITEHTML_RETURN_FUNC(0)
 int litehtml::element::get_font_size()	const										LITEHTML_RETURN_FUNC(0)
 void litehtml::element::get_text( tstring& text )									LITEHTML_EMPTY_FUNC
@@ -24,6 +24,8 @@ namespace litehtml
 		margins						m_padding;
 		margins						m_borders;
 		bool						m_skip;
+		int							m_dirty;	// dirty_flags
+		int							m_float_origin;	// in the float_bands of the floats holder
 	public:
 		element(litehtml::document* doc);
 		virtual ~element();
@@ -59,7 +61,11 @@ namespace litehtml
 		margins						get_borders()				const;
 
 		bool						in_normal_flow()			const;
-		litehtml::web_color			get_color(const tchar_t* prop_name, bool inherited, const litehtml::web_color& def_color = litehtml::web_color());
+		litehtml::web_color			get_color(property_id prop, bool inherited, const litehtml::web_color& def_color = litehtml::web_color());
+		int							get_style_keyword(property_id prop, bool inherited, int invalid);
+		css_length					get_style_length(property_id prop, bool inherited);
+		const tchar_t*				get_style_property(property_id id, bool inherited, const tchar_t* def = 0);
+		const tchar_t*				get_style_property(const tchar_t* name, bool inherited, const tchar_t* def = 0);
 		bool						is_inline_box()				const;
 		position					get_placement()				const;
 		bool						collapse_top_margin()		const;
@@ -71,6 +77,7 @@ namespace litehtml
 		element*					parent() const;
 		void						parent(element* par);
 		bool						is_visible() const;
+		bool						need_layout() const;
 		int							calc_width(int defVal) const;
 		int							get_inline_shift_left();
 		int							get_inline_shift_right();
@@ -90,7 +97,7 @@ namespace litehtml
 
 		virtual const tchar_t*		get_tagName() const;
 		virtual void				set_tagName(const tchar_t* tag);
-		virtual void				set_data(const tchar_t* data);
+		virtual void				set_data(const tchar_t* data, size_t len);
 		virtual element_float		get_float() const;
 		virtual vertical_align		get_vertical_align() const;
 		virtual element_clear		get_clear() const;
@@ -107,13 +114,16 @@ namespace litehtml
 		virtual void				set_css_width(css_length& w);
 		virtual css_length			get_css_height() const;
 
-		virtual void				set_attr(const tchar_t* name, const tchar_t* val);
+		void						set_attr(const tchar_t* name, const tchar_t* val);
+		virtual void				set_attr(const tchar_t* name, const tchar_t* val, size_t val_len);
 		virtual const tchar_t*		get_attr(const tchar_t* name, const tchar_t* def = 0);
-		virtual void				apply_stylesheet(const litehtml::css& stylesheet);
+		virtual void				apply_stylesheet(const litehtml::css& stylesheet, const ancestor_filter& parents);
+		virtual void				match_stylesheet(const litehtml::css& stylesheet, const ancestor_filter& parents, cascade_task& task, bool subtree);
 		virtual void				refresh_styles();
 		virtual bool				is_white_space();
 		virtual bool				is_body() const;
 		virtual bool				is_break() const;
+		virtual bool				is_text() const;
 		virtual int					get_base_line();
 		virtual bool				on_mouse_over();
 		virtual bool				on_mouse_leave();
@@ -121,6 +131,7 @@ namespace litehtml
 		virtual bool				on_lbutton_up();
 		virtual void				on_click();
 		virtual bool				find_styles_changes(position::vector& redraw_boxes, int x, int y);
+		virtual bool				has_dynamic_styles() const;
 		virtual const tchar_t*		get_cursor();
 		virtual void				init_font();
 		virtual bool				is_point_inside(int x, int y);
@@ -135,7 +146,8 @@ namespace litehtml
 		virtual void				parse_styles(bool is_reparse = false);
 		virtual void				draw(uint_ptr hdc, int x, int y, const position* clip);
 		virtual void				draw_background( uint_ptr hdc, int x, int y, const position* clip );
-		virtual const tchar_t*		get_style_property(const tchar_t* name, bool inherited, const tchar_t* def = 0);
+		virtual const property_value*	get_style_value(property_id id, bool inherited);
+		virtual const property_value*	get_style_value(const tchar_t* name, bool inherited);
 		virtual uint_ptr			get_font(font_metrics* fm = 0);
 		virtual int					get_font_size() const;
 		virtual void				get_text(tstring& text);
@@ -152,9 +164,9 @@ namespace litehtml
 		virtual void				get_content_size(size& sz, int max_width);
 		virtual void				init();
 		virtual bool				is_floats_holder() const;
-		virtual int					get_floats_height(element_float el_float = float_none) const;
-		virtual int					get_left_floats_height() const;
-		virtual int					get_right_floats_height() const;
+		virtual int					get_floats_height(element_float el_float = float_none);
+		virtual int					get_left_floats_height();
+		virtual int					get_right_floats_height();
 		virtual int					get_line_left(int y);
 		virtual int					get_line_right(int y, int def_right);
 		virtual void				get_line_left_right(int y, int def_right, int& ln_left, int& ln_right);
@@ -162,6 +174,11 @@ namespace litehtml
 		virtual void				update_floats(int dy, element* parent);
 		virtual void				add_positioned(element* el);
 		virtual int					find_next_line_top(int top, int width, int def_right);
+		virtual int					floats_query_begin();
+		virtual int					floats_query_end(int saved);
+		virtual void				unstable_layout();
+		virtual void				find_prelayout(elements_vector& els);
+		virtual int					text_lines() const;
 		virtual int					get_zindex() const;
 		virtual void				draw_stacking_context(uint_ptr hdc, int x, int y, const position* clip, bool with_positioned);
 		virtual void				draw_children( uint_ptr hdc, int x, int y, const position* clip, draw_flag flag, int zindex );
@@ -351,4 +368,9 @@ namespace litehtml
 		return !(m_skip || get_display() == display_none || get_visibility() != visibility_visible);
 	}
 
+	inline bool litehtml::element::need_layout() const
+	{
+		return (m_dirty & (dirty_layout | dirty_child_layout)) != 0;
+	}
+
 }
\ No newline at end of file
@@ -0,0 +1,247 @@
+#include "html.h"
+#include "float_bands.h"
+
+litehtml::float_bands::float_bands()
+{
+	m_dy		= 0;
+	m_applied	= 0;
+}
+
+void litehtml::float_bands::clear()
+{
+	m_floats.clear();
+	m_places.clear();
+	m_origins.clear();
+	m_bands.clear();
+	m_changes.clear();
+	m_float_changes.clear();
+	m_dy		= 0;
+	m_applied	= 0;
+}
+
+int litehtml::float_bands::add_origin( const element* el, int parent )
+{
+	float_origin origin;
+	origin.el			= el;
+	origin.parent		= parent;
+	origin.dy			= 0;
+	origin.first_float	= (int) m_floats.size();
+	m_origins.push_back(origin);
+	return (int) m_origins.size() - 1;
+}
+
+void litehtml::float_bands::add( const floated_box& fb, int origin )
+{
+	m_floats.push_back(fb);
+	m_floats.back().pos.y -= m_dy;
+
+	float_place place;
+	place.y			= m_floats.back().pos.y - origin_dy(origin);
+	place.origin	= origin;
+	m_places.push_back(place);
+
+	if(m_applied == (int) m_floats.size() - 1)
+	{
+		apply(m_floats.back());
+		m_applied++;
+	}
+}
+
+void litehtml::float_bands::move_origin( int origin, int dy )
+{
+	m_origins[origin].dy += dy;
+	if(m_origins[origin].first_float < m_applied)
+	{
+		m_applied = m_origins[origin].first_float;
+	}
+}
+
+void litehtml::float_bands::shift( int dy )
+{
+	m_dy += dy;
+}
+
+int litehtml::float_bands::origin_dy( int origin ) const
+{
+	int dy = 0;
+	for(; origin >= 0; origin = m_origins[origin].parent)
+	{
+		dy += m_origins[origin].dy;
+	}
+	return dy;
+}
+
+void litehtml::float_bands::update()
+{
+	if(m_applied == (int) m_floats.size())
+	{
+		return;
+	}
+
+	// roll back the changes of the moved floats and the ones after them
+	int first_change = m_float_changes[m_applied];
+	for(int i = (int) m_changes.size() - 1; i >= first_change; i--)
+	{
+		const band_change& change = m_changes[i];
+		if(change.inserted)
+		{
+			m_bands.erase(change.top);
+		} else
+		{
+			m_bands[change.top] = change.old;
+		}
+	}
+	m_changes.resize(first_change);
+	m_float_changes.resize(m_applied);
+
+	for(; m_applied < (int) m_floats.size(); m_applied++)
+	{
+		floated_box& fb = m_floats[m_applied];
+		fb.pos.y = m_places[m_applied].y + origin_dy(m_places[m_applied].origin);
+		apply(fb);
+	}
+}
+
+int litehtml::float_bands::floats_bottom( element_float side ) const
+{
+	int h = INT_MIN;
+	for(floated_box::vector::const_iterator i = m_floats.begin(); i != m_floats.end(); i++)
+	{
+		if(side == float_none || i->float_side == side)
+		{
+			h = std::max(h, i->pos.bottom());
+		}
+	}
+	return h == INT_MIN ? 0 : std::max(0, h + m_dy);
+}
+
+int litehtml::float_bands::clearing_top( element_float side ) const
+{
+	element_clear clear = (side == float_left) ? clear_left : clear_right;
+	int h = INT_MIN;
+	for(floated_box::vector::const_iterator i = m_floats.begin(); i != m_floats.end(); i++)
+	{
+		if(i->clear_floats == clear || i->clear_floats == clear_both)
+		{
+			h = std::max(h, i->pos.top());
+		}
+	}
+	return h == INT_MIN ? 0 : std::max(0, h + m_dy);
+}
+
+void litehtml::float_bands::apply( const floated_box& fb )
+{
+	m_float_changes.push_back((int) m_changes.size());
+
+	band_map::iterator first	= split(fb.pos.top());
+	band_map::iterator last		= split(fb.pos.bottom());
+	if(fb.pos.height < 0)
+	{
+		return;
+	}
+
+	for(band_map::iterator i = first; i != last; i++)
+	{
+		band_change change;
+		change.top		= i->first;
+		change.old		= i->second;
+		change.inserted	= false;
+		m_changes.push_back(change);
+
+		band& b = i->second;
+		if(fb.float_side == float_left)
+		{
+			b.left = std::max(b.left, fb.pos.right());
+		} else
+		{
+			b.right		= b.has_right ? std::min(b.right, fb.pos.left()) : fb.pos.left();
+			b.has_right	= true;
+		}
+	}
+}
+
+int litehtml::float_bands::line_left( int y ) const
+{
+	band_map::const_iterator i = find(y);
+	if(i == m_bands.end())
+	{
+		return 0;
+	}
+	return i->second.left;
+}
+
+bool litehtml::float_bands::line_right( int y, int& right ) const
+{
+	band_map::const_iterator i = find(y);
+	if(i == m_bands.end() || !i->second.has_right)
+	{
+		return false;
+	}
+	right = i->second.right;
+	return true;
+}
+
+int litehtml::float_bands::next_fit( int top, int width, int def_right ) const
+{
+	band_map::const_iterator i = m_bands.lower_bound(top - m_dy);
+	if(i == m_bands.end())
+	{
+		return INT_MIN;
+	}
+	for(; i != m_bands.end(); i++)
+	{
+		int right = i->second.has_right ? std::min(i->second.right, def_right) : def_right;
+		if(right - i->second.left >= width)
+		{
+			return i->first + m_dy;
+		}
+	}
+	return INT_MAX;
+}
+
+// returns the band containing y, end() if y is above all bands
+litehtml::float_bands::band_map::const_iterator litehtml::float_bands::find( int y ) const
+{
+	band_map::const_iterator i = m_bands.upper_bound(y - m_dy);
+	if(i == m_bands.begin())
+	{
+		return m_bands.end();
+	}
+	return --i;
+}
+
+// makes top the top of a band and returns the band
+litehtml::float_bands::band_map::iterator litehtml::float_bands::split( int top )
+{
+	band_map::iterator i = m_bands.upper_bound(top);
+	if(i != m_bands.begin())
+	{
+		band_map::iterator prev = i;
+		prev--;
+		if(prev->first == top)
+		{
+			return prev;
+		}
+	}
+
+	band b;
+	if(i != m_bands.begin())
+	{
+		band_map::iterator prev = i;
+		prev--;
+		b = prev->second;
+	} else
+	{
+		b.left		= 0;
+		b.right		= 0;
+		b.has_right	= false;
+	}
+
+	band_change change;
+	change.top		= top;
+	change.old		= b;
+	change.inserted	= true;
+	m_changes.push_back(change);
+
+	return m_bands.insert(i, band_map::value_type(top, b));
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+namespace litehtml
+{
+	// Floats of a floats holder as horizontal bands: every top and bottom
+	// of a float starts a band, each band keeps the space the floats leave
+	// in it. Bands are kept in a map by their top, a new float only updates
+	// the bands it covers.
+	//
+	// Each float records the bands it changed. When floats are moved, the
+	// bands are rolled back to the first moved float and only the floats
+	// from there on are added again. Moving all floats just changes the
+	// offset of the band tops.
+	//
+	// The y of a float is kept relative to its origin, the innermost element
+	// between it and the holder, see add_origin(). An origin keeps the shift
+	// of its element relative to its parent origin, moving an element with
+	// all floats in it only changes that shift.
+	class float_bands
+	{
+		struct band
+		{
+			int		left;		// max right of the left floats, 0 if none
+			int		right;		// min left of the right floats
+			bool	has_right;	// the band has right floats
+		};
+		// the band ends at the top of the next one
+		typedef std::map<int, band>		band_map;
+
+		struct band_change
+		{
+			int		top;
+			band	old;
+			bool	inserted;	// the float split a band at top
+		};
+
+		struct float_origin
+		{
+			const element*	el;
+			int				parent;			// -1 for the holder
+			int				dy;
+			int				first_float;	// the first float in el
+		};
+
+		struct float_place
+		{
+			int		y;			// relative to the origin
+			int		origin;
+		};
+
+		floated_box::vector			m_floats;		// in the order they were added, y without m_dy
+		std::vector<float_place>	m_places;
+		std::vector<float_origin>	m_origins;
+		band_map					m_bands;		// by top, without m_dy
+		std::vector<band_change>	m_changes;
+		std::vector<int>			m_float_changes;	// first of m_changes for every float in the bands
+		int							m_dy;			// added to the floats and band tops
+		int							m_applied;		// the floats before it are placed and in the bands
+	public:
+		float_bands();
+
+		void	clear();
+		bool	empty() const;
+		// origin of the floats in el, parent is the origin of the parent of
+		// el or -1 if it is the holder
+		int		add_origin(const element* el, int parent);
+		bool	is_origin(int origin, const element* el) const;
+		void	add(const floated_box& fb, int origin);
+		// the floats of origin were moved down by dy, update() places them
+		// and builds the bands again from the first one
+		void	move_origin(int origin, int dy);
+		// all floats were moved down by dy
+		void	shift(int dy);
+		void	update();
+
+		// max bottom of the floats on side, of all floats for float_none
+		int		floats_bottom(element_float side) const;
+		// max top of the floats clearing side
+		int		clearing_top(element_float side) const;
+
+		int		line_left(int y) const;
+		// returns false if no right float covers y
+		bool	line_right(int y, int& right) const;
+
+		// the first band top at or below top where width fits between the
+		// floats and def_right. INT_MIN if no band starts there, INT_MAX
+		// if width does not fit in any band, see last_top()
+		int		next_fit(int top, int width, int def_right) const;
+		int		last_top() const;
+	private:
+		int							origin_dy(int origin) const;
+		void						apply(const floated_box& fb);
+		band_map::iterator			split(int top);
+		band_map::const_iterator	find(int y) const;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inline functions
+	//////////////////////////////////////////////////////////////////////////
+
+	inline bool float_bands::empty() const
+	{
+		return m_floats.empty();
+	}
+
+	inline bool float_bands::is_origin( int origin, const element* el ) const
+	{
+		return origin >= 0 && origin < (int) m_origins.size() && m_origins[origin].el == el;
+	}
+
+	inline int float_bands::last_top() const
+	{
+		return m_bands.rbegin()->first + m_dy;
+	}
+}
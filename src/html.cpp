@@ -2,6 +2,14 @@
 #include "types.h"
 #include "html_tag.h"
 
+void litehtml::document_container::text_width_batch( const tchar_t** texts, int count, uint_ptr hFont, int* widths )
+{
+	for(int i = 0; i < count; i++)
+	{
+		widths[i] = text_width(texts[i], hFont);
+	}
+}
+
 void litehtml::trim(tstring &s) 
 {
 	tstring::size_type pos = s.find_first_not_of(_t(" \n\r\t"));
@@ -44,51 +52,51 @@ litehtml::tstring::size_type litehtml::find_close_bracket(const tstring &s, tstr
 	return tstring::npos;
 }
 
-int litehtml::value_index( const tstring& val, const tstring& strings, int defValue, tchar_t delim )
+// Prefer keyword_index() with a table from keywords.h for the lists in types.h
+int litehtml::value_index( const tchar_t* val, const tchar_t* strings, int defValue, tchar_t delim )
 {
-	if(val.empty() || strings.empty() || !delim)
+	if(!val || !strings || !val[0] || !strings[0] || !delim)
 	{
 		return defValue;
 	}
 
+	size_t val_len = t_strlen(val);
 	int idx = 0;
-	tstring::size_type delim_start	= 0;
-	tstring::size_type delim_end	= strings.find(delim, delim_start);
-	tstring::size_type item_len		= 0;
+	const tchar_t* item = strings;
 	while(true)
 	{
-		if(delim_end == tstring::npos)
+		const tchar_t* item_end = item;
+		while(*item_end && *item_end != delim)
 		{
-			item_len = strings.length() - delim_start;
-		} else
+			item_end++;
+		}
+		if((size_t) (item_end - item) == val_len && !t_strncmp(item, val, val_len))
 		{
-			item_len = delim_end - delim_start;
+			return idx;
 		}
-		if(item_len == val.length())
+		if(!*item_end)
 		{
-			if(val == strings.substr(delim_start, item_len))
-			{
-				return idx;
-			}
+			break;
 		}
+		item = item_end + 1;
 		idx++;
-		delim_start = delim_end;
-		if(delim_start == tstring::npos) break;
-		delim_start++;
-		if(delim_start == strings.length()) break;
-		delim_end = strings.find(delim, delim_start);
 	}
 	return defValue;
 }
 
+int litehtml::value_index( const tstring& val, const tstring& strings, int defValue, tchar_t delim )
+{
+	return value_index(val.c_str(), strings.c_str(), defValue, delim);
+}
+
+bool litehtml::value_in_list( const tchar_t* val, const tchar_t* strings, tchar_t delim )
+{
+	return value_index(val, strings, -1, delim) >= 0;
+}
+
 bool litehtml::value_in_list( const tstring& val, const tstring& strings, tchar_t delim )
 {
-	int idx = value_index(val, strings, -1, delim);
-	if(idx >= 0)
-	{
-		return true;
-	}
-	return false;
+	return value_index(val.c_str(), strings.c_str(), -1, delim) >= 0;
 }
 
 void litehtml::split_string(const tstring& str, string_vector& tokens, const tstring& delims, const tstring& delims_preserve, const tstring& quote)
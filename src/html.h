@@ -5,11 +5,19 @@
 #include <ctype.h>
 #include <vector>
 #include <map>
+#include <list>
 #include <cstring>
+#include <climits>
 #include <algorithm>
 #include "os_types.h"
 #include "types.h"
+#include "atoms.h"
+#include "attr_list.h"
+#include "keywords.h"
+#include "ancestor_filter.h"
+#include "cascade.h"
 #include "object.h"
+#include "arena.h"
 #include "background.h"
 #include "borders.h"
 #include "html_tag.h"
@@ -34,6 +42,8 @@ namespace litehtml
 		virtual uint_ptr			create_font(const tchar_t* faceName, int size, int weight, font_style italic, unsigned int decoration, litehtml::font_metrics* fm) = 0;
 		virtual void				delete_font(uint_ptr hFont) = 0;
 		virtual int					text_width(const tchar_t* text, uint_ptr hFont) = 0;
+		// widths[i] = text_width(texts[i], hFont); override it if many strings are measured faster at once
+		virtual void				text_width_batch(const tchar_t** texts, int count, uint_ptr hFont, int* widths);
 		virtual void				draw_text(uint_ptr hdc, const tchar_t* text, uint_ptr hFont, litehtml::web_color color, const litehtml::position& pos) = 0;
 		virtual int					pt_to_px(int pt) = 0;
 		virtual int					get_default_font_size() = 0;
@@ -60,7 +70,9 @@ namespace litehtml
 
 	void trim(tstring &s);
 	void lcase(tstring &s);
+	int	 value_index(const tchar_t* val, const tchar_t* strings, int defValue = -1, tchar_t delim = _t(';'));
 	int	 value_index(const tstring& val, const tstring& strings, int defValue = -1, tchar_t delim = _t(';'));
+	bool value_in_list(const tchar_t* val, const tchar_t* strings, tchar_t delim = _t(';'));
 	bool value_in_list(const tstring& val, const tstring& strings, tchar_t delim = _t(';'));
 	tstring::size_type find_close_bracket(const tstring &s, tstring::size_type off, tchar_t open_b = _t('('), tchar_t close_b = _t(')'));
 	void split_string(const tstring& str, string_vector& tokens, const tstring& delims, const tstring& delims_preserve = _t(""), const tstring& quote = _t("\""));
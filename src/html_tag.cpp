@@ -11,23 +11,36 @@
 litehtml::html_tag::html_tag(litehtml::document* doc) : litehtml::element(doc)
 {
 	m_box_sizing			= box_sizing_content_box;
-	m_z_index				= 0;
 	m_overflow				= overflow_visible;
 	m_box					= 0;
 	m_text_align			= text_align_left;
 	m_el_position			= element_position_static;
 	m_display				= display_inline;
 	m_vertical_align		= va_baseline;
-	m_list_style_type		= list_style_type_none;
-	m_list_style_position	= list_style_position_outside;
 	m_float					= float_none;
 	m_clear					= clear_none;
-	m_font					= 0;
-	m_font_size				= 0;
 	m_white_space			= white_space_normal;
-	m_lh_predefined			= false;
-	m_line_height			= 0;
 	m_visibility			= visibility_visible;
+	m_tag					= atom_empty;
+	m_id					= atom_empty;
+	m_style_id				= 0;
+	m_style_source			= 0;
+	m_dynamic_styles		= false;
+	m_dynamic_children		= false;
+	m_floats_query			= INT_MIN;
+	m_floats_queries		= 0;
+	m_layout.max_width		= -1;
+	m_layout.generation		= 0;
+	m_layout.fixed_width	= false;
+	m_layout.second_pass	= false;
+	m_attrs.set_arena(doc->get_arena());
+
+	computed_styles& defaults = doc->get_computed_styles();
+	m_css_box				= defaults.box.get_default();
+	m_css_border			= defaults.border.get_default();
+	m_css_background		= defaults.background.get_default();
+	m_css_text				= defaults.text.get_default();
+	m_css_position			= defaults.position.get_default();
 }
 
 litehtml::html_tag::~html_tag()
@@ -48,12 +61,12 @@ bool litehtml::html_tag::appendChild( litehtml::element* el )
 
 const litehtml::tchar_t* litehtml::html_tag::get_tagName() const
 {
-	return m_tag.c_str();
+	return m_doc->atoms().name(m_tag);
 }
 
-void litehtml::html_tag::set_attr( const tchar_t* name, const tchar_t* val )
+void litehtml::html_tag::set_attr( const tchar_t* name, const tchar_t* val, size_t val_len )
 {
-	if(name && val)
+	if(name && name[0] && val)
 	{
 		tstring s_val = name;
 		std::locale lc = std::locale::global(std::locale::classic());
@@ -61,16 +74,42 @@ void litehtml::html_tag::set_attr( const tchar_t* name, const tchar_t* val )
 		{
 			s_val[i] = std::tolower(s_val[i], lc);
 		}
-		m_attrs[s_val] = val;
+		atom attr = m_doc->atoms().get(s_val.c_str());
+		m_attrs.set(attr, val, val_len);
+
+		// selectors compare ids and classes case-insensitively by atoms
+		if(attr == atom_id || attr == atom_class)
+		{
+			tstring names(val, val_len);
+			lcase(names);
+			if(attr == atom_id)
+			{
+				m_id = m_doc->atoms().get(names.c_str());
+			} else
+			{
+				string_vector tokens;
+				split_string(names, tokens, _t(" "));
+				m_classes.clear();
+				for(string_vector::const_iterator tok = tokens.begin(); tok != tokens.end(); tok++)
+				{
+					m_classes.push_back(m_doc->atoms().get(tok->c_str()));
+				}
+			}
+		}
 	}
 }
 
 const litehtml::tchar_t* litehtml::html_tag::get_attr( const tchar_t* name, const tchar_t* def )
 {
-	string_map::const_iterator attr = m_attrs.find(name);
-	if(attr != m_attrs.end())
+	return get_attr(m_doc->atoms().find(name), def);
+}
+
+const litehtml::tchar_t* litehtml::html_tag::get_attr( atom name, const tchar_t* def ) const
+{
+	const tchar_t* val = m_attrs.get(name);
+	if(val)
 	{
-		return attr->second.c_str();
+		return val;
 	}
 	return def;
 }
@@ -101,26 +140,51 @@ litehtml::element::ptr litehtml::html_tag::select_one( const css_selector& selec
 	return 0;
 }
 
-void litehtml::html_tag::apply_stylesheet( const litehtml::css& stylesheet )
+void litehtml::html_tag::apply_stylesheet( const litehtml::css& stylesheet, const ancestor_filter& parents )
 {
 	remove_before_after();
 
-	for(litehtml::css_selector::vector::const_iterator sel = stylesheet.selectors().begin(); sel != stylesheet.selectors().end(); sel++)
+	const selector_match* matches = 0;
+	int count = 0;
+	selector_match::vector own_matches;
+	if(!m_doc->take_matches(this, matches, count))
+	{
+		match_selectors(stylesheet, parents, own_matches, m_doc->get_cascade_stats(), false);
+		matches	= own_matches.empty() ? 0 : &own_matches[0];
+		count	= (int) own_matches.size();
+	}
+
+	// the styles of this element are combined after the loop, see apply_styles()
+	style::vector applied;
+
+	for(int idx = 0; idx < count; idx++)
 	{
-		int apply = select(*(*sel), false);
+		const css_selector::ptr& sel = stylesheet.selectors()[matches[idx].index];
+
+		int apply = matches[idx].apply;
+		if(apply == select_deferred)
+		{
+			apply = select(*sel, false);
+		}
 
 		if(apply != select_no_match)
 		{
-			used_selector::ptr us = new used_selector((*sel), false);
+			used_selector::ptr us = new used_selector(sel, false);
 			m_used_styles.push_back(us);
 
-			if((*sel)->is_media_valid())
+			if(apply & select_match_pseudo_class)
+			{
+				us->m_dynamic		= true;
+				m_dynamic_styles	= true;
+			}
+
+			if(sel->is_media_valid())
 			{
 				if(apply & select_match_pseudo_class)
 				{
-					if(select(*(*sel), true))
+					if(select(*sel, true))
 					{
-						add_style((*sel)->m_style);
+						applied.push_back(sel->m_style);
 						us->m_used = true;
 					}
 				} else if(apply & select_match_with_after)
@@ -128,30 +192,144 @@ void litehtml::html_tag::apply_stylesheet( const litehtml::css& stylesheet )
 					element* el = get_element_after();
 					if(el)
 					{
-						el->add_style((*sel)->m_style);
+						el->add_style(sel->m_style);
 					}
 				} else if(apply & select_match_with_before)
 				{
 					element* el = get_element_before();
 					if(el)
 					{
-						el->add_style((*sel)->m_style);
+						el->add_style(sel->m_style);
 					}
 				} else
 				{
-					add_style((*sel)->m_style);
+					applied.push_back(sel->m_style);
 					us->m_used = true;
 				}
 			}
 		}
 	}
 
-	for(elements_vector::iterator i = m_children.begin(); i != m_children.end(); i++)
+	if(!applied.empty())
 	{
-		if((*i)->get_display() != display_inline_text)
+		apply_styles(applied);
+	}
+
+	if(!m_children.empty())
+	{
+		ancestor_filter filter = parents;
+		filter.add_element(get_tagName(), get_attr(atom_id), get_attr(atom_class));
+
+		for(elements_vector::iterator i = m_children.begin(); i != m_children.end(); i++)
+		{
+			if((*i)->get_display() != display_inline_text)
+			{
+				(*i)->apply_stylesheet(stylesheet, filter);
+				if((*i)->has_dynamic_styles())
+				{
+					m_dynamic_children = true;
+				}
+			}
+		}
+	}
+}
+
+void litehtml::html_tag::apply_styles( const style::vector& applied )
+{
+	style_cache& cache = m_doc->get_style_cache();
+
+	unsigned int hash = (unsigned int) m_tag * 31 + (unsigned int) m_style_id;
+	for(style::vector::const_iterator st = applied.begin(); st != applied.end(); st++)
+	{
+		hash = hash * 31 + (unsigned int) ((size_t) (const style*) (*st) >> 4);
+	}
+
+	style_cache::entry& entry = cache.find(hash);
+	if(	entry.el && entry.el != this && m_style_id >= 0 &&
+		entry.style_id == m_style_id &&
+		entry.el->m_tag == m_tag &&
+		entry.applied == applied &&
+		entry.el->m_attrs.equal(m_attrs, atom_id) )
+	{
+		// equal attributes give equal styles from parse_attributes() too
+		m_style			= entry.el->m_style;
+		m_style_id		= entry.el->m_style_id;
+		m_style_source	= entry.el;
+		m_doc->get_cascade_stats().styles_shared++;
+		return;
+	}
+
+	entry.el		= this;
+	entry.style_id	= m_style_id;
+	entry.applied	= applied;
+
+	for(style::vector::const_iterator st = applied.begin(); st != applied.end(); st++)
+	{
+		add_style(*st);
+	}
+	m_style_id		= m_style_id >= 0 ? cache.new_id() : -1;
+	m_style_source	= 0;
+}
+
+void litehtml::html_tag::match_stylesheet( const litehtml::css& stylesheet, const ancestor_filter& parents, cascade_task& task, bool subtree )
+{
+	cascade_task::element_matches rec;
+	rec.el		= this;
+	rec.first	= (int) task.matches.size();
+	match_selectors(stylesheet, parents, task.matches, task.stats, true);
+	rec.count	= (int) task.matches.size() - rec.first;
+	task.elements.push_back(rec);
+
+	if(subtree && !m_children.empty())
+	{
+		ancestor_filter filter = parents;
+		filter.add_element(get_tagName(), get_attr(atom_id), get_attr(atom_class));
+
+		for(elements_vector::iterator i = m_children.begin(); i != m_children.end(); i++)
+		{
+			if((*i)->get_display() != display_inline_text)
+			{
+				(*i)->match_stylesheet(stylesheet, filter, task, true);
+			}
+		}
+	}
+}
+
+void litehtml::html_tag::match_selectors( const litehtml::css& stylesheet, const ancestor_filter& parents, selector_match::vector& res, cascade_stats& stats, bool defer_siblings )
+{
+	const css_selector::vector& selectors = stylesheet.selectors();
+	std::vector<int> candidates;
+	bool indexed = stylesheet.find_candidates(get_tagName(), get_attr(atom_id), get_attr(atom_class), candidates);
+	size_t count = indexed ? candidates.size() : selectors.size();
+
+	for(size_t idx = 0; idx < count; idx++)
+	{
+		selector_match match;
+		match.index = indexed ? candidates[idx] : (int) idx;
+		const css_selector& sel = *selectors[match.index];
+
+		if(!sel.m_ancestor_hashes.empty())
 		{
-			(*i)->apply_stylesheet(stylesheet);
+			stats.ancestor_checks++;
+			if(!parents.may_contain_all(sel.m_ancestor_hashes))
+			{
+				stats.ancestor_rejects++;
+				continue;
+			}
 		}
+
+		if(defer_siblings && sel.has_sibling_combinator())
+		{
+			match.apply = select_deferred;
+		} else
+		{
+			match.apply = select(sel, false);
+			if(match.apply == select_no_match)
+			{
+				continue;
+			}
+		}
+		res.push_back(match);
 	}
 }
 
@@ -175,7 +353,7 @@ void litehtml::html_tag::draw( uint_ptr hdc, int x, int y, const position* clip
 
 	draw_background(hdc, x, y, clip);
 
-	if(m_display == display_list_item && m_list_style_type != list_style_type_none)
+	if(m_display == display_list_item && m_css_text->list_type != list_style_type_none)
 	{
 		if(m_overflow > overflow_visible)
 		{
@@ -195,18 +373,18 @@ litehtml::uint_ptr litehtml::html_tag::get_font(font_metrics* fm)
 {
 	if(fm)
 	{
-		*fm = m_font_metrics;
+		*fm = m_css_text->metrics;
 	}
-	return m_font;
+	return m_css_text->font;
 }
 
-const litehtml::tchar_t* litehtml::html_tag::get_style_property( const tchar_t* name, bool inherited, const tchar_t* def /*= 0*/ )
+const litehtml::property_value* litehtml::html_tag::get_style_value( property_id id, bool inherited )
 {
-	const tchar_t* ret = m_style.get_property(name);
+	const property_value* ret = m_style.get_value(id);
 	bool pass_parent = false;
 	if(m_parent)
 	{
-		if(ret && !t_strcasecmp(ret, _t("inherit")))
+		if(ret && ret->m_inherit)
 		{
 			pass_parent = true;
 		} else if(!ret && inherited)
@@ -216,55 +394,125 @@ const litehtml::tchar_t* litehtml::html_tag::get_style_property( const tchar_t*
 	}
 	if(pass_parent)
 	{
-		ret = m_parent->get_style_property(name, inherited, def);
+		ret = m_parent->get_style_value(id, inherited);
 	}
+	return ret;
+}
 
-	if(!ret)
+const litehtml::property_value* litehtml::html_tag::get_style_value( const tchar_t* name, bool inherited )
+{
+	const property_value* ret = m_style.get_value(name);
+	bool pass_parent = false;
+	if(m_parent)
 	{
-		ret = def;
+		if(ret && ret->m_inherit)
+		{
+			pass_parent = true;
+		} else if(!ret && inherited)
+		{
+			pass_parent = true;
+		}
+	}
+	if(pass_parent)
+	{
+		ret = m_parent->get_style_value(name, inherited);
 	}
-
 	return ret;
 }
 
 void litehtml::html_tag::parse_styles(bool is_reparse)
 {
-	m_id	= get_attr(_t("id"), _t(""));
-	m_class	= get_attr(_t("class"), _t(""));
+	layout_style old_layout;
+	bool restyled = (m_dirty & dirty_style) != 0;
+	if(restyled)
+	{
+		get_layout_style(old_layout);
+	}
 
-	const tchar_t* style = get_attr(_t("style"));
+	const tchar_t* style = get_attr(atom_style);
 
 	if(style)
 	{
 		m_style.add(style, NULL);
 	}
 
+	// a previous sibling with the same m_style and attributes has the same computed values
+	html_tag* src = m_style_source;
+	m_style_source = 0;
+	if(!is_reparse && src && src->m_parent == m_parent && src->m_style_id == m_style_id && m_style_id >= 0)
+	{
+		copy_computed_style(*src);
+		m_doc->get_cascade_stats().computed_shared++;
+	} else
+	{
+		parse_computed_style();
+	}
+
+	// paint only changes keep the layout, unknown previous values don't
+	if(!restyled)
+	{
+		m_dirty |= dirty_layout;
+	} else if(!same_layout_style(old_layout))
+	{
+		set_layout_dirty();
+	}
+	m_dirty &= ~dirty_style;
+
+	if(!is_reparse)
+	{
+		for(elements_vector::iterator i = m_children.begin(); i != m_children.end(); i++)
+		{
+			(*i)->parse_styles();
+		}
+		// the words of a block and its inline children are measured at once
+		if(m_display != display_inline)
+		{
+			m_doc->flush_text_widths();
+		}
+
+		init();
+	}
+}
+
+void litehtml::html_tag::parse_computed_style()
+{
+	// fill new groups, they are replaced by equal shared ones at the end
+	arena* owner = m_doc->get_arena();
+	m_css_box			= placed(new (owner) computed_box, owner);
+	m_css_border		= placed(new (owner) computed_border, owner);
+	m_css_background	= placed(new (owner) computed_background, owner);
+	m_css_text			= placed(new (owner) computed_text, owner);
+	m_css_position		= placed(new (owner) computed_position, owner);
+
 	init_font();
 
-	m_el_position	= (element_position)	value_index(get_style_property(_t("position"),		false,	_t("static")),		element_position_strings,	element_position_fixed);
-	m_text_align	= (text_align)			value_index(get_style_property(_t("text-align"),	true,	_t("left")),		text_align_strings,			text_align_left);
-	m_overflow		= (overflow)			value_index(get_style_property(_t("overflow"),		false,	_t("visible")),		overflow_strings,			overflow_visible);
-	m_white_space	= (white_space)			value_index(get_style_property(_t("white-space"),	true,	_t("normal")),		white_space_strings,		white_space_normal);
-	m_display		= (style_display)		value_index(get_style_property(_t("display"),		false,	_t("inline")),		style_display_strings,		display_inline);
-	m_visibility	= (visibility)			value_index(get_style_property(_t("visibility"),	true,	_t("visible")),		visibility_strings,			visibility_visible);
-	m_box_sizing	= (box_sizing)			value_index(get_style_property(_t("box-sizing"),	false,	_t("content-box")),	box_sizing_strings,			box_sizing_content_box);
+	computed_box*		box			= m_css_box;
+	css_borders&		borders		= m_css_border->borders;
+	computed_text*		text		= m_css_text;
+	computed_position*	pos			= m_css_position;
+	int					font_size	= text->font_size;
+
+	m_el_position	= (element_position)	get_style_keyword(prop_position, false, element_position_fixed);
+	m_text_align	= (text_align)			get_style_keyword(prop_text_align, true, text_align_left);
+	m_overflow		= (overflow)			get_style_keyword(prop_overflow, false, overflow_visible);
+	m_white_space	= (white_space)			get_style_keyword(prop_white_space, true, white_space_normal);
+	m_display		= (style_display)		get_style_keyword(prop_display, false, display_inline);
+	m_visibility	= (visibility)			get_style_keyword(prop_visibility, true, visibility_visible);
+	m_box_sizing	= (box_sizing)			get_style_keyword(prop_box_sizing, false, box_sizing_content_box);
 
 	if(m_el_position != element_position_static)
 	{
-		const tchar_t* val = get_style_property(_t("z-index"), false, 0);
+		const tchar_t* val = get_style_property(prop_z_index, false, 0);
 		if(val)
 		{
-			m_z_index = t_atoi(val);
+			pos->z_index = t_atoi(val);
 		}
 	}
 
-	const tchar_t* va	= get_style_property(_t("vertical-align"), true,	_t("baseline"));
-	m_vertical_align = (vertical_align) value_index(va, vertical_align_strings, va_baseline);
+	m_vertical_align	= (vertical_align)	get_style_keyword(prop_vertical_align, true, va_baseline);
+	m_float				= (element_float)	get_style_keyword(prop_float, false, float_none);
 
-	const tchar_t* fl	= get_style_property(_t("float"), false,	_t("none"));
-	m_float = (element_float) value_index(fl, element_float_strings, float_none);
-
-	m_clear = (element_clear) value_index(get_style_property(_t("clear"), false, _t("none")), element_clear_strings, clear_none);
+	m_clear = (element_clear) get_style_keyword(prop_clear, false, clear_none);
 
 	if(m_display != display_none)
 	{
@@ -278,130 +526,129 @@ void litehtml::html_tag::parse_styles(bool is_reparse)
 		}
 	}
 
-	m_css_text_indent.fromString(	get_style_property(_t("text-indent"),	true,	_t("0")),	_t("0"));
+	text->text_indent = get_style_length(prop_text_indent, true);
 
-	m_css_width.fromString(			get_style_property(_t("width"),			false,	_t("auto")), _t("auto"));
-	m_css_height.fromString(		get_style_property(_t("height"),		false,	_t("auto")), _t("auto"));
+	box->width	= get_style_length(prop_width, false);
+	box->height	= get_style_length(prop_height, false);
 
-	m_doc->cvt_units(m_css_width,	m_font_size);
-	m_doc->cvt_units(m_css_height,	m_font_size);
+	m_doc->cvt_units(box->width,	font_size);
+	m_doc->cvt_units(box->height,	font_size);
 
-	m_css_min_width.fromString(		get_style_property(_t("min-width"),		false,	_t("0")));
-	m_css_min_height.fromString(	get_style_property(_t("min-height"),	false,	_t("0")));
+	box->min_width	= get_style_length(prop_min_width, false);
+	box->min_height	= get_style_length(prop_min_height, false);
 
-	m_css_max_width.fromString(		get_style_property(_t("max-width"),		false,	_t("none")),	_t("none"));
-	m_css_max_height.fromString(	get_style_property(_t("max-height"),	false,	_t("none")),	_t("none"));
+	box->max_width	= get_style_length(prop_max_width, false);
+	box->max_height	= get_style_length(prop_max_height, false);
 	
-	m_doc->cvt_units(m_css_min_width,	m_font_size);
-	m_doc->cvt_units(m_css_min_height,	m_font_size);
-
-	m_css_offsets.left.fromString(		get_style_property(_t("left"),				false,	_t("auto")), _t("auto"));
-	m_css_offsets.right.fromString(		get_style_property(_t("right"),				false,	_t("auto")), _t("auto"));
-	m_css_offsets.top.fromString(		get_style_property(_t("top"),				false,	_t("auto")), _t("auto"));
-	m_css_offsets.bottom.fromString(	get_style_property(_t("bottom"),			false,	_t("auto")), _t("auto"));
-
-	m_doc->cvt_units(m_css_offsets.left,	m_font_size);
-	m_doc->cvt_units(m_css_offsets.right,	m_font_size);
-	m_doc->cvt_units(m_css_offsets.top,		m_font_size);
-	m_doc->cvt_units(m_css_offsets.bottom,	m_font_size);
-
-	m_css_margins.left.fromString(		get_style_property(_t("margin-left"),			false,	_t("0")), _t("auto"));
-	m_css_margins.right.fromString(		get_style_property(_t("margin-right"),			false,	_t("0")), _t("auto"));
-	m_css_margins.top.fromString(		get_style_property(_t("margin-top"),			false,	_t("0")), _t("auto"));
-	m_css_margins.bottom.fromString(	get_style_property(_t("margin-bottom"),		false,	_t("0")), _t("auto"));
-
-	m_css_padding.left.fromString(		get_style_property(_t("padding-left"),			false,	_t("0")), _t(""));
-	m_css_padding.right.fromString(		get_style_property(_t("padding-right"),		false,	_t("0")), _t(""));
-	m_css_padding.top.fromString(		get_style_property(_t("padding-top"),			false,	_t("0")), _t(""));
-	m_css_padding.bottom.fromString(	get_style_property(_t("padding-bottom"),		false,	_t("0")), _t(""));
-
-	m_css_borders.left.width.fromString(	get_style_property(_t("border-left-width"),	false,	_t("medium")), border_width_strings);
-	m_css_borders.right.width.fromString(	get_style_property(_t("border-right-width"),	false,	_t("medium")), border_width_strings);
-	m_css_borders.top.width.fromString(		get_style_property(_t("border-top-width"),		false,	_t("medium")), border_width_strings);
-	m_css_borders.bottom.width.fromString(	get_style_property(_t("border-bottom-width"),	false,	_t("medium")), border_width_strings);
-
-	m_css_borders.left.color = web_color::from_string(get_style_property(_t("border-left-color"),	false,	_t("")));
-	m_css_borders.left.style = (border_style) value_index(get_style_property(_t("border-left-style"), false, _t("none")), border_style_strings, border_style_none);
-
-	m_css_borders.right.color = web_color::from_string(get_style_property(_t("border-right-color"),	false,	_t("")));
-	m_css_borders.right.style = (border_style) value_index(get_style_property(_t("border-right-style"), false, _t("none")), border_style_strings, border_style_none);
-
-	m_css_borders.top.color = web_color::from_string(get_style_property(_t("border-top-color"),	false,	_t("")));
-	m_css_borders.top.style = (border_style) value_index(get_style_property(_t("border-top-style"), false, _t("none")), border_style_strings, border_style_none);
-
-	m_css_borders.bottom.color = web_color::from_string(get_style_property(_t("border-bottom-color"),	false,	_t("")));
-	m_css_borders.bottom.style = (border_style) value_index(get_style_property(_t("border-bottom-style"), false, _t("none")), border_style_strings, border_style_none);
-
-	m_css_borders.radius.top_left_x.fromString(get_style_property(_t("border-top-left-radius-x"), false, _t("0")));
-	m_css_borders.radius.top_left_y.fromString(get_style_property(_t("border-top-left-radius-y"), false, _t("0")));
-
-	m_css_borders.radius.top_right_x.fromString(get_style_property(_t("border-top-right-radius-x"), false, _t("0")));
-	m_css_borders.radius.top_right_y.fromString(get_style_property(_t("border-top-right-radius-y"), false, _t("0")));
-
-	m_css_borders.radius.bottom_right_x.fromString(get_style_property(_t("border-bottom-right-radius-x"), false, _t("0")));
-	m_css_borders.radius.bottom_right_y.fromString(get_style_property(_t("border-bottom-right-radius-y"), false, _t("0")));
-
-	m_css_borders.radius.bottom_left_x.fromString(get_style_property(_t("border-bottom-left-radius-x"), false, _t("0")));
-	m_css_borders.radius.bottom_left_y.fromString(get_style_property(_t("border-bottom-left-radius-y"), false, _t("0")));
-
-	m_doc->cvt_units(m_css_borders.radius.bottom_left_x,			m_font_size);
-	m_doc->cvt_units(m_css_borders.radius.bottom_left_y,			m_font_size);
-	m_doc->cvt_units(m_css_borders.radius.bottom_right_x,			m_font_size);
-	m_doc->cvt_units(m_css_borders.radius.bottom_right_y,			m_font_size);
-	m_doc->cvt_units(m_css_borders.radius.top_left_x,				m_font_size);
-	m_doc->cvt_units(m_css_borders.radius.top_left_y,				m_font_size);
-	m_doc->cvt_units(m_css_borders.radius.top_right_x,				m_font_size);
-	m_doc->cvt_units(m_css_borders.radius.top_right_y,				m_font_size);
-
-	m_doc->cvt_units(m_css_text_indent,								m_font_size);
-
-	m_margins.left		= m_doc->cvt_units(m_css_margins.left,		m_font_size);
-	m_margins.right		= m_doc->cvt_units(m_css_margins.right,		m_font_size);
-	m_margins.top		= m_doc->cvt_units(m_css_margins.top,		m_font_size);
-	m_margins.bottom	= m_doc->cvt_units(m_css_margins.bottom,	m_font_size);
-
-	m_padding.left		= m_doc->cvt_units(m_css_padding.left,		m_font_size);
-	m_padding.right		= m_doc->cvt_units(m_css_padding.right,		m_font_size);
-	m_padding.top		= m_doc->cvt_units(m_css_padding.top,		m_font_size);
-	m_padding.bottom	= m_doc->cvt_units(m_css_padding.bottom,	m_font_size);
-
-	m_borders.left		= m_doc->cvt_units(m_css_borders.left.width,	m_font_size);
-	m_borders.right		= m_doc->cvt_units(m_css_borders.right.width,	m_font_size);
-	m_borders.top		= m_doc->cvt_units(m_css_borders.top.width,		m_font_size);
-	m_borders.bottom	= m_doc->cvt_units(m_css_borders.bottom.width,	m_font_size);
+	m_doc->cvt_units(box->min_width,	font_size);
+	m_doc->cvt_units(box->min_height,	font_size);
+	m_doc->cvt_units(box->max_width,	font_size);
+	m_doc->cvt_units(box->max_height,	font_size);
+
+	pos->offsets.left	= get_style_length(prop_left, false);
+	pos->offsets.right	= get_style_length(prop_right, false);
+	pos->offsets.top	= get_style_length(prop_top, false);
+	pos->offsets.bottom	= get_style_length(prop_bottom, false);
+
+	m_doc->cvt_units(pos->offsets.left,		font_size);
+	m_doc->cvt_units(pos->offsets.right,	font_size);
+	m_doc->cvt_units(pos->offsets.top,		font_size);
+	m_doc->cvt_units(pos->offsets.bottom,	font_size);
+
+	box->margins.left	= get_style_length(prop_margin_left, false);
+	box->margins.right	= get_style_length(prop_margin_right, false);
+	box->margins.top	= get_style_length(prop_margin_top, false);
+	box->margins.bottom	= get_style_length(prop_margin_bottom, false);
+
+	box->padding.left	= get_style_length(prop_padding_left, false);
+	box->padding.right	= get_style_length(prop_padding_right, false);
+	box->padding.top	= get_style_length(prop_padding_top, false);
+	box->padding.bottom	= get_style_length(prop_padding_bottom, false);
+
+	borders.left.width		= get_style_length(prop_border_left_width, false);
+	borders.right.width		= get_style_length(prop_border_right_width, false);
+	borders.top.width		= get_style_length(prop_border_top_width, false);
+	borders.bottom.width	= get_style_length(prop_border_bottom_width, false);
+
+	borders.left.color	= get_color(prop_border_left_color, false);
+	borders.left.style	= (border_style) get_style_keyword(prop_border_left_style, false, border_style_none);
+
+	borders.right.color	= get_color(prop_border_right_color, false);
+	borders.right.style	= (border_style) get_style_keyword(prop_border_right_style, false, border_style_none);
+
+	borders.top.color	= get_color(prop_border_top_color, false);
+	borders.top.style	= (border_style) get_style_keyword(prop_border_top_style, false, border_style_none);
+
+	borders.bottom.color	= get_color(prop_border_bottom_color, false);
+	borders.bottom.style	= (border_style) get_style_keyword(prop_border_bottom_style, false, border_style_none);
+
+	borders.radius.top_left_x	= get_style_length(prop_border_top_left_radius_x, false);
+	borders.radius.top_left_y	= get_style_length(prop_border_top_left_radius_y, false);
+
+	borders.radius.top_right_x	= get_style_length(prop_border_top_right_radius_x, false);
+	borders.radius.top_right_y	= get_style_length(prop_border_top_right_radius_y, false);
+
+	borders.radius.bottom_right_x	= get_style_length(prop_border_bottom_right_radius_x, false);
+	borders.radius.bottom_right_y	= get_style_length(prop_border_bottom_right_radius_y, false);
+
+	borders.radius.bottom_left_x	= get_style_length(prop_border_bottom_left_radius_x, false);
+	borders.radius.bottom_left_y	= get_style_length(prop_border_bottom_left_radius_y, false);
+
+	m_doc->cvt_units(borders.radius.bottom_left_x,	font_size);
+	m_doc->cvt_units(borders.radius.bottom_left_y,	font_size);
+	m_doc->cvt_units(borders.radius.bottom_right_x,	font_size);
+	m_doc->cvt_units(borders.radius.bottom_right_y,	font_size);
+	m_doc->cvt_units(borders.radius.top_left_x,		font_size);
+	m_doc->cvt_units(borders.radius.top_left_y,		font_size);
+	m_doc->cvt_units(borders.radius.top_right_x,	font_size);
+	m_doc->cvt_units(borders.radius.top_right_y,	font_size);
+
+	m_doc->cvt_units(text->text_indent,	font_size);
+
+	m_margins.left		= m_doc->cvt_units(box->margins.left,	font_size);
+	m_margins.right		= m_doc->cvt_units(box->margins.right,	font_size);
+	m_margins.top		= m_doc->cvt_units(box->margins.top,	font_size);
+	m_margins.bottom	= m_doc->cvt_units(box->margins.bottom,	font_size);
+
+	m_padding.left		= m_doc->cvt_units(box->padding.left,	font_size);
+	m_padding.right		= m_doc->cvt_units(box->padding.right,	font_size);
+	m_padding.top		= m_doc->cvt_units(box->padding.top,	font_size);
+	m_padding.bottom	= m_doc->cvt_units(box->padding.bottom,	font_size);
+
+	m_borders.left		= m_doc->cvt_units(borders.left.width,		font_size);
+	m_borders.right		= m_doc->cvt_units(borders.right.width,		font_size);
+	m_borders.top		= m_doc->cvt_units(borders.top.width,		font_size);
+	m_borders.bottom	= m_doc->cvt_units(borders.bottom.width,	font_size);
 
 	css_length line_height;
-	line_height.fromString(get_style_property(_t("line-height"),	true,	_t("normal")), _t("normal"));
+	line_height = get_style_length(prop_line_height, true);
 	if(line_height.is_predefined())
 	{
-		m_line_height = m_font_metrics.height;
-		m_lh_predefined = true;
+		text->line_height = text->metrics.height;
+		text->lh_predefined = true;
 	} else if(line_height.units() == css_units_none)
 	{
-		m_line_height = (int) (line_height.val() * m_font_size);
-		m_lh_predefined = false;
+		text->line_height = (int) (line_height.val() * font_size);
+		text->lh_predefined = false;
 	} else
 	{
-		m_line_height =  m_doc->cvt_units(line_height,	m_font_size, m_font_size);
-		m_lh_predefined = false;
+		text->line_height =  m_doc->cvt_units(line_height,	font_size, font_size);
+		text->lh_predefined = false;
 	}
 
 
 	if(m_display == display_list_item)
 	{
-		const tchar_t* list_type = get_style_property(_t("list-style-type"), true, _t("disc"));
-		m_list_style_type = (list_style_type) value_index(list_type, list_style_type_strings, list_style_type_disc);
-
-		const tchar_t* list_pos = get_style_property(_t("list-style-position"), true, _t("outside"));
-		m_list_style_position = (list_style_position) value_index(list_pos, list_style_position_strings, list_style_position_outside);
+		text->list_type		= (list_style_type)		get_style_keyword(prop_list_style_type, true, list_style_type_disc);
+		text->list_position	= (list_style_position)	get_style_keyword(prop_list_style_position, true, list_style_position_outside);
 
-		const tchar_t* list_image = get_style_property(_t("list-style-image"), true, 0);
+		const tchar_t* list_image = get_style_property(prop_list_style_image, true, 0);
 		if(list_image && list_image[0])
 		{
 			tstring url;
 			css::parse_css_url(list_image, url);
 
-			const tchar_t* list_image_baseurl = get_style_property(_t("list-style-image-baseurl"), true, 0);
+			const tchar_t* list_image_baseurl = get_style_property(prop_list_style_image_baseurl, true, 0);
 			m_doc->container()->load_image(url.c_str(), list_image_baseurl, true);
 		}
 
@@ -409,31 +656,58 @@ void litehtml::html_tag::parse_styles(bool is_reparse)
 
 	parse_background();
 
-	if(!is_reparse)
-	{
-		for(elements_vector::iterator i = m_children.begin(); i != m_children.end(); i++)
-		{
-			(*i)->parse_styles();
-		}
+	computed_styles& shared = m_doc->get_computed_styles();
+	shared.box.share(m_css_box);
+	shared.border.share(m_css_border);
+	shared.background.share(m_css_background);
+	shared.text.share(m_css_text);
+	shared.position.share(m_css_position);
+}
 
-		init();
-	}
+void litehtml::html_tag::copy_computed_style( const html_tag& src )
+{
+	m_css_box				= src.m_css_box;
+	m_css_border			= src.m_css_border;
+	m_css_background		= src.m_css_background;
+	m_css_text				= src.m_css_text;
+	m_css_position			= src.m_css_position;
+
+	m_el_position			= src.m_el_position;
+	m_text_align			= src.m_text_align;
+	m_overflow				= src.m_overflow;
+	m_white_space			= src.m_white_space;
+	m_display				= src.m_display;
+	m_visibility			= src.m_visibility;
+	m_box_sizing			= src.m_box_sizing;
+	m_vertical_align		= src.m_vertical_align;
+	m_float					= src.m_float;
+	m_clear					= src.m_clear;
+
+	m_margins				= src.m_margins;
+	m_padding				= src.m_padding;
+	m_borders				= src.m_borders;
 }
 
 int litehtml::html_tag::render( int x, int y, int max_width, bool second_pass )
 {
+	int memo_width = 0;
+	if(reuse_layout(x, y, max_width, second_pass, memo_width))
+	{
+		return memo_width;
+	}
+
 	int parent_width = max_width;
 
 	// restore margins after collapse
-	m_margins.top		= m_doc->cvt_units(m_css_margins.top,		m_font_size, max_width);
-	m_margins.bottom	= m_doc->cvt_units(m_css_margins.bottom,	m_font_size, max_width);
+	m_margins.top		= m_doc->cvt_units(m_css_box->margins.top,		m_css_text->font_size, max_width);
+	m_margins.bottom	= m_doc->cvt_units(m_css_box->margins.bottom,	m_css_text->font_size, max_width);
 
 	// reset auto margins
-	if(m_css_margins.left.is_predefined())
+	if(m_css_box->margins.left.is_predefined())
 	{
 		m_margins.left = 0;
 	}
-	if(m_css_margins.right.is_predefined())
+	if(m_css_box->margins.right.is_predefined())
 	{
 		m_margins.right = 0;
 	}
@@ -448,7 +722,7 @@ int litehtml::html_tag::render( int x, int y, int max_width, bool second_pass )
 
 	def_value<int>	block_width(0);
 
-	if(m_display != display_table_cell && !m_css_width.is_predefined())
+	if(m_display != display_table_cell && !m_css_box->width.is_predefined())
 	{
 		int w = calc_width(parent_width);
 		if(m_box_sizing == box_sizing_border_box)
@@ -465,9 +739,9 @@ int litehtml::html_tag::render( int x, int y, int max_width, bool second_pass )
 	}
 
 	// check for max-width
-	if(!m_css_max_width.is_predefined())
+	if(!m_css_box->max_width.is_predefined())
 	{
-		int mw = m_doc->cvt_units(m_css_max_width, m_font_size, parent_width);
+		int mw = m_doc->cvt_units(m_css_box->max_width, m_css_text->font_size, parent_width);
 		if(m_box_sizing == box_sizing_border_box)
 		{
 			mw -= m_padding.left + m_borders.left + m_padding.right + m_borders.right;
@@ -478,8 +752,8 @@ int litehtml::html_tag::render( int x, int y, int max_width, bool second_pass )
 		}
 	}
 
-	m_floats_left.clear();
-	m_floats_right.clear();
+	m_float_bands.clear();
+	m_floats_query = INT_MIN;
 	m_boxes.clear();
 	m_cahe_line_left.invalidate();
 	m_cahe_line_right.invalidate();
@@ -559,18 +833,18 @@ int litehtml::html_tag::render( int x, int y, int max_width, bool second_pass )
 	}
 
 	int min_height = 0;
-	if(!m_css_min_height.is_predefined() && m_css_min_height.units() == css_units_percentage)
+	if(!m_css_box->min_height.is_predefined() && m_css_box->min_height.units() == css_units_percentage)
 	{
 		if(m_parent)
 		{
 			if(m_parent->get_predefined_height(block_height))
 			{
-				min_height = m_css_min_height.calc_percent(block_height);
+				min_height = m_css_box->min_height.calc_percent(block_height);
 			}
 		}
 	} else
 	{
-		min_height = (int) m_css_min_height.val();
+		min_height = (int) m_css_box->min_height.val();
 	}
 	if(min_height !=0 && m_box_sizing == box_sizing_border_box)
 	{
@@ -580,14 +854,14 @@ int litehtml::html_tag::render( int x, int y, int max_width, bool second_pass )
 
 	if(m_display == display_list_item)
 	{
-		const tchar_t* list_image = get_style_property(_t("list-style-image"), true, 0);
+		const tchar_t* list_image = get_style_property(prop_list_style_image, true, 0);
 		if(list_image)
 		{
 			tstring url;
 			css::parse_css_url(list_image, url);
 
 			size sz;
-			const tchar_t* list_image_baseurl = get_style_property(_t("list-style-image-baseurl"), true, 0);
+			const tchar_t* list_image_baseurl = get_style_property(prop_list_style_image_baseurl, true, 0);
 			m_doc->container()->get_image_size(url.c_str(), list_image_baseurl, sz);
 			if(min_height < sz.height)
 			{
@@ -602,7 +876,7 @@ int litehtml::html_tag::render( int x, int y, int max_width, bool second_pass )
 		m_pos.height = min_height;
 	}
 
-	int min_width = m_css_min_width.calc_percent(parent_width);
+	int min_width = m_css_box->min_width.calc_percent(parent_width);
 
 	if(min_width !=0 && m_box_sizing == box_sizing_border_box)
 	{
@@ -628,12 +902,13 @@ int litehtml::html_tag::render( int x, int y, int max_width, bool second_pass )
 	if(ret_width < max_width && !second_pass && m_parent)
 	{
 		if(	m_display == display_inline_block ||
-			m_css_width.is_predefined() && 
-			(	m_float != float_none || 
-				m_display == display_table ||
-				m_el_position == element_position_absolute || 
-				m_el_position == element_position_fixed
-			) 
+			(	m_css_box->width.is_predefined() && 
+				(	m_float != float_none || 
+					m_display == display_table ||
+					m_el_position == element_position_absolute || 
+					m_el_position == element_position_fixed
+				) 
+			)
 		  )
 		{
 			render(x, y, ret_width, true);
@@ -641,9 +916,202 @@ int litehtml::html_tag::render( int x, int y, int max_width, bool second_pass )
 		}
 	}
 
+	save_layout(parent_width, second_pass, ret_width);
+
 	return ret_width;
 }
 
+bool litehtml::html_tag::reuse_layout( int x, int y, int max_width, bool second_pass, int& ret_width )
+{
+	if(	m_dirty ||
+		m_layout.max_width < 0 ||
+		m_layout.generation != m_doc->layout_generation() ||
+		m_layout.second_pass != second_pass ||
+		(m_layout.max_width != max_width && !m_layout.fixed_width))
+	{
+		return false;
+	}
+
+	m_margins	= m_layout.margin;
+	m_padding	= m_layout.padding;
+	m_borders	= m_layout.border;
+
+	m_pos.width		= m_layout.width;
+	m_pos.height	= m_layout.height;
+
+	ret_width = m_layout.ret_width;
+	if(m_layout.max_width != max_width)
+	{
+		// auto margins follow the new width, collapsed ones stay
+		calc_outlines(max_width);
+		m_margins.top		= m_layout.margin.top;
+		m_margins.bottom	= m_layout.margin.bottom;
+		ret_width += m_margins.left + m_margins.right - m_layout.margin.left - m_layout.margin.right;
+
+		m_layout.max_width	= max_width;
+		m_layout.ret_width	= ret_width;
+		m_layout.margin		= m_margins;
+	}
+
+	m_pos.x	= x + content_margins_left();
+	m_pos.y	= y + content_margins_top();
+
+	return true;
+}
+
+bool litehtml::html_tag::has_fixed_width() const
+{
+	const computed_box* box = m_css_box;
+	if(box->width.is_predefined() || box->width.units() == css_units_percentage)
+	{
+		return false;
+	}
+	return !has_percentage_outlines();
+}
+
+// margins, paddings, borders or width limits follow max_width
+bool litehtml::html_tag::has_percentage_outlines() const
+{
+	const computed_box* box = m_css_box;
+	const css_length* lengths[] =
+	{
+		&box->margins.left,		&box->margins.right,	&box->margins.top,		&box->margins.bottom,
+		&box->padding.left,		&box->padding.right,	&box->padding.top,		&box->padding.bottom,
+		&box->min_width,		&box->max_width,
+		&m_css_border->borders.left.width,	&m_css_border->borders.right.width,
+		&m_css_border->borders.top.width,	&m_css_border->borders.bottom.width,
+	};
+	for(int i = 0; i < (int) (sizeof(lengths) / sizeof(lengths[0])); i++)
+	{
+		if(!lengths[i]->is_predefined() && lengths[i]->units() == css_units_percentage)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// A block holding only text has the same layout at any max_width its
+// lines fit in, el_table::render() keeps the widths of such cells.
+int litehtml::html_tag::text_lines() const
+{
+	for(elements_vector::const_iterator i = m_children.begin(); i != m_children.end(); i++)
+	{
+		if(!(*i)->is_text())
+		{
+			return -1;
+		}
+	}
+	const css_length& text_indent = m_css_text->text_indent;
+	if(	(!text_indent.is_predefined() && text_indent.units() == css_units_percentage) ||
+		has_percentage_outlines())
+	{
+		return -1;
+	}
+	return (int) m_boxes.size();
+}
+
+void litehtml::html_tag::save_layout( int max_width, bool second_pass, int ret_width )
+{
+	m_dirty = 0;
+
+	if(!can_keep_layout())
+	{
+		m_layout.max_width = -1;
+		return;
+	}
+
+	m_layout.max_width		= max_width;
+	m_layout.generation		= m_doc->layout_generation();
+	m_layout.fixed_width	= has_fixed_width();
+	m_layout.second_pass	= second_pass;
+	m_layout.ret_width		= ret_width;
+	m_layout.width			= m_pos.width;
+	m_layout.height			= m_pos.height;
+	m_layout.margin			= m_margins;
+	m_layout.padding		= m_padding;
+	m_layout.border			= m_borders;
+}
+
+bool litehtml::html_tag::can_keep_layout() const
+{
+	// Only floats holders don't depend on the surrounding content (their
+	// max_width already leaves out the outer floats), table cells are moved
+	// by vertical-align and percentage heights follow the parent
+	return	is_floats_holder() &&
+			m_display != display_table_cell &&
+			m_css_box->height.units() != css_units_percentage &&
+			m_css_box->min_height.units() != css_units_percentage;
+}
+
+// Blocks of fixed width keep their layout at any max_width, so they can
+// be laid out before their parents are (see document::prelayout). The
+// elements are collected in document order, one for each subtree.
+void litehtml::html_tag::find_prelayout( elements_vector& els )
+{
+	if(m_display == display_none)
+	{
+		return;
+	}
+	if(!m_dirty && m_layout.max_width >= 0 && m_layout.generation == m_doc->layout_generation())
+	{
+		// the whole subtree keeps its layout
+		return;
+	}
+	if(m_parent && !is_body() && !is_replaced() && can_keep_layout() && has_fixed_width())
+	{
+		els.push_back(this);
+		return;
+	}
+	for(elements_vector::iterator i = m_children.begin(); i != m_children.end(); i++)
+	{
+		(*i)->find_prelayout(els);
+	}
+}
+
+void litehtml::html_tag::set_layout_dirty()
+{
+	m_dirty |= dirty_layout;
+	for(element* el = m_parent; el; el = el->m_parent)
+	{
+		el->m_dirty |= dirty_child_layout;
+	}
+}
+
+void litehtml::html_tag::get_layout_style( layout_style& ls ) const
+{
+	ls.box				= m_css_box;
+	ls.border			= m_css_border;
+	ls.text				= m_css_text;
+	ls.offsets			= m_css_position;
+	ls.display			= m_display;
+	ls.floating			= m_float;
+	ls.clear			= m_clear;
+	ls.placement		= m_el_position;
+	ls.content_overflow	= m_overflow;
+	ls.spaces			= m_white_space;
+	ls.align			= m_text_align;
+	ls.valign			= m_vertical_align;
+	ls.sizing			= m_box_sizing;
+}
+
+bool litehtml::html_tag::same_layout_style( const layout_style& ls ) const
+{
+	return	ls.display			== m_display		&&
+			ls.floating			== m_float			&&
+			ls.clear			== m_clear			&&
+			ls.placement		== m_el_position	&&
+			ls.content_overflow	== m_overflow		&&
+			ls.spaces			== m_white_space	&&
+			ls.align			== m_text_align		&&
+			ls.valign			== m_vertical_align	&&
+			ls.sizing			== m_box_sizing		&&
+			(ls.box		== m_css_box		|| ls.box->equal(*m_css_box))				&&
+			(ls.border	== m_css_border		|| ls.border->same_layout(*m_css_border))	&&
+			(ls.text	== m_css_text		|| ls.text->equal(*m_css_text))				&&
+			(ls.offsets	== m_css_position	|| ls.offsets->equal(*m_css_position));
+}
+
 bool litehtml::html_tag::is_white_space()
 {
 	return false;
@@ -651,7 +1119,7 @@ bool litehtml::html_tag::is_white_space()
 
 int litehtml::html_tag::get_font_size() const
 {
-	return m_font_size;
+	return m_css_text->font_size;
 }
 
 int litehtml::html_tag::get_base_line()
@@ -775,12 +1243,11 @@ int litehtml::html_tag::select(const css_selector& selector, bool apply_pseudo)
 
 int litehtml::html_tag::select(const css_element_selector& selector, bool apply_pseudo)
 {
-	if(!selector.m_tag.empty() && selector.m_tag != _t("*"))
+	selector.resolve_atoms(m_doc->atoms());
+
+	if(selector.m_tag_id && selector.m_tag_id != m_tag)
 	{
-		if(selector.m_tag != m_tag)
-		{
-			return select_no_match;
-		}
+		return select_no_match;
 	}
 
 	int res = select_match;
@@ -788,7 +1255,7 @@ int litehtml::html_tag::select(const css_element_selector& selector, bool apply_
 
 	for(css_attribute_selector::vector::const_iterator i = selector.m_attrs.begin(); i != selector.m_attrs.end(); i++)
 	{
-		const tchar_t* attr_value = get_attr(i->attribute.c_str());
+		const tchar_t* attr_value = get_attr(i->attribute_id);
 		switch(i->condition)
 		{
 		case select_exists:
@@ -803,29 +1270,18 @@ int litehtml::html_tag::select(const css_element_selector& selector, bool apply_
 				return select_no_match;
 			} else 
 			{
-				if(i->attribute == _t("class"))
+				if(i->attribute_id == atom_class)
 				{
-					string_vector tokens1;
-					split_string(attr_value, tokens1, _t(" "));
-					string_vector tokens2;
-					split_string(i->val, tokens2, _t(" "));
-					bool found = true;
-					for(string_vector::iterator str1 = tokens2.begin(); str1 != tokens2.end() && found; str1++)
+					for(std::vector<atom>::const_iterator cls = i->val_ids.begin(); cls != i->val_ids.end(); cls++)
 					{
-						bool f = false;
-						for(string_vector::iterator str2 = tokens1.begin(); str2 != tokens1.end() && !f; str2++)
-						{
-							if( !t_strcasecmp(str1->c_str(), str2->c_str()) )
-							{
-								f = true;
-							}
-						}
-						if(!f)
+						if(std::find(m_classes.begin(), m_classes.end(), *cls) == m_classes.end())
 						{
-							found = false;
+							return select_no_match;
 						}
 					}
-					if(!found)
+				} else if(i->attribute_id == atom_id)
+				{
+					if(i->val_ids[0] != m_id)
 					{
 						return select_no_match;
 					}
@@ -908,7 +1364,7 @@ int litehtml::html_tag::select(const css_element_selector& selector, bool apply_
 					selector_name = i->val;
 				}
 
-				int selector = value_index(selector_name.c_str(), pseudo_class_strings);
+				int selector = keyword_index(pseudo_class_keywords, selector_name.c_str());
 				
 				switch(selector)
 				{
@@ -1041,118 +1497,44 @@ litehtml::element* litehtml::html_tag::find_ancestor( const css_selector& select
 	return m_parent->find_ancestor(selector, apply_pseudo, is_pseudo);
 }
 
-int litehtml::html_tag::get_floats_height(element_float el_float) const
+int litehtml::html_tag::get_floats_height(element_float el_float)
 {
 	if(is_floats_holder())
 	{
-		int h = 0;
-
-		bool process = false;
-
-		for(floated_box::vector::const_iterator i = m_floats_left.begin(); i != m_floats_left.end(); i++)
-		{
-			process = false;
-			switch(el_float)
-			{
-			case float_none:
-				process = true;
-				break;
-			case float_left:
-				if(i->clear_floats == clear_left || i->clear_floats == clear_both)
-				{
-					process = true;
-				}
-				break;
-			case float_right:
-				if(i->clear_floats == clear_right || i->clear_floats == clear_both)
-				{
-					process = true;
-				}
-				break;
-			}
-			if(process)
-			{
-				if(el_float == float_none)
-				{
-					h = std::max(h, i->pos.bottom());
-				} else
-				{
-					h = std::max(h, i->pos.top());
-				}
-			}
-		}
-
+		floats_queried(INT_MAX);
 
-		for(floated_box::vector::const_iterator i = m_floats_right.begin(); i != m_floats_right.end(); i++)
+		m_float_bands.update();
+		if(el_float == float_none)
 		{
-			process = false;
-			switch(el_float)
-			{
-			case float_none:
-				process = true;
-				break;
-			case float_left:
-				if(i->clear_floats == clear_left || i->clear_floats == clear_both)
-				{
-					process = true;
-				}
-				break;
-			case float_right:
-				if(i->clear_floats == clear_right || i->clear_floats == clear_both)
-				{
-					process = true;
-				}
-				break;
-			}
-			if(process)
-			{
-				if(el_float == float_none)
-				{
-					h = std::max(h, i->pos.bottom());
-				} else
-				{
-					h = std::max(h, i->pos.top());
-				}
-			}
+			return m_float_bands.floats_bottom(float_none);
 		}
-
-		return h;
+		return m_float_bands.clearing_top(el_float);
 	}
 	int h = m_parent->get_floats_height(el_float);
 	return h - m_pos.y;
 }
 
-int litehtml::html_tag::get_left_floats_height() const
+int litehtml::html_tag::get_left_floats_height()
 {
 	if(is_floats_holder())
 	{
-		int h = 0;
-		if(!m_floats_left.empty())
-		{
-			for(floated_box::vector::const_iterator el = m_floats_left.begin(); el != m_floats_left.end(); el++)
-			{
-				h = std::max(h, el->pos.bottom());
-			}
-		}
-		return h;
+		floats_queried(INT_MAX);
+
+		m_float_bands.update();
+		return m_float_bands.floats_bottom(float_left);
 	}
 	int h = m_parent->get_left_floats_height();
 	return h - m_pos.y;
 }
 
-int litehtml::html_tag::get_right_floats_height() const
+int litehtml::html_tag::get_right_floats_height()
 {
 	if(is_floats_holder())
 	{
-		int h = 0;
-		if(!m_floats_right.empty())
-		{
-			for(floated_box::vector::const_iterator el = m_floats_right.begin(); el != m_floats_right.end(); el++)
-			{
-				h = std::max(h, el->pos.bottom());
-			}
-		}
-		return h;
+		floats_queried(INT_MAX);
+
+		m_float_bands.update();
+		return m_float_bands.floats_bottom(float_right);
 	}
 	int h = m_parent->get_right_floats_height();
 	return h - m_pos.y;
@@ -1162,23 +1544,15 @@ int litehtml::html_tag::get_line_left( int y )
 {
 	if(is_floats_holder())
 	{
+		floats_queried(y);
+
 		if(m_cahe_line_left.is_valid && m_cahe_line_left.hash == y)
 		{
 			return m_cahe_line_left.val;
 		}
 
-		int w = 0;
-		for(floated_box::vector::const_iterator el = m_floats_left.begin(); el != m_floats_left.end(); el++)
-		{
-			if(y >= el->pos.top() && y < el->pos.bottom())
-			{
-				w = std::max(w, el->pos.right());
-				if(w < el->pos.right())
-				{
-					break;
-				}
-			}
-		}
+		m_float_bands.update();
+		int w = m_float_bands.line_left(y);
 		m_cahe_line_left.set_value(y, w);
 		return w;
 	}
@@ -1194,6 +1568,8 @@ int litehtml::html_tag::get_line_right( int y, int def_right )
 {
 	if(is_floats_holder())
 	{
+		floats_queried(y);
+
 		if(m_cahe_line_right.is_valid && m_cahe_line_right.hash == y)
 		{
 			if(m_cahe_line_right.is_default)
@@ -1205,21 +1581,16 @@ int litehtml::html_tag::get_line_right( int y, int def_right )
 			}
 		}
 
+		// the cache keeps the left of the floats, not the value for this
+		// def_right, so the answer does not depend on the previous query
 		int w = def_right;
-		m_cahe_line_right.is_default = true;
-		for(floated_box::vector::const_iterator el = m_floats_right.begin(); el != m_floats_right.end(); el++)
+		m_float_bands.update();
+		m_cahe_line_right.is_default = !m_float_bands.line_right(y, w);
+		m_cahe_line_right.set_value(y, w);
+		if(!m_cahe_line_right.is_default)
 		{
-			if(y >= el->pos.top() && y < el->pos.bottom())
-			{
-				w = std::min(w, el->pos.left());
-				m_cahe_line_right.is_default = false;
-				if(w > el->pos.left())
-				{
-					break;
-				}
-			}
+			w = std::min(w, def_right);
 		}
-		m_cahe_line_right.set_value(y, w);
 		return w;
 	}
 	int w = m_parent->get_line_right(y + m_pos.y, def_right + m_pos.x);
@@ -1248,7 +1619,7 @@ void litehtml::html_tag::get_line_left_right( int y, int def_right, int& ln_left
 	}
 }
 
-int litehtml::html_tag::fix_line_width( int max_width, element_float flt )
+int litehtml::html_tag::fix_line_width( int max_width, element_float flt, int float_top )
 {
 	int ret_width = 0;
 	if(!m_boxes.empty())
@@ -1271,6 +1642,21 @@ int litehtml::html_tag::fix_line_width( int max_width, element_float flt )
 			}
 		}
 
+		if(!was_cleared && m_boxes.back()->get_type() == box_block)
+		{
+			block_box* bb = (block_box*) (box*) m_boxes.back();
+			if(float_top > bb->floats_query())
+			{
+				// the block does not reach the float, placing it again would
+				// only finish the previous box once more
+				if(m_boxes.size() > 1)
+				{
+					m_boxes[m_boxes.size() - 2]->finish();
+				}
+				return bb->ret_width();
+			}
+		}
+
 		if(!was_cleared)
 		{
 			m_boxes.pop_back();
@@ -1300,13 +1686,13 @@ int litehtml::html_tag::fix_line_width( int max_width, element_float flt )
 
 			if(m_boxes.back()->get_type() == box_line)
 			{
-				if(m_boxes.size() == 1 && m_list_style_type != list_style_type_none && m_list_style_position == list_style_position_inside)
+				if(m_boxes.size() == 1 && m_css_text->list_type != list_style_type_none && m_css_text->list_position == list_style_position_inside)
 				{
 					int sz_font = get_font_size();
 					line_left += sz_font;
 				}
 
-				if(m_css_text_indent.val() != 0)
+				if(m_css_text->text_indent.val() != 0)
 				{
 					bool line_box_found = false;
 					for(box::vector::iterator iter = m_boxes.begin(); iter < m_boxes.end(); iter++)
@@ -1319,7 +1705,7 @@ int litehtml::html_tag::fix_line_width( int max_width, element_float flt )
 					}
 					if(!line_box_found)
 					{
-						line_left += m_css_text_indent.calc_percent(max_width);
+						line_left += m_css_text->text_indent.calc_percent(max_width);
 					}
 				}
 
@@ -1354,51 +1740,16 @@ void litehtml::html_tag::add_float( element* el, int x, int y )
 		fb.clear_floats	= el->get_clear();
 		fb.el			= el;
 
+		// a float added inside an element can change its layout
+		floats_queried(INT_MAX);
+
 		if(fb.float_side == float_left)
 		{
-			if(m_floats_left.empty())
-			{
-				m_floats_left.push_back(fb);
-			} else
-			{
-				bool inserted = false;
-				for(floated_box::vector::iterator i = m_floats_left.begin(); i != m_floats_left.end(); i++)
-				{
-					if(fb.pos.right() > i->pos.right())
-					{
-						m_floats_left.insert(i, fb);
-						inserted = true;
-						break;
-					}
-				}
-				if(!inserted)
-				{
-					m_floats_left.push_back(fb);
-				}
-			}
+			m_float_bands.add(fb, float_origin(el->parent()));
 			m_cahe_line_left.invalidate();
 		} else if(fb.float_side == float_right)
 		{
-			if(m_floats_right.empty())
-			{
-				m_floats_right.push_back(fb);
-			} else
-			{
-				bool inserted = false;
-				for(floated_box::vector::iterator i = m_floats_right.begin(); i != m_floats_right.end(); i++)
-				{
-					if(fb.pos.left() < i->pos.left())
-					{
-						m_floats_right.insert(i, fb);
-						inserted = true;
-						break;
-					}
-				}
-				if(!inserted)
-				{
-					m_floats_right.push_back(fb);
-				}
-			}
+			m_float_bands.add(fb, float_origin(el->parent()));
 			m_cahe_line_right.invalidate();
 		}
 	} else
@@ -1407,80 +1758,104 @@ void litehtml::html_tag::add_float( element* el, int x, int y )
 	}
 }
 
+// returns the origin of the floats in el, see float_bands::add_origin()
+int litehtml::html_tag::float_origin( element* el )
+{
+	if(!el || el == this)
+	{
+		return -1;
+	}
+	if(!m_float_bands.is_origin(el->m_float_origin, el))
+	{
+		int parent = float_origin(el->parent());
+		el->m_float_origin = m_float_bands.add_origin(el, parent);
+	}
+	return el->m_float_origin;
+}
+
 int litehtml::html_tag::find_next_line_top( int top, int width, int def_right )
 {
 	if(is_floats_holder())
 	{
-		int new_top = top;
-		int_vector points;
-
-		for(floated_box::vector::const_iterator el = m_floats_left.begin(); el != m_floats_left.end(); el++)
+		// the width changes at the tops and bottoms of the floats only
+		m_float_bands.update();
+		int fit = m_float_bands.next_fit(top, width, def_right);
+		// a new float below top would add a band, as does one below the last
+		// band top. Both answers depend on all the floats.
+		if(fit == INT_MIN)
 		{
-			if(el->pos.top() >= top)
-			{
-				if(find(points.begin(), points.end(), el->pos.top()) == points.end())
-				{
-					points.push_back(el->pos.top());
-				}
-			}
-			if(el->pos.bottom() >= top)
-			{
-				if(find(points.begin(), points.end(), el->pos.bottom()) == points.end())
-				{
-					points.push_back(el->pos.bottom());
-				}
-			}
+			floats_queried(INT_MAX);
+			return top;
 		}
-
-		for(floated_box::vector::const_iterator el = m_floats_right.begin(); el != m_floats_right.end(); el++)
+		if(fit == INT_MAX)
 		{
-			if(el->pos.top() >= top)
-			{
-				if(find(points.begin(), points.end(), el->pos.top()) == points.end())
-				{
-					points.push_back(el->pos.top());
-				}
-			}
-			if(el->pos.bottom() >= top)
-			{
-				if(find(points.begin(), points.end(), el->pos.bottom()) == points.end())
-				{
-					points.push_back(el->pos.bottom());
-				}
-			}
+			floats_queried(INT_MAX);
+			return m_float_bands.last_top();
 		}
+		floats_queried(fit);
+		return fit;
+	}
+	int new_top = m_parent->find_next_line_top(top + m_pos.y, width, def_right + m_pos.x);
+	return new_top - m_pos.y;
+}
 
-		if(!points.empty())
-		{
-			sort(points.begin(), points.end(), std::less<int>( ));
-			new_top = points.back();
+// The floats holder remembers the bottom y its floats were looked at
+// (INT_MAX if the answer depends on all of them). begin/end return it for
+// the queries made between them, a float starting below it can't change
+// what was placed there.
+int litehtml::html_tag::floats_query_begin()
+{
+	if(is_floats_holder())
+	{
+		int saved = m_floats_query;
+		m_floats_query = INT_MIN;
+		m_floats_queries++;
+		return saved;
+	}
+	return m_parent->floats_query_begin();
+}
 
-			for(int_vector::iterator i = points.begin(); i != points.end(); i++)
-			{
-				int pos_left	= 0;
-				int pos_right	= def_right;
-				get_line_left_right((*i), def_right, pos_left, pos_right);
+int litehtml::html_tag::floats_query_end( int saved )
+{
+	if(is_floats_holder())
+	{
+		int ret = m_floats_query;
+		floats_queried(saved);
+		m_floats_queries--;
+		return ret;
+	}
+	int ret = m_parent->floats_query_end(saved);
+	if(ret != INT_MIN && ret != INT_MAX)
+	{
+		ret -= m_pos.y;
+	}
+	return ret;
+}
 
-				if(pos_right - pos_left >= width)
-				{
-					new_top = (*i);
-					break;
-				}
-			}
-		}
-		return new_top;
+// An element was laid out with sizes from its previous layout, placing
+// the blocks around it again would change them. Only the holders placing
+// blocks are changed, the others may be laid out by other threads.
+void litehtml::html_tag::unstable_layout()
+{
+	if(is_floats_holder() && m_floats_queries)
+	{
+		m_floats_query = INT_MAX;
+	}
+	if(m_parent)
+	{
+		m_parent->unstable_layout();
 	}
-	int new_top = m_parent->find_next_line_top(top + m_pos.y, width, def_right + m_pos.x);
-	return new_top - m_pos.y;
 }
 
 void litehtml::html_tag::parse_background()
 {
+	background& bg = write_group(m_css_background)->bg;
+
 	// parse background-color
-	m_bg.m_color		= get_color(_t("background-color"), false, web_color(0, 0, 0, 0));
+	bg.m_color		= get_color(prop_background_color, false, web_color(0, 0, 0, 0));
 
 	// parse background-position
-	const tchar_t* str = get_style_property(_t("background-position"), false, _t("0% 0%"));
+	const tchar_t* str = get_style_property(prop_background_position, false, _t("0% 0%"));
 	if(str)
 	{
 		string_vector res;
@@ -1491,141 +1866,129 @@ void litehtml::html_tag::parse_background()
 			{
 				if( value_in_list(res[0].c_str(), _t("left;right;center")) )
 				{
-					m_bg.m_position.x.fromString(res[0], _t("left;right;center"));
-					m_bg.m_position.y.set_value(50, css_units_percentage);
+					bg.m_position.x.fromString(res[0], _t("left;right;center"));
+					bg.m_position.y.set_value(50, css_units_percentage);
 				} else if( value_in_list(res[0].c_str(), _t("top;bottom;center")) )
 				{
-					m_bg.m_position.y.fromString(res[0], _t("top;bottom;center"));
-					m_bg.m_position.x.set_value(50, css_units_percentage);
+					bg.m_position.y.fromString(res[0], _t("top;bottom;center"));
+					bg.m_position.x.set_value(50, css_units_percentage);
 				} else
 				{
-					m_bg.m_position.x.fromString(res[0], _t("left;right;center"));
-					m_bg.m_position.y.set_value(50, css_units_percentage);
+					bg.m_position.x.fromString(res[0], _t("left;right;center"));
+					bg.m_position.y.set_value(50, css_units_percentage);
 				}
 			} else
 			{
 				if(value_in_list(res[0].c_str(), _t("left;right")))
 				{
-					m_bg.m_position.x.fromString(res[0], _t("left;right;center"));
-					m_bg.m_position.y.fromString(res[1], _t("top;bottom;center"));
+					bg.m_position.x.fromString(res[0], _t("left;right;center"));
+					bg.m_position.y.fromString(res[1], _t("top;bottom;center"));
 				} else if(value_in_list(res[0].c_str(), _t("top;bottom")))
 				{
-					m_bg.m_position.x.fromString(res[1], _t("left;right;center"));
-					m_bg.m_position.y.fromString(res[0], _t("top;bottom;center"));
+					bg.m_position.x.fromString(res[1], _t("left;right;center"));
+					bg.m_position.y.fromString(res[0], _t("top;bottom;center"));
 				} else if(value_in_list(res[1].c_str(), _t("left;right")))
 				{
-					m_bg.m_position.x.fromString(res[1], _t("left;right;center"));
-					m_bg.m_position.y.fromString(res[0], _t("top;bottom;center"));
+					bg.m_position.x.fromString(res[1], _t("left;right;center"));
+					bg.m_position.y.fromString(res[0], _t("top;bottom;center"));
 				}else if(value_in_list(res[1].c_str(), _t("top;bottom")))
 				{
-					m_bg.m_position.x.fromString(res[0], _t("left;right;center"));
-					m_bg.m_position.y.fromString(res[1], _t("top;bottom;center"));
+					bg.m_position.x.fromString(res[0], _t("left;right;center"));
+					bg.m_position.y.fromString(res[1], _t("top;bottom;center"));
 				} else
 				{
-					m_bg.m_position.x.fromString(res[0], _t("left;right;center"));
-					m_bg.m_position.y.fromString(res[1], _t("top;bottom;center"));
+					bg.m_position.x.fromString(res[0], _t("left;right;center"));
+					bg.m_position.y.fromString(res[1], _t("top;bottom;center"));
 				}
 			}
 
-			if(m_bg.m_position.x.is_predefined())
+			if(bg.m_position.x.is_predefined())
 			{
-				switch(m_bg.m_position.x.predef())
+				switch(bg.m_position.x.predef())
 				{
 				case 0:
-					m_bg.m_position.x.set_value(0, css_units_percentage);
+					bg.m_position.x.set_value(0, css_units_percentage);
 					break;
 				case 1:
-					m_bg.m_position.x.set_value(100, css_units_percentage);
+					bg.m_position.x.set_value(100, css_units_percentage);
 					break;
 				case 2:
-					m_bg.m_position.x.set_value(50, css_units_percentage);
+					bg.m_position.x.set_value(50, css_units_percentage);
 					break;
 				}
 			}
-			if(m_bg.m_position.y.is_predefined())
+			if(bg.m_position.y.is_predefined())
 			{
-				switch(m_bg.m_position.y.predef())
+				switch(bg.m_position.y.predef())
 				{
 				case 0:
-					m_bg.m_position.y.set_value(0, css_units_percentage);
+					bg.m_position.y.set_value(0, css_units_percentage);
 					break;
 				case 1:
-					m_bg.m_position.y.set_value(100, css_units_percentage);
+					bg.m_position.y.set_value(100, css_units_percentage);
 					break;
 				case 2:
-					m_bg.m_position.y.set_value(50, css_units_percentage);
+					bg.m_position.y.set_value(50, css_units_percentage);
 					break;
 				}
 			}
 		} else
 		{
-			m_bg.m_position.x.set_value(0, css_units_percentage);
-			m_bg.m_position.y.set_value(0, css_units_percentage);
+			bg.m_position.x.set_value(0, css_units_percentage);
+			bg.m_position.y.set_value(0, css_units_percentage);
 		}
 	} else
 	{
-		m_bg.m_position.y.set_value(0, css_units_percentage);
-		m_bg.m_position.x.set_value(0, css_units_percentage);
+		bg.m_position.y.set_value(0, css_units_percentage);
+		bg.m_position.x.set_value(0, css_units_percentage);
 	}
 
-	str = get_style_property(_t("background-size"), false, _t("auto"));
+	str = get_style_property(prop_background_size, false, _t("auto"));
 	if(str)
 	{
 		string_vector res;
 		split_string(str, res, _t(" \t"));
 		if(!res.empty())
 		{
-			m_bg.m_position.width.fromString(res[0], background_size_strings);
+			bg.m_position.width.fromString(res[0], &background_size_keywords);
 			if(res.size() > 1)
 			{
-				m_bg.m_position.height.fromString(res[1], background_size_strings);
+				bg.m_position.height.fromString(res[1], &background_size_keywords);
 			} else
 			{
-				m_bg.m_position.height.predef(background_size_auto);
+				bg.m_position.height.predef(background_size_auto);
 			}
 		} else
 		{
-			m_bg.m_position.width.predef(background_size_auto);
-			m_bg.m_position.height.predef(background_size_auto);
+			bg.m_position.width.predef(background_size_auto);
+			bg.m_position.height.predef(background_size_auto);
 		}
 	}
 
-	m_doc->cvt_units(m_bg.m_position.x,			m_font_size);
-	m_doc->cvt_units(m_bg.m_position.y,			m_font_size);
-	m_doc->cvt_units(m_bg.m_position.width,		m_font_size);
-	m_doc->cvt_units(m_bg.m_position.height,	m_font_size);
+	m_doc->cvt_units(bg.m_position.x,			m_css_text->font_size);
+	m_doc->cvt_units(bg.m_position.y,			m_css_text->font_size);
+	m_doc->cvt_units(bg.m_position.width,		m_css_text->font_size);
+	m_doc->cvt_units(bg.m_position.height,	m_css_text->font_size);
 
 	// parse background_attachment
-	m_bg.m_attachment = (background_attachment) value_index(
-		get_style_property(_t("background-attachment"), false, _t("scroll")), 
-		background_attachment_strings, 
-		background_attachment_scroll);
+	bg.m_attachment = (background_attachment) get_style_keyword(prop_background_attachment, false, background_attachment_scroll);
 
 	// parse background_attachment
-	m_bg.m_repeat = (background_repeat) value_index(
-		get_style_property(_t("background-repeat"), false, _t("repeat")), 
-		background_repeat_strings, 
-		background_repeat_repeat);
+	bg.m_repeat = (background_repeat) get_style_keyword(prop_background_repeat, false, background_repeat_repeat);
 
 	// parse background_clip
-	m_bg.m_clip = (background_box) value_index(
-		get_style_property(_t("background-clip"), false, _t("border-box")), 
-		background_box_strings, 
-		background_box_border);
+	bg.m_clip = (background_box) get_style_keyword(prop_background_clip, false, background_box_border);
 
 	// parse background_origin
-	m_bg.m_origin = (background_box) value_index(
-		get_style_property(_t("background-origin"), false, _t("padding-box")), 
-		background_box_strings, 
-		background_box_content);
+	bg.m_origin = (background_box) get_style_keyword(prop_background_origin, false, background_box_content);
 
 	// parse background-image
-	css::parse_css_url(get_style_property(_t("background-image"), false, _t("")), m_bg.m_image);
-	m_bg.m_baseurl = get_style_property(_t("background-image-baseurl"), false, _t(""));
+	css::parse_css_url(get_style_property(prop_background_image, false, _t("")), bg.m_image);
+	bg.m_baseurl = get_style_property(prop_background_image_baseurl, false, _t(""));
 
-	if(!m_bg.m_image.empty())
+	if(!bg.m_image.empty())
 	{
-		m_doc->container()->load_image(m_bg.m_image.c_str(), m_bg.m_baseurl.empty() ? 0 : m_bg.m_baseurl.c_str(), true);
+		m_doc->container()->load_image(bg.m_image.c_str(), bg.m_baseurl.empty() ? 0 : bg.m_baseurl.c_str(), true);
 	}
 }
 
@@ -1642,24 +2005,24 @@ void litehtml::html_tag::add_positioned( element* el )
 
 void litehtml::html_tag::calc_outlines( int parent_width )
 {
-	m_padding.left	= m_css_padding.left.calc_percent(parent_width);
-	m_padding.right	= m_css_padding.right.calc_percent(parent_width);
+	m_padding.left	= m_css_box->padding.left.calc_percent(parent_width);
+	m_padding.right	= m_css_box->padding.right.calc_percent(parent_width);
 
-	m_borders.left	= m_css_borders.left.width.calc_percent(parent_width);
-	m_borders.right	= m_css_borders.right.width.calc_percent(parent_width);
+	m_borders.left	= m_css_border->borders.left.width.calc_percent(parent_width);
+	m_borders.right	= m_css_border->borders.right.width.calc_percent(parent_width);
 
-	m_margins.left	= m_css_margins.left.calc_percent(parent_width);
-	m_margins.right	= m_css_margins.right.calc_percent(parent_width);
+	m_margins.left	= m_css_box->margins.left.calc_percent(parent_width);
+	m_margins.right	= m_css_box->margins.right.calc_percent(parent_width);
 
-	m_margins.top		= m_css_margins.top.calc_percent(parent_width);
-	m_margins.bottom	= m_css_margins.bottom.calc_percent(parent_width);
+	m_margins.top		= m_css_box->margins.top.calc_percent(parent_width);
+	m_margins.bottom	= m_css_box->margins.bottom.calc_percent(parent_width);
 
-	m_padding.top		= m_css_padding.top.calc_percent(parent_width);
-	m_padding.bottom	= m_css_padding.bottom.calc_percent(parent_width);
+	m_padding.top		= m_css_box->padding.top.calc_percent(parent_width);
+	m_padding.bottom	= m_css_box->padding.bottom.calc_percent(parent_width);
 
 	if(m_display == display_block || m_display == display_table)
 	{
-		if(m_css_margins.left.is_predefined() && m_css_margins.right.is_predefined())
+		if(m_css_box->margins.left.is_predefined() && m_css_box->margins.right.is_predefined())
 		{
 			int el_width = m_pos.width + m_borders.left + m_borders.right + m_padding.left + m_padding.right;
 			if(el_width <= parent_width)
@@ -1671,12 +2034,12 @@ void litehtml::html_tag::calc_outlines( int parent_width )
 				m_margins.left	= 0;
 				m_margins.right	= 0;
 			}
-		} else if(m_css_margins.left.is_predefined() && !m_css_margins.right.is_predefined())
+		} else if(m_css_box->margins.left.is_predefined() && !m_css_box->margins.right.is_predefined())
 		{
 			int el_width = m_pos.width + m_borders.left + m_borders.right + m_padding.left + m_padding.right + m_margins.right;
 			m_margins.left	= parent_width - el_width;
 			if(m_margins.left < 0) m_margins.left = 0;
-		} else if(!m_css_margins.left.is_predefined() && m_css_margins.right.is_predefined())
+		} else if(!m_css_box->margins.left.is_predefined() && m_css_box->margins.right.is_predefined())
 		{
 			int el_width = m_pos.width + m_borders.left + m_borders.right + m_padding.left + m_padding.right + m_margins.left;
 			m_margins.right	= parent_width - el_width;
@@ -1706,7 +2069,7 @@ bool litehtml::html_tag::is_body()  const
 	return false;
 }
 
-void litehtml::html_tag::set_data( const tchar_t* data )
+void litehtml::html_tag::set_data( const tchar_t* data, size_t len )
 {
 
 }
@@ -1806,16 +2169,17 @@ bool litehtml::html_tag::on_mouse_over()
 
 bool litehtml::html_tag::find_styles_changes( position::vector& redraw_boxes, int x, int y )
 {
-	if(m_display == display_inline_text)
+	if(m_display == display_inline_text || !has_dynamic_styles())
 	{
 		return false;
 	}
 
 	bool ret = false;
 	bool apply = false;
-	for (used_selector::vector::iterator iter = m_used_styles.begin(); iter != m_used_styles.end() && !apply; iter++)
+	for (used_selector::vector::iterator iter = m_used_styles.begin(); iter != m_used_styles.end() && m_dynamic_styles && !apply; iter++)
 	{
-		if((*iter)->m_selector->is_media_valid())
+		// other selectors give the same result as in apply_stylesheet()
+		if((*iter)->m_dynamic && (*iter)->m_selector->is_media_valid())
 		{
 			int res = select(*((*iter)->m_selector), true);
 			if( (res == select_no_match && (*iter)->m_used) || (res == select_match && !(*iter)->m_used) )
@@ -1853,8 +2217,9 @@ bool litehtml::html_tag::find_styles_changes( position::vector& redraw_boxes, in
 		ret = true;
 		refresh_styles();
 		parse_styles();
+		m_doc->flush_text_widths();
 	}
-	for(elements_vector::iterator i = m_children.begin(); i != m_children.end(); i++)
+	for(elements_vector::iterator i = m_children.begin(); i != m_children.end() && m_dynamic_children; i++)
 	{
 		if(!(*i)->skip())
 		{
@@ -1876,6 +2241,11 @@ bool litehtml::html_tag::find_styles_changes( position::vector& redraw_boxes, in
 	return ret;
 }
 
+bool litehtml::html_tag::has_dynamic_styles() const
+{
+	return m_dynamic_styles || m_dynamic_children;
+}
+
 bool litehtml::html_tag::on_mouse_leave()
 {
 	bool ret = false;
@@ -1925,7 +2295,7 @@ void litehtml::html_tag::on_click()
 
 const litehtml::tchar_t* litehtml::html_tag::get_cursor()
 {
-	return get_style_property(_t("cursor"), true, 0);
+	return get_style_property(prop_cursor, true, 0);
 }
 
 static const int font_size_table[8][7] =
@@ -1943,8 +2313,10 @@ static const int font_size_table[8][7] =
 
 void litehtml::html_tag::init_font()
 {
+	computed_text* text = write_group(m_css_text);
+
 	// initialize font size
-	const tchar_t* str = get_style_property(_t("font-size"), false, 0);
+	const property_value* val = get_style_value(prop_font_size, false);
 
 	int parent_sz = 0;
 	int doc_font_size = m_doc->container()->get_default_font_size();
@@ -1957,15 +2329,14 @@ void litehtml::html_tag::init_font()
 	}
 
 
-	if(!str)
+	if(!val)
 	{
-		m_font_size = parent_sz;
+		text->font_size = parent_sz;
 	} else
 	{
-		m_font_size = parent_sz;
+		text->font_size = parent_sz;
 
-		css_length sz;
-		sz.fromString(str, font_size_strings);
+		css_length sz = val->m_length;
 		if(sz.is_predefined())
 		{
 			int idx_in_table = doc_font_size - 9;
@@ -1973,35 +2344,35 @@ void litehtml::html_tag::init_font()
 			{
 				if(sz.predef() >= fontSize_xx_small && sz.predef() <= fontSize_xx_large)
 				{
-					m_font_size = font_size_table[idx_in_table][sz.predef()];
+					text->font_size = font_size_table[idx_in_table][sz.predef()];
 				} else
 				{
-					m_font_size = doc_font_size;
+					text->font_size = doc_font_size;
 				}
 			} else			
 			{
 				switch(sz.predef())
 				{
 				case fontSize_xx_small:
-					m_font_size = doc_font_size * 3 / 5;
+					text->font_size = doc_font_size * 3 / 5;
 					break;
 				case fontSize_x_small:
-					m_font_size = doc_font_size * 3 / 4;
+					text->font_size = doc_font_size * 3 / 4;
 					break;
 				case fontSize_small:
-					m_font_size = doc_font_size * 8 / 9;
+					text->font_size = doc_font_size * 8 / 9;
 					break;
 				case fontSize_large:
-					m_font_size = doc_font_size * 6 / 5;
+					text->font_size = doc_font_size * 6 / 5;
 					break;
 				case fontSize_x_large:
-					m_font_size = doc_font_size * 3 / 2;
+					text->font_size = doc_font_size * 3 / 2;
 					break;
 				case fontSize_xx_large:
-					m_font_size = doc_font_size * 2;
+					text->font_size = doc_font_size * 2;
 					break;
 				default:
-					m_font_size = doc_font_size;
+					text->font_size = doc_font_size;
 					break;
 				}
 			}
@@ -2009,24 +2380,24 @@ void litehtml::html_tag::init_font()
 		{
 			if(sz.units() == css_units_percentage)
 			{
-				m_font_size = sz.calc_percent(parent_sz);
+				text->font_size = sz.calc_percent(parent_sz);
 			} else if(sz.units() == css_units_none)
 			{
-				m_font_size = parent_sz;
+				text->font_size = parent_sz;
 			} else
 			{
-				m_font_size = m_doc->cvt_units(sz, parent_sz);
+				text->font_size = m_doc->cvt_units(sz, parent_sz);
 			}
 		}
 	}
 
 	// initialize font
-	const tchar_t* name			= get_style_property(_t("font-family"),		true,	_t("inherit"));
-	const tchar_t* weight		= get_style_property(_t("font-weight"),		true,	_t("normal"));
-	const tchar_t* style		= get_style_property(_t("font-style"),		true,	_t("normal"));
-	const tchar_t* decoration	= get_style_property(_t("text-decoration"),	true,	_t("none"));
+	const tchar_t* name			= get_style_property(prop_font_family,		true,	_t("inherit"));
+	const tchar_t* weight		= get_style_property(prop_font_weight,		true,	_t("normal"));
+	const tchar_t* style		= get_style_property(prop_font_style,		true,	_t("normal"));
+	const tchar_t* decoration	= get_style_property(prop_text_decoration,	true,	_t("none"));
 
-	m_font = m_doc->get_font(name, m_font_size, weight, style, decoration, &m_font_metrics);
+	text->font = m_doc->get_font(name, text->font_size, weight, style, decoration, &text->metrics);
 }
 
 bool litehtml::html_tag::is_break() const
@@ -2042,7 +2413,7 @@ void litehtml::html_tag::set_tagName( const tchar_t* tag )
 	{
 		s_val[i] = std::tolower(s_val[i], lc);
 	}
-	m_tag = s_val;
+	m_tag = m_doc->atoms().get(s_val.c_str());
 }
 
 void litehtml::html_tag::draw_background( uint_ptr hdc, int x, int y, const position* clip )
@@ -2070,7 +2441,7 @@ void litehtml::html_tag::draw_background( uint_ptr hdc, int x, int y, const posi
 			position border_box = pos;
 			border_box += m_padding;
 			border_box += m_borders;
-			m_doc->container()->draw_borders(hdc, m_css_borders, border_box, parent() ? false : true);
+			m_doc->container()->draw_borders(hdc, m_css_border->borders, border_box, parent() ? false : true);
 		}
 	} else
 	{
@@ -2103,31 +2474,31 @@ void litehtml::html_tag::draw_background( uint_ptr hdc, int x, int y, const posi
 				// set left borders radius for the first box
 				if(box == boxes.begin())
 				{
-					bdr.radius.bottom_left_x	= m_css_borders.radius.bottom_left_x;
-					bdr.radius.bottom_left_y	= m_css_borders.radius.bottom_left_y;
-					bdr.radius.top_left_x		= m_css_borders.radius.top_left_x;
-					bdr.radius.top_left_y		= m_css_borders.radius.top_left_y;
+					bdr.radius.bottom_left_x	= m_css_border->borders.radius.bottom_left_x;
+					bdr.radius.bottom_left_y	= m_css_border->borders.radius.bottom_left_y;
+					bdr.radius.top_left_x		= m_css_border->borders.radius.top_left_x;
+					bdr.radius.top_left_y		= m_css_border->borders.radius.top_left_y;
 				}
 
 				// set right borders radius for the last box
 				if(box == boxes.end() - 1)
 				{
-					bdr.radius.bottom_right_x	= m_css_borders.radius.bottom_right_x;
-					bdr.radius.bottom_right_y	= m_css_borders.radius.bottom_right_y;
-					bdr.radius.top_right_x		= m_css_borders.radius.top_right_x;
-					bdr.radius.top_right_y		= m_css_borders.radius.top_right_y;
+					bdr.radius.bottom_right_x	= m_css_border->borders.radius.bottom_right_x;
+					bdr.radius.bottom_right_y	= m_css_border->borders.radius.bottom_right_y;
+					bdr.radius.top_right_x		= m_css_border->borders.radius.top_right_x;
+					bdr.radius.top_right_y		= m_css_border->borders.radius.top_right_y;
 				}
 
 				
-				bdr.top		= m_css_borders.top;
-				bdr.bottom	= m_css_borders.bottom;
+				bdr.top		= m_css_border->borders.top;
+				bdr.bottom	= m_css_border->borders.bottom;
 				if(box == boxes.begin())
 				{
-					bdr.left	= m_css_borders.left;
+					bdr.left	= m_css_border->borders.left;
 				}
 				if(box == boxes.end() - 1)
 				{
-					bdr.right	= m_css_borders.right;
+					bdr.right	= m_css_border->borders.right;
 				}
 
 
@@ -2145,6 +2516,8 @@ void litehtml::html_tag::draw_background( uint_ptr hdc, int x, int y, const posi
 
 int litehtml::html_tag::render_inline( element* container, int max_width )
 {
+	m_dirty = 0;
+
 	int ret_width = 0;
 	int rw = 0;
 	for(elements_vector::iterator i = m_children.begin(); i != m_children.end(); i++)
@@ -2224,7 +2597,7 @@ int litehtml::html_tag::place_element( element* el, int max_width )
 				el->m_pos.y = new_top + el->content_margins_top();
 			}
 			add_float(el, 0, 0);
-			ret_width = fix_line_width(max_width, float_left);
+			ret_width = fix_line_width(max_width, float_left, el->top());
 			if(!ret_width)
 			{
 				ret_width = el->right();
@@ -2261,7 +2634,7 @@ int litehtml::html_tag::place_element( element* el, int max_width )
 				el->m_pos.x = line_right - el->width() + el->content_margins_left();
 			}
 			add_float(el, 0, 0);
-			ret_width = fix_line_width(max_width, float_right);
+			ret_width = fix_line_width(max_width, float_right, el->top());
 
 			if(!ret_width)
 			{
@@ -2275,6 +2648,13 @@ int litehtml::html_tag::place_element( element* el, int max_width )
 		break;
 	default:
 		{
+			// blocks remember the floats they looked at, see fix_line_width()
+			int floats_mark = 0;
+			if(!el->is_inline_box())
+			{
+				floats_mark = floats_query_begin();
+			}
+
 			int line_top = 0;
 			if(!m_boxes.empty())
 			{
@@ -2312,6 +2692,11 @@ int litehtml::html_tag::place_element( element* el, int max_width )
 				break;
 			}
 
+			// new_box() and the margins collapsing below use the sizes el got
+			// from its previous layout
+			int placed_width	= el->width();
+			int placed_margin	= el->margin_top();
+
 			bool add_box = true;
 			if(!m_boxes.empty())
 			{
@@ -2390,9 +2775,25 @@ int litehtml::html_tag::place_element( element* el, int max_width )
 
 			m_boxes.back()->add_element(el);
 
-			if(el->is_inline_box() && !el->skip())
+			if(el->is_inline_box())
+			{
+				if(!el->skip())
+				{
+					ret_width = el->right() + (max_width - line_right);
+				}
+			} else
 			{
-				ret_width = el->right() + (max_width - line_right);
+				int floats_query = floats_query_end(floats_mark);
+				if(el->margin_top() != placed_margin || (el->is_floats_holder() && el->width() != placed_width))
+				{
+					// placed again, el and its parents would get another layout
+					floats_query = INT_MAX;
+					unstable_layout();
+				}
+				if(m_boxes.back()->get_type() == box_block)
+				{
+					((block_box*) (box*) m_boxes.back())->set_placement(ret_width, floats_query);
+				}
 			}
 		}
 		break;
@@ -2425,7 +2826,7 @@ bool litehtml::html_tag::set_pseudo_class( const tchar_t* pclass, bool add )
 
 int litehtml::html_tag::line_height() const
 {
-	return m_line_height;
+	return m_css_text->line_height;
 }
 
 bool litehtml::html_tag::is_replaced() const
@@ -2463,6 +2864,7 @@ int litehtml::html_tag::new_box( element* el, int max_width )
 	int line_right	= max_width;
 	get_line_left_right(line_top, max_width, line_left, line_right);
 
+	arena* owner = m_doc->get_arena();
 	if(el->is_inline_box() || el->is_floats_holder())
 	{
 		if(el->width() > line_right - line_left)
@@ -2475,7 +2877,7 @@ int litehtml::html_tag::new_box( element* el, int max_width )
 	}
 
 	int first_line_margin = 0;
-	if(m_boxes.empty() && m_list_style_type != list_style_type_none && m_list_style_position == list_style_position_inside)
+	if(m_boxes.empty() && m_css_text->list_type != list_style_type_none && m_css_text->list_position == list_style_position_inside)
 	{
 		int sz_font = get_font_size();
 		first_line_margin = sz_font;
@@ -2484,7 +2886,7 @@ int litehtml::html_tag::new_box( element* el, int max_width )
 	if(el->is_inline_box())
 	{
 		int text_indent = 0;
-		if(m_css_text_indent.val() != 0)
+		if(m_css_text->text_indent.val() != 0)
 		{
 			bool line_box_found = false;
 			for(box::vector::iterator iter = m_boxes.begin(); iter != m_boxes.end(); iter++)
@@ -2497,17 +2899,17 @@ int litehtml::html_tag::new_box( element* el, int max_width )
 			}
 			if(!line_box_found)
 			{
-				text_indent = m_css_text_indent.calc_percent(max_width);
+				text_indent = m_css_text->text_indent.calc_percent(max_width);
 			}
 		}
 
 		font_metrics fm;
 		get_font(&fm);
-		line_box* lb = new line_box(line_top, line_left + first_line_margin + text_indent, line_right, line_height(), fm, m_text_align);
+		line_box* lb = placed(new (owner) line_box(line_top, line_left + first_line_margin + text_indent, line_right, line_height(), fm, m_text_align), owner);
 		m_boxes.push_back(lb);
 	} else
 	{
-		block_box* bb = new block_box(line_top, line_left, line_right);
+		block_box* bb = placed(new (owner) block_box(line_top, line_left, line_right), owner);
 		m_boxes.push_back(bb);
 	}
 
@@ -2653,28 +3055,28 @@ litehtml::vertical_align litehtml::html_tag::get_vertical_align() const
 
 litehtml::css_length litehtml::html_tag::get_css_left() const
 {
-	return m_css_offsets.left;
+	return m_css_position->offsets.left;
 }
 
 litehtml::css_length litehtml::html_tag::get_css_right() const
 {
-	return m_css_offsets.right;
+	return m_css_position->offsets.right;
 }
 
 litehtml::css_length litehtml::html_tag::get_css_top() const
 {
-	return m_css_offsets.top;
+	return m_css_position->offsets.top;
 }
 
 litehtml::css_length litehtml::html_tag::get_css_bottom() const
 {
-	return m_css_offsets.bottom;
+	return m_css_position->offsets.bottom;
 }
 
 
 litehtml::css_offsets litehtml::html_tag::get_css_offsets() const
 {
-	return m_css_offsets;
+	return m_css_position->offsets;
 }
 
 litehtml::element_clear litehtml::html_tag::get_clear() const
@@ -2684,12 +3086,12 @@ litehtml::element_clear litehtml::html_tag::get_clear() const
 
 litehtml::css_length litehtml::html_tag::get_css_width() const
 {
-	return m_css_width;
+	return m_css_box->width;
 }
 
 litehtml::css_length litehtml::html_tag::get_css_height() const
 {
-	return m_css_height;
+	return m_css_box->height;
 }
 
 size_t litehtml::html_tag::get_children_count() const
@@ -2704,7 +3106,7 @@ litehtml::element::ptr litehtml::html_tag::get_child( int idx ) const
 
 void litehtml::html_tag::set_css_width( css_length& w )
 {
-	m_css_width = w;
+	write_group(m_css_box)->width = w;
 }
 
 void litehtml::html_tag::apply_vertical_align()
@@ -2744,7 +3146,7 @@ litehtml::element_position litehtml::html_tag::get_element_position(css_offsets*
 {
 	if(offsets && m_el_position != element_position_static)
 	{
-		*offsets = m_css_offsets;
+		*offsets = m_css_position->offsets;
 	}
 	return m_el_position;
 }
@@ -2849,7 +3251,7 @@ void litehtml::html_tag::init_background_paint( position pos, background_paint &
 		}
 
 	}
-	bg_paint.border_radius	= m_css_borders.radius;
+	bg_paint.border_radius	= m_css_border->borders.radius;
 	bg_paint.border_box		= border_box;
 	bg_paint.is_root		= parent() ? false : true;
 }
@@ -2863,12 +3265,12 @@ void litehtml::html_tag::draw_list_marker( uint_ptr hdc, const position &pos )
 {
 	list_marker lm;
 
-	const tchar_t* list_image = get_style_property(_t("list-style-image"), true, 0);
+	const tchar_t* list_image = get_style_property(prop_list_style_image, true, 0);
 	size img_size;
 	if(list_image)
 	{
 		css::parse_css_url(list_image, lm.image);
-		lm.baseurl = get_style_property(_t("list-style-image-baseurl"), true, 0);
+		lm.baseurl = get_style_property(prop_list_style_image_baseurl, true, 0);
 		m_doc->container()->get_image_size(lm.image.c_str(), lm.baseurl, img_size);
 	} else
 	{
@@ -2897,13 +3299,13 @@ void litehtml::html_tag::draw_list_marker( uint_ptr hdc, const position &pos )
 		lm.pos.width	= img_size.width;
 		lm.pos.height	= img_size.height;
 	}
-	if(m_list_style_position == list_style_position_outside)
+	if(m_css_text->list_position == list_style_position_outside)
 	{
 		lm.pos.x -= sz_font;
 	}
 
-	lm.color = get_color(_t("color"), true, web_color(0, 0, 0));
-	lm.marker_type = m_list_style_type;
+	lm.color = get_color(prop_color, true, web_color(0, 0, 0));
+	lm.marker_type = m_css_text->list_type;
 	m_doc->container()->draw_list_marker(hdc, lm);
 }
 
@@ -3027,7 +3429,7 @@ bool litehtml::html_tag::fetch_positioned()
 
 int litehtml::html_tag::get_zindex() const
 {
-	return m_z_index;
+	return m_css_position->z_index;
 }
 
 void litehtml::html_tag::render_positioned(render_type rt)
@@ -3514,32 +3916,25 @@ void litehtml::html_tag::update_floats( int dy, element* parent )
 {
 	if(is_floats_holder())
 	{
-		bool reset_cache = false;
-		for(floated_box::vector::reverse_iterator fb = m_floats_left.rbegin(); fb != m_floats_left.rend(); fb++)
+		if(parent == this)
 		{
-			if(fb->el->is_ancestor(parent))
+			if(m_float_bands.empty())
 			{
-				reset_cache	= true;
-				fb->pos.y	+= dy;
+				return;
 			}
-		}
-		if(reset_cache)
-		{
-			m_cahe_line_left.invalidate();
-		}
-		reset_cache = false;
-		for(floated_box::vector::reverse_iterator fb = m_floats_right.rbegin(); fb != m_floats_right.rend(); fb++)
+			// the bands move as a whole
+			m_float_bands.shift(dy);
+		} else
 		{
-			if(fb->el->is_ancestor(parent))
+			// the floats in parent move with its origin
+			if(!m_float_bands.is_origin(parent->m_float_origin, parent))
 			{
-				reset_cache	= true;
-				fb->pos.y	+= dy;
+				return;
 			}
+			m_float_bands.move_origin(parent->m_float_origin, dy);
 		}
-		if(reset_cache)
-		{
-			m_cahe_line_right.invalidate();
-		}
+		m_cahe_line_left.invalidate();
+		m_cahe_line_right.invalidate();
 	} else
 	{
 		m_parent->update_floats(dy, parent);
@@ -3553,6 +3948,7 @@ void litehtml::html_tag::remove_before_after()
 		if( !t_strcmp(m_children.front()->get_tagName(), _t("::before")) )
 		{
 			m_children.erase(m_children.begin());
+			set_layout_dirty();
 		}
 	}
 	if(!m_children.empty())
@@ -3560,6 +3956,7 @@ void litehtml::html_tag::remove_before_after()
 		if( !t_strcmp(m_children.back()->get_tagName(), _t("::after")) )
 		{
 			m_children.erase(m_children.end() - 1);
+			set_layout_dirty();
 		}
 	}
 }
@@ -3573,9 +3970,11 @@ litehtml::element* litehtml::html_tag::get_element_before()
 			return m_children.front();
 		}
 	}
-	element* el = new el_before(m_doc);
+	arena* owner = m_doc->get_arena();
+	element* el = placed(new (owner) el_before(m_doc), owner);
 	el->parent(this);
 	m_children.insert(m_children.begin(), el);
+	set_layout_dirty();
 	return el;
 }
 
@@ -3588,9 +3987,11 @@ litehtml::element* litehtml::html_tag::get_element_after()
 			return m_children.back();
 		}
 	}
-	element* el = new el_after(m_doc);
+	arena* owner = m_doc->get_arena();
+	element* el = placed(new (owner) el_after(m_doc), owner);
 	el->parent(this);
 	m_children.push_back(el);
+	set_layout_dirty();
 	return el;
 }
 
@@ -3627,6 +4028,9 @@ void litehtml::html_tag::refresh_styles()
 	}
 
 	m_style.clear();
+	m_style_id		= -1;
+	m_style_source	= 0;
+	m_dirty			|= dirty_style;
 
 	for(litehtml::used_selector::vector::iterator sel = m_used_styles.begin(); sel != m_used_styles.end(); sel++)
 	{
@@ -3854,14 +4258,14 @@ litehtml::background* litehtml::html_tag::get_background(bool own_only)
 	if(own_only)
 	{
 		// return own background with check for empty one
-		if(m_bg.m_image.empty() && !m_bg.m_color.alpha)
+		if(m_css_background->bg.m_image.empty() && !m_css_background->bg.m_color.alpha)
 		{
 			return 0;
 		}
-		return &m_bg;
+		return &m_css_background->bg;
 	}
 
-	if(m_bg.m_image.empty() && !m_bg.m_color.alpha)
+	if(m_css_background->bg.m_image.empty() && !m_css_background->bg.m_color.alpha)
 	{
 		// if this is root element (<html>) try to get background from body
 		if(!parent())
@@ -3887,5 +4291,5 @@ litehtml::background* litehtml::html_tag::get_background(bool own_only)
 		}
 	}
 
-	return &m_bg;
+	return &m_css_background->bg;
 }
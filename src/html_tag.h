@@ -6,12 +6,47 @@
 #include "background.h"
 #include "css_margins.h"
 #include "borders.h"
+#include "computed_style.h"
 #include "css_selector.h"
 #include "stylesheet.h"
 #include "box.h"
+#include "float_bands.h"
 
 namespace litehtml
 {
+	// html_tag values the layout depends on, see html_tag::parse_styles()
+	struct layout_style
+	{
+		computed_box::ptr		box;
+		computed_border::ptr	border;
+		computed_text::ptr		text;
+		computed_position::ptr	offsets;
+		style_display			display;
+		element_float			floating;
+		element_clear			clear;
+		element_position		placement;
+		overflow				content_overflow;
+		white_space				spaces;
+		text_align				align;
+		vertical_align			valign;
+		box_sizing				sizing;
+	};
+
+	// result of the last html_tag::render() call, see html_tag::reuse_layout()
+	struct layout_memo
+	{
+		int			max_width;		// -1 if there is no result
+		int			generation;		// document::layout_generation() of the result
+		bool		fixed_width;	// the result is the same for any max_width
+		bool		second_pass;
+		int			ret_width;
+		int			width;
+		int			height;
+		margins		margin;
+		margins		padding;
+		margins		border;
+	};
+
 	class html_tag : public element
 	{
 		friend class elements_iterator;
@@ -24,52 +59,43 @@ namespace litehtml
 	protected:
 		elements_vector			m_children;
 		box::vector				m_boxes;
-		tstring					m_id;
-		tstring					m_class;
-		tstring					m_tag;
+		atom					m_id;			// lowercase, see set_attr()
+		std::vector<atom>		m_classes;		// lowercase
+		atom					m_tag;
 		litehtml::style			m_style;
-		string_map				m_attrs;
+		int						m_style_id;		// equal ids mean equal m_style, -1 if not shared
+		html_tag*				m_style_source;	// m_style was copied from it in the last cascade pass
+		attr_list				m_attrs;
 		vertical_align			m_vertical_align;
 		text_align				m_text_align;
 		style_display			m_display;
-		list_style_type			m_list_style_type;
-		list_style_position		m_list_style_position;
 		white_space				m_white_space;
 		element_float			m_float;
 		element_clear			m_clear;
-		floated_box::vector		m_floats_left;
-		floated_box::vector		m_floats_right;
+		float_bands				m_float_bands;	// the floats of a floats holder
+		int						m_floats_query;	// the bottom y the floats were looked at, see floats_query_begin()
+		int						m_floats_queries;	// open floats_query_begin() calls
 		elements_vector			m_positioned;
-		background				m_bg;
 		element_position		m_el_position;
-		int						m_line_height;
-		bool					m_lh_predefined;
 		string_vector			m_pseudo_classes;
 		used_selector::vector	m_used_styles;		
+		bool					m_dynamic_styles;	// some of m_used_styles depend on pseudo classes
+		bool					m_dynamic_children;	// has_dynamic_styles() is true for a child
 		
-		uint_ptr				m_font;
-		int						m_font_size;
-		font_metrics			m_font_metrics;
-
-		css_margins				m_css_margins;
-		css_margins				m_css_padding;
-		css_borders				m_css_borders;
-		css_length				m_css_width;
-		css_length				m_css_height;
-		css_length				m_css_min_width;
-		css_length				m_css_min_height;
-		css_length				m_css_max_width;
-		css_length				m_css_max_height;
-		css_offsets				m_css_offsets;
-		css_length				m_css_text_indent;
+		// computed values, shared with other elements (see computed_style.h)
+		computed_box::ptr			m_css_box;
+		computed_border::ptr		m_css_border;
+		computed_background::ptr	m_css_background;
+		computed_text::ptr			m_css_text;
+		computed_position::ptr		m_css_position;
 
 		overflow				m_overflow;
 		visibility				m_visibility;
-		int						m_z_index;
 		box_sizing				m_box_sizing;
 
 		int_int_cache			m_cahe_line_left;
 		int_int_cache			m_cahe_line_right;
+		layout_memo				m_layout;
 	public:
 		html_tag(litehtml::document* doc);
 		virtual ~html_tag();
@@ -91,7 +117,7 @@ namespace litehtml
 		virtual bool				appendChild(litehtml::element* el);
 		virtual const tchar_t*		get_tagName() const;
 		virtual void				set_tagName(const tchar_t* tag);
-		virtual void				set_data(const tchar_t* data);
+		virtual void				set_data(const tchar_t* data, size_t len);
 		virtual element_float		get_float() const;
 		virtual vertical_align		get_vertical_align() const;
 		virtual css_length			get_css_left() const;
@@ -108,9 +134,12 @@ namespace litehtml
 		virtual element_position	get_element_position(css_offsets* offsets = 0) const;
 		virtual overflow			get_overflow() const;
 
-		virtual void				set_attr(const tchar_t* name, const tchar_t* val);
+		using element::set_attr;
+		virtual void				set_attr(const tchar_t* name, const tchar_t* val, size_t val_len);
 		virtual const tchar_t*		get_attr(const tchar_t* name, const tchar_t* def = 0);
-		virtual void				apply_stylesheet(const litehtml::css& stylesheet);
+		const tchar_t*				get_attr(atom name, const tchar_t* def = 0) const;
+		virtual void				apply_stylesheet(const litehtml::css& stylesheet, const ancestor_filter& parents);
+		virtual void				match_stylesheet(const litehtml::css& stylesheet, const ancestor_filter& parents, cascade_task& task, bool subtree);
 		virtual void				refresh_styles();
 
 		virtual bool				is_white_space();
@@ -123,6 +152,7 @@ namespace litehtml
 		virtual bool				on_lbutton_up();
 		virtual void				on_click();
 		virtual bool				find_styles_changes(position::vector& redraw_boxes, int x, int y);
+		virtual bool				has_dynamic_styles() const;
 		virtual const tchar_t*		get_cursor();
 		virtual void				init_font();
 		virtual bool				set_pseudo_class(const tchar_t* pclass, bool add);
@@ -135,7 +165,8 @@ namespace litehtml
 		virtual void				draw(uint_ptr hdc, int x, int y, const position* clip);
 		virtual void				draw_background( uint_ptr hdc, int x, int y, const position* clip );
 
-		virtual const tchar_t*		get_style_property(const tchar_t* name, bool inherited, const tchar_t* def = 0);
+		virtual const property_value*	get_style_value(property_id id, bool inherited);
+		virtual const property_value*	get_style_value(const tchar_t* name, bool inherited);
 		virtual uint_ptr			get_font(font_metrics* fm = 0);
 		virtual int					get_font_size() const;
 
@@ -161,9 +192,9 @@ namespace litehtml
 		virtual void				init();
 		virtual void				get_inline_boxes(position::vector& boxes);
 		virtual bool				is_floats_holder() const;
-		virtual int					get_floats_height(element_float el_float = float_none) const;
-		virtual int					get_left_floats_height() const;
-		virtual int					get_right_floats_height() const;
+		virtual int					get_floats_height(element_float el_float = float_none);
+		virtual int					get_left_floats_height();
+		virtual int					get_right_floats_height();
 		virtual int					get_line_left(int y);
 		virtual int					get_line_right(int y, int def_right);
 		virtual void				get_line_left_right(int y, int def_right, int& ln_left, int& ln_right);
@@ -171,6 +202,11 @@ namespace litehtml
 		virtual void				update_floats(int dy, element* parent);
 		virtual void				add_positioned(element* el);
 		virtual int					find_next_line_top(int top, int width, int def_right);
+		virtual int					floats_query_begin();
+		virtual int					floats_query_end(int saved);
+		virtual void				unstable_layout();
+		virtual void				find_prelayout(elements_vector& els);
+		virtual int					text_lines() const;
 		virtual void				apply_vertical_align();
 		virtual void				draw_children( uint_ptr hdc, int x, int y, const position* clip, draw_flag flag, int zindex );
 		virtual int					get_zindex() const;
@@ -187,14 +223,28 @@ namespace litehtml
 		virtual background*			get_background(bool own_only = false);
 
 	protected:
-		int							fix_line_width(int max_width, element_float flt);
+		int							fix_line_width(int max_width, element_float flt, int float_top);
 		void						parse_background();
 		void						init_background_paint( position pos, background_paint &bg_paint, background* bg );
 		void						draw_list_marker( uint_ptr hdc, const position &pos );
 		void						parse_nth_child_params( tstring param, int &num, int &off );
 		void						remove_before_after();
+		void						apply_styles(const style::vector& applied);
+		void						parse_computed_style();
+		void						copy_computed_style(const html_tag& src);
+		void						match_selectors(const litehtml::css& stylesheet, const ancestor_filter& parents, selector_match::vector& res, cascade_stats& stats, bool defer_siblings);
 		litehtml::element*			get_element_before();
 		litehtml::element*			get_element_after();
+		void						set_layout_dirty();
+		void						get_layout_style(layout_style& ls) const;
+		bool						same_layout_style(const layout_style& ls) const;
+		bool						reuse_layout(int x, int y, int max_width, bool second_pass, int& ret_width);
+		bool						has_fixed_width() const;
+		bool						has_percentage_outlines() const;
+		void						save_layout(int max_width, bool second_pass, int ret_width);
+		bool						can_keep_layout() const;
+		void						floats_queried(int y);
+		int							float_origin(element* el);
 	};
 
 	/************************************************************************/
@@ -206,6 +256,14 @@ namespace litehtml
 		return m_children;
 	}
 
+	inline void litehtml::html_tag::floats_queried(int y)
+	{
+		if(y > m_floats_query)
+		{
+			m_floats_query = y;
+		}
+	}
+
 	class element_zindex_sort
 	{
 	public:
@@ -0,0 +1,500 @@
+#include "html.h"
+#include "keywords.h"
+#ifndef NDEBUG
+#include <assert.h>
+#endif
+
+// Generated from the *_strings lists in types.h, keep in sync with them.
+
+static const litehtml::keyword g_style_display[] =
+{
+	{ _t("none"),				4,	0 },
+	{ _t("block"),				5,	1 },
+	{ _t("table"),				5,	5 },
+	{ _t("inline"),				6,	2 },
+	{ _t("list-item"),			9,	4 },
+	{ _t("table-row"),			9,	12 },
+	{ _t("table-cell"),			10,	7 },
+	{ _t("inline-block"),		12,	3 },
+	{ _t("table-column"),		12,	8 },
+	{ _t("table-caption"),		13,	6 },
+	{ _t("table-row-group"),	15,	13 },
+	{ _t("table-column-group"),	18,	9 },
+	{ _t("table-footer-group"),	18,	10 },
+	{ _t("table-header-group"),	18,	11 },
+};
+
+static const litehtml::keyword g_font_size[] =
+{
+	{ _t("large"),		5,	4 },
+	{ _t("small"),		5,	2 },
+	{ _t("larger"),		6,	8 },
+	{ _t("medium"),		6,	3 },
+	{ _t("smaller"),	7,	7 },
+	{ _t("x-large"),	7,	5 },
+	{ _t("x-small"),	7,	1 },
+	{ _t("xx-large"),	8,	6 },
+	{ _t("xx-small"),	8,	0 },
+};
+
+static const litehtml::keyword g_font_style[] =
+{
+	{ _t("italic"),	6,	1 },
+	{ _t("normal"),	6,	0 },
+};
+
+static const litehtml::keyword g_font_variant[] =
+{
+	{ _t("normal"),		6,	0 },
+	{ _t("small-caps"),	10,	1 },
+};
+
+static const litehtml::keyword g_font_weight[] =
+{
+	{ _t("200"),		3,	4 },
+	{ _t("300"),		3,	5 },
+	{ _t("400"),		3,	6 },
+	{ _t("500"),		3,	7 },
+	{ _t("600"),		3,	8 },
+	{ _t("700"),		3,	9 },
+	{ _t("bold"),		4,	1 },
+	{ _t("bolder"),		6,	2 },
+	{ _t("normal"),		6,	0 },
+	{ _t("lighter100"),	10,	3 },
+};
+
+static const litehtml::keyword g_list_style_type[] =
+{
+	{ _t("disc"),					4,	2 },
+	{ _t("none"),					4,	0 },
+	{ _t("circle"),					6,	1 },
+	{ _t("hebrew"),					6,	9 },
+	{ _t("square"),					6,	3 },
+	{ _t("decimal"),				7,	6 },
+	{ _t("armenian"),				8,	4 },
+	{ _t("georgian"),				8,	8 },
+	{ _t("hiragana"),				8,	10 },
+	{ _t("katakana"),				8,	12 },
+	{ _t("lower-alpha"),			11,	14 },
+	{ _t("lower-greek"),			11,	15 },
+	{ _t("lower-latin"),			11,	16 },
+	{ _t("lower-roman"),			11,	17 },
+	{ _t("upper-alpha"),			11,	18 },
+	{ _t("upper-latin"),			11,	19 },
+	{ _t("upper-roman"),			11,	20 },
+	{ _t("hiragana-iroha"),			14,	11 },
+	{ _t("katakana-iroha"),			14,	13 },
+	{ _t("cjk-ideographic"),		15,	5 },
+	{ _t("decimal-leading-zero"),	20,	7 },
+};
+
+static const litehtml::keyword g_list_style_position[] =
+{
+	{ _t("inside"),		6,	0 },
+	{ _t("outside"),	7,	1 },
+};
+
+static const litehtml::keyword g_vertical_align[] =
+{
+	{ _t("sub"),			3,	1 },
+	{ _t("top"),			3,	3 },
+	{ _t("super"),			5,	2 },
+	{ _t("bottom"),			6,	6 },
+	{ _t("middle"),			6,	5 },
+	{ _t("baseline"),		8,	0 },
+	{ _t("text-top"),		8,	4 },
+	{ _t("text-bottom"),	11,	7 },
+};
+
+static const litehtml::keyword g_border_width[] =
+{
+	{ _t("thin"),	4,	0 },
+	{ _t("thick"),	5,	2 },
+	{ _t("medium"),	6,	1 },
+};
+
+static const litehtml::keyword g_border_style[] =
+{
+	{ _t("none"),	4,	0 },
+	{ _t("inset"),	5,	8 },
+	{ _t("ridge"),	5,	7 },
+	{ _t("solid"),	5,	4 },
+	{ _t("dashed"),	6,	3 },
+	{ _t("dotted"),	6,	2 },
+	{ _t("double"),	6,	5 },
+	{ _t("groove"),	6,	6 },
+	{ _t("hidden"),	6,	1 },
+	{ _t("outset"),	6,	9 },
+};
+
+static const litehtml::keyword g_element_float[] =
+{
+	{ _t("left"),	4,	1 },
+	{ _t("none"),	4,	0 },
+	{ _t("right"),	5,	2 },
+};
+
+static const litehtml::keyword g_element_clear[] =
+{
+	{ _t("both"),	4,	3 },
+	{ _t("left"),	4,	1 },
+	{ _t("none"),	4,	0 },
+	{ _t("right"),	5,	2 },
+};
+
+static const litehtml::keyword g_css_units[] =
+{
+	{ _t("%"),		1,	1 },
+	{ _t("cm"),		2,	3 },
+	{ _t("em"),		2,	5 },
+	{ _t("ex"),		2,	6 },
+	{ _t("in"),		2,	2 },
+	{ _t("mm"),		2,	4 },
+	{ _t("pc"),		2,	8 },
+	{ _t("pt"),		2,	7 },
+	{ _t("px"),		2,	9 },
+	{ _t("dpi"),	3,	10 },
+	{ _t("dpcm"),	4,	11 },
+	{ _t("none"),	4,	0 },
+};
+
+static const litehtml::keyword g_background_attachment[] =
+{
+	{ _t("fixed"),	5,	1 },
+	{ _t("scroll"),	6,	0 },
+};
+
+static const litehtml::keyword g_background_repeat[] =
+{
+	{ _t("repeat"),		6,	0 },
+	{ _t("repeat-x"),	8,	1 },
+	{ _t("repeat-y"),	8,	2 },
+	{ _t("no-repeat"),	9,	3 },
+};
+
+static const litehtml::keyword g_background_box[] =
+{
+	{ _t("border-box"),		10,	0 },
+	{ _t("content-box"),	11,	2 },
+	{ _t("padding-box"),	11,	1 },
+};
+
+static const litehtml::keyword g_element_position[] =
+{
+	{ _t("fixed"),		5,	3 },
+	{ _t("static"),		6,	0 },
+	{ _t("absolute"),	8,	2 },
+	{ _t("relative"),	8,	1 },
+};
+
+static const litehtml::keyword g_text_align[] =
+{
+	{ _t("left"),		4,	0 },
+	{ _t("right"),		5,	1 },
+	{ _t("center"),		6,	2 },
+	{ _t("justify"),	7,	3 },
+};
+
+static const litehtml::keyword g_text_transform[] =
+{
+	{ _t("none"),		4,	0 },
+	{ _t("lowercase"),	9,	3 },
+	{ _t("uppercase"),	9,	2 },
+	{ _t("capitalize"),	10,	1 },
+};
+
+static const litehtml::keyword g_white_space[] =
+{
+	{ _t("pre"),		3,	2 },
+	{ _t("normal"),		6,	0 },
+	{ _t("nowrap"),		6,	1 },
+	{ _t("pre-line"),	8,	3 },
+	{ _t("pre-wrap"),	8,	4 },
+};
+
+static const litehtml::keyword g_overflow[] =
+{
+	{ _t("auto"),		4,	3 },
+	{ _t("hidden"),		6,	1 },
+	{ _t("scroll"),		6,	2 },
+	{ _t("visible"),	7,	0 },
+	{ _t("no-content"),	10,	5 },
+	{ _t("no-display"),	10,	4 },
+};
+
+static const litehtml::keyword g_background_size[] =
+{
+	{ _t("auto"),		4,	0 },
+	{ _t("cover"),		5,	1 },
+	{ _t("contain"),	7,	2 },
+};
+
+static const litehtml::keyword g_visibility[] =
+{
+	{ _t("hidden"),		6,	1 },
+	{ _t("visible"),	7,	0 },
+	{ _t("collapse"),	8,	2 },
+};
+
+static const litehtml::keyword g_border_collapse[] =
+{
+	{ _t("collapse"),	8,	0 },
+	{ _t("separate"),	8,	1 },
+};
+
+static const litehtml::keyword g_table_layout[] =
+{
+	{ _t("auto"),		4,	0 },
+	{ _t("fixed"),		5,	1 },
+};
+
+static const litehtml::keyword g_pseudo_class[] =
+{
+	{ _t("not"),				3,	10 },
+	{ _t("nth-child"),			9,	6 },
+	{ _t("last-child"),			10,	4 },
+	{ _t("only-child"),			10,	0 },
+	{ _t("first-child"),		11,	2 },
+	{ _t("nth-of-type"),		11,	7 },
+	{ _t("last-of-type"),		12,	5 },
+	{ _t("only-of-type"),		12,	1 },
+	{ _t("first-of-type"),		13,	3 },
+	{ _t("nth-last-child"),		14,	8 },
+	{ _t("nth-last-of-type"),	16,	9 },
+};
+
+static const litehtml::keyword g_content_property[] =
+{
+	{ _t("none"),			4,	0 },
+	{ _t("normal"),			6,	1 },
+	{ _t("open-quote"),		10,	2 },
+	{ _t("close-quote"),	11,	3 },
+	{ _t("no-open-quote"),	13,	4 },
+	{ _t("no-close-quote"),	14,	5 },
+};
+
+static const litehtml::keyword g_media_orientation[] =
+{
+	{ _t("portrait"),	8,	0 },
+	{ _t("landscape"),	9,	1 },
+};
+
+static const litehtml::keyword g_media_feature[] =
+{
+	{ _t("none"),						4,	0 },
+	{ _t("color"),						5,	20 },
+	{ _t("width"),						5,	1 },
+	{ _t("height"),						6,	4 },
+	{ _t("max-color"),					9,	22 },
+	{ _t("max-width"),					9,	3 },
+	{ _t("min-color"),					9,	21 },
+	{ _t("min-width"),					9,	2 },
+	{ _t("max-height"),					10,	6 },
+	{ _t("min-height"),					10,	5 },
+	{ _t("monochrome"),					10,	26 },
+	{ _t("resolution"),					10,	29 },
+	{ _t("color-index"),				11,	23 },
+	{ _t("orientation"),				11,	13 },
+	{ _t("aspect-ratio"),				12,	14 },
+	{ _t("device-width"),				12,	7 },
+	{ _t("device-height"),				13,	10 },
+	{ _t("max-monochrome"),				14,	28 },
+	{ _t("max-resolution"),				14,	31 },
+	{ _t("min-monochrome"),				14,	27 },
+	{ _t("min-resolution"),				14,	30 },
+	{ _t("max-color-index"),			15,	25 },
+	{ _t("min-color-index"),			15,	24 },
+	{ _t("max-aspect-ratio"),			16,	16 },
+	{ _t("max-device-width"),			16,	9 },
+	{ _t("min-aspect-ratio"),			16,	15 },
+	{ _t("min-device-width"),			16,	8 },
+	{ _t("max-device-height"),			17,	12 },
+	{ _t("min-device-height"),			17,	11 },
+	{ _t("device-aspect-ratio"),		19,	17 },
+	{ _t("max-device-aspect-ratio"),	23,	19 },
+	{ _t("min-device-aspect-ratio"),	23,	18 },
+};
+
+static const litehtml::keyword g_box_sizing[] =
+{
+	{ _t("border-box"),		10,	1 },
+	{ _t("content-box"),	11,	0 },
+};
+
+static const litehtml::keyword g_media_type[] =
+{
+	{ _t("tv"),			2,	10 },
+	{ _t("all"),		3,	1 },
+	{ _t("tty"),		3,	9 },
+	{ _t("none"),		4,	0 },
+	{ _t("print"),		5,	3 },
+	{ _t("screen"),		6,	2 },
+	{ _t("speech"),		6,	8 },
+	{ _t("braille"),	7,	4 },
+	{ _t("embossed"),	8,	5 },
+	{ _t("handheld"),	8,	6 },
+	{ _t("projection"),	10,	7 },
+};
+
+// Predefined values of the length properties in properties.h
+
+static const litehtml::keyword g_length_auto[] =
+{
+	{ _t("auto"),	4,	0 },
+};
+
+static const litehtml::keyword g_length_none[] =
+{
+	{ _t("none"),	4,	0 },
+};
+
+static const litehtml::keyword g_length_normal[] =
+{
+	{ _t("normal"),	6,	0 },
+};
+
+static const litehtml::keyword g_length_zero[] =
+{
+	{ _t("0"),		1,	0 },
+};
+
+const litehtml::keyword_table litehtml::style_display_keywords = { g_style_display, sizeof(g_style_display) / sizeof(g_style_display[0]) };
+const litehtml::keyword_table litehtml::font_size_keywords = { g_font_size, sizeof(g_font_size) / sizeof(g_font_size[0]) };
+const litehtml::keyword_table litehtml::font_style_keywords = { g_font_style, sizeof(g_font_style) / sizeof(g_font_style[0]) };
+const litehtml::keyword_table litehtml::font_variant_keywords = { g_font_variant, sizeof(g_font_variant) / sizeof(g_font_variant[0]) };
+const litehtml::keyword_table litehtml::font_weight_keywords = { g_font_weight, sizeof(g_font_weight) / sizeof(g_font_weight[0]) };
+const litehtml::keyword_table litehtml::list_style_type_keywords = { g_list_style_type, sizeof(g_list_style_type) / sizeof(g_list_style_type[0]) };
+const litehtml::keyword_table litehtml::list_style_position_keywords = { g_list_style_position, sizeof(g_list_style_position) / sizeof(g_list_style_position[0]) };
+const litehtml::keyword_table litehtml::vertical_align_keywords = { g_vertical_align, sizeof(g_vertical_align) / sizeof(g_vertical_align[0]) };
+const litehtml::keyword_table litehtml::border_width_keywords = { g_border_width, sizeof(g_border_width) / sizeof(g_border_width[0]) };
+const litehtml::keyword_table litehtml::border_style_keywords = { g_border_style, sizeof(g_border_style) / sizeof(g_border_style[0]) };
+const litehtml::keyword_table litehtml::element_float_keywords = { g_element_float, sizeof(g_element_float) / sizeof(g_element_float[0]) };
+const litehtml::keyword_table litehtml::element_clear_keywords = { g_element_clear, sizeof(g_element_clear) / sizeof(g_element_clear[0]) };
+const litehtml::keyword_table litehtml::css_units_keywords = { g_css_units, sizeof(g_css_units) / sizeof(g_css_units[0]) };
+const litehtml::keyword_table litehtml::background_attachment_keywords = { g_background_attachment, sizeof(g_background_attachment) / sizeof(g_background_attachment[0]) };
+const litehtml::keyword_table litehtml::background_repeat_keywords = { g_background_repeat, sizeof(g_background_repeat) / sizeof(g_background_repeat[0]) };
+const litehtml::keyword_table litehtml::background_box_keywords = { g_background_box, sizeof(g_background_box) / sizeof(g_background_box[0]) };
+const litehtml::keyword_table litehtml::element_position_keywords = { g_element_position, sizeof(g_element_position) / sizeof(g_element_position[0]) };
+const litehtml::keyword_table litehtml::text_align_keywords = { g_text_align, sizeof(g_text_align) / sizeof(g_text_align[0]) };
+const litehtml::keyword_table litehtml::text_transform_keywords = { g_text_transform, sizeof(g_text_transform) / sizeof(g_text_transform[0]) };
+const litehtml::keyword_table litehtml::white_space_keywords = { g_white_space, sizeof(g_white_space) / sizeof(g_white_space[0]) };
+const litehtml::keyword_table litehtml::overflow_keywords = { g_overflow, sizeof(g_overflow) / sizeof(g_overflow[0]) };
+const litehtml::keyword_table litehtml::background_size_keywords = { g_background_size, sizeof(g_background_size) / sizeof(g_background_size[0]) };
+const litehtml::keyword_table litehtml::visibility_keywords = { g_visibility, sizeof(g_visibility) / sizeof(g_visibility[0]) };
+const litehtml::keyword_table litehtml::border_collapse_keywords = { g_border_collapse, sizeof(g_border_collapse) / sizeof(g_border_collapse[0]) };
+const litehtml::keyword_table litehtml::table_layout_keywords = { g_table_layout, sizeof(g_table_layout) / sizeof(g_table_layout[0]) };
+const litehtml::keyword_table litehtml::pseudo_class_keywords = { g_pseudo_class, sizeof(g_pseudo_class) / sizeof(g_pseudo_class[0]) };
+const litehtml::keyword_table litehtml::content_property_keywords = { g_content_property, sizeof(g_content_property) / sizeof(g_content_property[0]) };
+const litehtml::keyword_table litehtml::media_orientation_keywords = { g_media_orientation, sizeof(g_media_orientation) / sizeof(g_media_orientation[0]) };
+const litehtml::keyword_table litehtml::media_feature_keywords = { g_media_feature, sizeof(g_media_feature) / sizeof(g_media_feature[0]) };
+const litehtml::keyword_table litehtml::box_sizing_keywords = { g_box_sizing, sizeof(g_box_sizing) / sizeof(g_box_sizing[0]) };
+const litehtml::keyword_table litehtml::media_type_keywords = { g_media_type, sizeof(g_media_type) / sizeof(g_media_type[0]) };
+const litehtml::keyword_table litehtml::length_auto_keywords = { g_length_auto, sizeof(g_length_auto) / sizeof(g_length_auto[0]) };
+const litehtml::keyword_table litehtml::length_none_keywords = { g_length_none, sizeof(g_length_none) / sizeof(g_length_none[0]) };
+const litehtml::keyword_table litehtml::length_normal_keywords = { g_length_normal, sizeof(g_length_normal) / sizeof(g_length_normal[0]) };
+const litehtml::keyword_table litehtml::length_zero_keywords = { g_length_zero, sizeof(g_length_zero) / sizeof(g_length_zero[0]) };
+
+int litehtml::keyword_index( const keyword_table& table, const tchar_t* val, int defValue )
+{
+	if(!val)
+	{
+		return defValue;
+	}
+
+	size_t len = t_strlen(val);
+	int lo = 0;
+	int hi = table.count - 1;
+	while(lo <= hi)
+	{
+		int mid = (lo + hi) / 2;
+		const keyword& kw = table.items[mid];
+		int cmp = kw.length - (int) len;
+		if(!cmp)
+		{
+			cmp = t_strncmp(kw.name, val, len);
+		}
+		if(cmp < 0)
+		{
+			lo = mid + 1;
+		} else if(cmp > 0)
+		{
+			hi = mid - 1;
+		} else
+		{
+			return kw.value;
+		}
+	}
+	return defValue;
+}
+
+#ifndef NDEBUG
+
+// Debug builds check at startup that every table above matches its list in types.h
+namespace
+{
+	struct keyword_source
+	{
+		const litehtml::keyword_table*	table;
+		const litehtml::tchar_t*		strings;
+	};
+
+	const keyword_source g_keyword_sources[] =
+	{
+		{ &litehtml::style_display_keywords,			style_display_strings },
+		{ &litehtml::font_size_keywords,				font_size_strings },
+		{ &litehtml::font_style_keywords,				font_style_strings },
+		{ &litehtml::font_variant_keywords,				font_variant_strings },
+		{ &litehtml::font_weight_keywords,				font_weight_strings },
+		{ &litehtml::list_style_type_keywords,			list_style_type_strings },
+		{ &litehtml::list_style_position_keywords,		list_style_position_strings },
+		{ &litehtml::vertical_align_keywords,			vertical_align_strings },
+		{ &litehtml::border_width_keywords,				border_width_strings },
+		{ &litehtml::border_style_keywords,				border_style_strings },
+		{ &litehtml::element_float_keywords,			element_float_strings },
+		{ &litehtml::element_clear_keywords,			element_clear_strings },
+		{ &litehtml::css_units_keywords,				css_units_strings },
+		{ &litehtml::background_attachment_keywords,	background_attachment_strings },
+		{ &litehtml::background_repeat_keywords,		background_repeat_strings },
+		{ &litehtml::background_box_keywords,			background_box_strings },
+		{ &litehtml::element_position_keywords,			element_position_strings },
+		{ &litehtml::text_align_keywords,				text_align_strings },
+		{ &litehtml::text_transform_keywords,			text_transform_strings },
+		{ &litehtml::white_space_keywords,				white_space_strings },
+		{ &litehtml::overflow_keywords,					overflow_strings },
+		{ &litehtml::background_size_keywords,			background_size_strings },
+		{ &litehtml::visibility_keywords,				visibility_strings },
+		{ &litehtml::border_collapse_keywords,			border_collapse_strings },
+		{ &litehtml::table_layout_keywords,				table_layout_strings },
+		{ &litehtml::pseudo_class_keywords,				pseudo_class_strings },
+		{ &litehtml::content_property_keywords,			content_property_string },
+		{ &litehtml::media_orientation_keywords,		media_orientation_strings },
+		{ &litehtml::media_feature_keywords,			media_feature_strings },
+		{ &litehtml::box_sizing_keywords,				box_sizing_strings },
+		{ &litehtml::media_type_keywords,				media_type_strings },
+	};
+
+	bool check_keyword_tables()
+	{
+		for(size_t i = 0; i < sizeof(g_keyword_sources) / sizeof(g_keyword_sources[0]); i++)
+		{
+			const litehtml::keyword_table& table = *g_keyword_sources[i].table;
+			litehtml::string_vector items;
+			litehtml::split_string(g_keyword_sources[i].strings, items, _t(";"));
+			assert(table.count == (int) items.size());
+			for(int j = 0; j < table.count; j++)
+			{
+				const litehtml::keyword& kw = table.items[j];
+				assert(kw.value >= 0 && kw.value < (int) items.size() && items[kw.value] == kw.name);
+				assert(kw.length == (int) t_strlen(kw.name));
+				assert(j == 0 || kw.length > table.items[j - 1].length ||
+					(kw.length == table.items[j - 1].length && t_strcmp(kw.name, table.items[j - 1].name) > 0));
+				assert(litehtml::keyword_index(table, kw.name) == kw.value);
+			}
+		}
+		return true;
+	}
+
+	const bool g_keyword_tables_checked = check_keyword_tables();
+}
+
+#endif
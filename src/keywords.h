@@ -0,0 +1,60 @@
+#pragma once
+
+namespace litehtml
+{
+	struct keyword
+	{
+		const tchar_t*	name;
+		int				length;
+		int				value;	// index in the ';' separated list
+	};
+
+	// Keywords of one of the *_strings lists in types.h,
+	// sorted by length, then by name
+	struct keyword_table
+	{
+		const keyword*	items;
+		int				count;
+	};
+
+	// returns the index of val in the original list or defValue
+	int keyword_index(const keyword_table& table, const tchar_t* val, int defValue = -1);
+
+	extern const keyword_table style_display_keywords;
+	extern const keyword_table font_size_keywords;
+	extern const keyword_table font_style_keywords;
+	extern const keyword_table font_variant_keywords;
+	extern const keyword_table font_weight_keywords;
+	extern const keyword_table list_style_type_keywords;
+	extern const keyword_table list_style_position_keywords;
+	extern const keyword_table vertical_align_keywords;
+	extern const keyword_table border_width_keywords;
+	extern const keyword_table border_style_keywords;
+	extern const keyword_table element_float_keywords;
+	extern const keyword_table element_clear_keywords;
+	extern const keyword_table css_units_keywords;
+	extern const keyword_table background_attachment_keywords;
+	extern const keyword_table background_repeat_keywords;
+	extern const keyword_table background_box_keywords;
+	extern const keyword_table element_position_keywords;
+	extern const keyword_table text_align_keywords;
+	extern const keyword_table text_transform_keywords;
+	extern const keyword_table white_space_keywords;
+	extern const keyword_table overflow_keywords;
+	extern const keyword_table background_size_keywords;
+	extern const keyword_table visibility_keywords;
+	extern const keyword_table border_collapse_keywords;
+	extern const keyword_table table_layout_keywords;
+	extern const keyword_table pseudo_class_keywords;
+	extern const keyword_table content_property_keywords;
+	extern const keyword_table media_orientation_keywords;
+	extern const keyword_table media_feature_keywords;
+	extern const keyword_table box_sizing_keywords;
+	extern const keyword_table media_type_keywords;
+
+	// single keyword predefined values of the length properties
+	extern const keyword_table length_auto_keywords;
+	extern const keyword_table length_none_keywords;
+	extern const keyword_table length_normal_keywords;
+	extern const keyword_table length_zero_keywords;
+}
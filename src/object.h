@@ -4,29 +4,91 @@
 
 namespace litehtml
 {
+	class arena;
+
 	class object
 	{
 	protected:
-		int	m_refCount;
+		int		m_refCount;
+		int		m_arena_offset;	// of this object in its arena allocation, -1 on the heap
 	public:
+		// placed(new (doc->get_arena()) T(...), doc->get_arena()) places the
+		// object into the document arena, a null arena means the heap. See
+		// arena.cpp
+		static void* operator new(size_t sz);
+		static void* operator new(size_t sz, arena* owner);
+		static void operator delete(void* p);
+		static void operator delete(void* p, arena* owner);
+
 		object()
 		{ 
-			m_refCount = 0;
+			m_refCount		= 0;
+			m_arena_offset	= -1;
+		}
+		object(const object& val)
+		{
+			m_refCount		= 0;
+			m_arena_offset	= -1;
 		}
 		virtual ~object()
 		{
 
 		}
 
+		object& operator=(const object& val)
+		{
+			return *this;
+		}
+
 		void addRef()
 		{ 
 			m_refCount++;
+#ifdef LITEHTML_COUNT_REFS
+			addref_calls()++;
+#endif
+		}
+
+#ifdef LITEHTML_COUNT_REFS
+		// all addRef() calls, see test/bench_object_ptr.cpp
+		static long& addref_calls()
+		{
+			static long calls = 0;
+			return calls;
 		}
+#endif
 		
 		void release()
 		{
-			if(!(--m_refCount)) delete this;
+			if(!(--m_refCount))
+			{
+				if(m_arena_offset >= 0)
+				{
+					delete_in_arena(this);
+				} else
+				{
+					delete this;
+				}
+			}
+		}
+
+		bool is_shared() const
+		{
+			return m_refCount > 1;
+		}
+
+		// obj was made by new (owner) T(...), release() gives it back to owner
+		template<class T>
+		static T* placed(T* obj, arena* owner)
+		{
+			if(obj && owner)
+			{
+				object* base = obj;
+				base->m_arena_offset = (int) ((const char*) base - (const char*) obj);
+			}
+			return obj;
 		}
+	private:
+		static void delete_in_arena(object* obj);
 	};
 
 	template<class T>
@@ -34,12 +96,12 @@ namespace litehtml
 	{
 		T*	m_ptr;
 	public:
-		object_ptr()
+		object_ptr() LITEHTML_NOEXCEPT
 		{
 			m_ptr = 0;
 		}
 
-		object_ptr(T* ptr)
+		object_ptr(T* ptr) LITEHTML_NOEXCEPT
 		{
 			m_ptr = ptr;
 			if(m_ptr)
@@ -48,7 +110,7 @@ namespace litehtml
 			}
 		}
 
-		object_ptr(const object_ptr<T>& val)
+		object_ptr(const object_ptr<T>& val) LITEHTML_NOEXCEPT
 		{
 			m_ptr = val.m_ptr;
 			if(m_ptr)
@@ -57,6 +119,29 @@ namespace litehtml
 			}
 		}
 
+#ifdef LITEHTML_RVALUE_REFS
+		// moving leaves val empty and does not touch the reference count
+		object_ptr(object_ptr<T>&& val) LITEHTML_NOEXCEPT
+		{
+			m_ptr = val.m_ptr;
+			val.m_ptr = 0;
+		}
+
+		void operator=(object_ptr<T>&& val) LITEHTML_NOEXCEPT
+		{
+			if(this != &val)
+			{
+				T* oldPtr = m_ptr;
+				m_ptr = val.m_ptr;
+				val.m_ptr = 0;
+				if(oldPtr)
+				{
+					oldPtr->release();
+				}
+			}
+		}
+#endif
+
 		~object_ptr()
 		{
 			if(m_ptr)
@@ -66,6 +151,13 @@ namespace litehtml
 			m_ptr = 0;
 		}
 
+		void swap(object_ptr<T>& val) LITEHTML_NOEXCEPT
+		{
+			T* tmp = m_ptr;
+			m_ptr = val.m_ptr;
+			val.m_ptr = tmp;
+		}
+
 		void operator=(const object_ptr<T>& val)
 		{
 			T* oldPtr = m_ptr;
@@ -114,4 +206,11 @@ namespace litehtml
 			return m_ptr;
 		}
 	};
+
+	// found by ADL from std::sort and friends
+	template<class T>
+	inline void swap(object_ptr<T>& a, object_ptr<T>& b) LITEHTML_NOEXCEPT
+	{
+		a.swap(b);
+	}
 }
@@ -77,4 +77,15 @@ namespace litehtml
 	#define t_isdigit			isdigit
 
 #endif
+
+// define LITEHTML_NO_RVALUE_REFS to build without the object_ptr moves
+#if (__cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1600)) && !defined(LITEHTML_NO_RVALUE_REFS)
+	#define LITEHTML_RVALUE_REFS
+#endif
+
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900)
+	#define LITEHTML_NOEXCEPT	noexcept
+#else
+	#define LITEHTML_NOEXCEPT	throw()
+#endif
 }
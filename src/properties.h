@@ -0,0 +1,105 @@
+// The CSS properties known to litehtml, sorted by name (strcmp order).
+// Included with LITEHTML_PROPERTY(id, name, type, keywords, def) defined:
+//   type     - how litehtml::property_value parses the value, see property_type
+//   keywords - keyword table from keywords.h: values of prop_type_keyword, predefined values of prop_type_length
+//   def      - value used when no style sets the property, 0 if the caller supplies it
+
+LITEHTML_PROPERTY(prop_litehtml_border_spacing_x,		_t("-litehtml-border-spacing-x"),	prop_type_length,	0,									_t("0px"))
+LITEHTML_PROPERTY(prop_litehtml_border_spacing_y,		_t("-litehtml-border-spacing-y"),	prop_type_length,	0,									_t("0px"))
+LITEHTML_PROPERTY(prop_background,						_t("background"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_background_attachment,			_t("background-attachment"),		prop_type_keyword,	&background_attachment_keywords,	_t("scroll"))
+LITEHTML_PROPERTY(prop_background_clip,					_t("background-clip"),				prop_type_keyword,	&background_box_keywords,			_t("border-box"))
+LITEHTML_PROPERTY(prop_background_color,				_t("background-color"),				prop_type_color,	0,									0)
+LITEHTML_PROPERTY(prop_background_image,				_t("background-image"),				prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_background_image_baseurl,		_t("background-image-baseurl"),		prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_background_origin,				_t("background-origin"),			prop_type_keyword,	&background_box_keywords,			_t("padding-box"))
+LITEHTML_PROPERTY(prop_background_position,				_t("background-position"),			prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_background_repeat,				_t("background-repeat"),			prop_type_keyword,	&background_repeat_keywords,		_t("repeat"))
+LITEHTML_PROPERTY(prop_background_size,					_t("background-size"),				prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border,							_t("border"),						prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_bottom,					_t("border-bottom"),				prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_bottom_color,				_t("border-bottom-color"),			prop_type_color,	0,									_t(""))
+LITEHTML_PROPERTY(prop_border_bottom_left_radius,		_t("border-bottom-left-radius"),	prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_bottom_left_radius_x,		_t("border-bottom-left-radius-x"),	prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_border_bottom_left_radius_y,		_t("border-bottom-left-radius-y"),	prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_border_bottom_right_radius,		_t("border-bottom-right-radius"),	prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_bottom_right_radius_x,	_t("border-bottom-right-radius-x"),	prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_border_bottom_right_radius_y,	_t("border-bottom-right-radius-y"),	prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_border_bottom_style,				_t("border-bottom-style"),			prop_type_keyword,	&border_style_keywords,				_t("none"))
+LITEHTML_PROPERTY(prop_border_bottom_width,				_t("border-bottom-width"),			prop_type_length,	&border_width_keywords,				_t("medium"))
+LITEHTML_PROPERTY(prop_border_collapse,					_t("border-collapse"),				prop_type_keyword,	&border_collapse_keywords,			_t("separate"))
+LITEHTML_PROPERTY(prop_border_color,					_t("border-color"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_left,						_t("border-left"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_left_color,				_t("border-left-color"),			prop_type_color,	0,									_t(""))
+LITEHTML_PROPERTY(prop_border_left_style,				_t("border-left-style"),			prop_type_keyword,	&border_style_keywords,				_t("none"))
+LITEHTML_PROPERTY(prop_border_left_width,				_t("border-left-width"),			prop_type_length,	&border_width_keywords,				_t("medium"))
+LITEHTML_PROPERTY(prop_border_radius,					_t("border-radius"),				prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_radius_x,					_t("border-radius-x"),				prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_radius_y,					_t("border-radius-y"),				prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_right,					_t("border-right"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_right_color,				_t("border-right-color"),			prop_type_color,	0,									_t(""))
+LITEHTML_PROPERTY(prop_border_right_style,				_t("border-right-style"),			prop_type_keyword,	&border_style_keywords,				_t("none"))
+LITEHTML_PROPERTY(prop_border_right_width,				_t("border-right-width"),			prop_type_length,	&border_width_keywords,				_t("medium"))
+LITEHTML_PROPERTY(prop_border_spacing,					_t("border-spacing"),				prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_style,					_t("border-style"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_top,						_t("border-top"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_top_color,				_t("border-top-color"),				prop_type_color,	0,									_t(""))
+LITEHTML_PROPERTY(prop_border_top_left_radius,			_t("border-top-left-radius"),		prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_top_left_radius_x,		_t("border-top-left-radius-x"),		prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_border_top_left_radius_y,		_t("border-top-left-radius-y"),		prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_border_top_right_radius,			_t("border-top-right-radius"),		prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_border_top_right_radius_x,		_t("border-top-right-radius-x"),	prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_border_top_right_radius_y,		_t("border-top-right-radius-y"),	prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_border_top_style,				_t("border-top-style"),				prop_type_keyword,	&border_style_keywords,				_t("none"))
+LITEHTML_PROPERTY(prop_border_top_width,				_t("border-top-width"),				prop_type_length,	&border_width_keywords,				_t("medium"))
+LITEHTML_PROPERTY(prop_border_width,					_t("border-width"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_bottom,							_t("bottom"),						prop_type_length,	&length_auto_keywords,				_t("auto"))
+LITEHTML_PROPERTY(prop_box_sizing,						_t("box-sizing"),					prop_type_keyword,	&box_sizing_keywords,				_t("content-box"))
+LITEHTML_PROPERTY(prop_clear,							_t("clear"),						prop_type_keyword,	&element_clear_keywords,			_t("none"))
+LITEHTML_PROPERTY(prop_color,							_t("color"),						prop_type_color,	0,									0)
+LITEHTML_PROPERTY(prop_content,							_t("content"),						prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_cursor,							_t("cursor"),						prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_display,							_t("display"),						prop_type_keyword,	&style_display_keywords,			_t("inline"))
+LITEHTML_PROPERTY(prop_float,							_t("float"),						prop_type_keyword,	&element_float_keywords,			_t("none"))
+LITEHTML_PROPERTY(prop_font,							_t("font"),							prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_font_family,						_t("font-family"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_font_size,						_t("font-size"),					prop_type_length,	&font_size_keywords,				0)
+LITEHTML_PROPERTY(prop_font_style,						_t("font-style"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_font_variant,					_t("font-variant"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_font_weight,						_t("font-weight"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_height,							_t("height"),						prop_type_length,	&length_auto_keywords,				_t("auto"))
+LITEHTML_PROPERTY(prop_left,							_t("left"),							prop_type_length,	&length_auto_keywords,				_t("auto"))
+LITEHTML_PROPERTY(prop_line_height,						_t("line-height"),					prop_type_length,	&length_normal_keywords,			_t("normal"))
+LITEHTML_PROPERTY(prop_list_style,						_t("list-style"),					prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_list_style_image,				_t("list-style-image"),				prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_list_style_image_baseurl,		_t("list-style-image-baseurl"),		prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_list_style_position,				_t("list-style-position"),			prop_type_keyword,	&list_style_position_keywords,		_t("outside"))
+LITEHTML_PROPERTY(prop_list_style_type,					_t("list-style-type"),				prop_type_keyword,	&list_style_type_keywords,			_t("disc"))
+LITEHTML_PROPERTY(prop_margin,							_t("margin"),						prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_margin_bottom,					_t("margin-bottom"),				prop_type_length,	&length_auto_keywords,				_t("0"))
+LITEHTML_PROPERTY(prop_margin_left,						_t("margin-left"),					prop_type_length,	&length_auto_keywords,				_t("0"))
+LITEHTML_PROPERTY(prop_margin_right,					_t("margin-right"),					prop_type_length,	&length_auto_keywords,				_t("0"))
+LITEHTML_PROPERTY(prop_margin_top,						_t("margin-top"),					prop_type_length,	&length_auto_keywords,				_t("0"))
+LITEHTML_PROPERTY(prop_max_height,						_t("max-height"),					prop_type_length,	&length_none_keywords,				_t("none"))
+LITEHTML_PROPERTY(prop_max_width,						_t("max-width"),					prop_type_length,	&length_none_keywords,				_t("none"))
+LITEHTML_PROPERTY(prop_min_height,						_t("min-height"),					prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_min_width,						_t("min-width"),					prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_overflow,						_t("overflow"),						prop_type_keyword,	&overflow_keywords,					_t("visible"))
+LITEHTML_PROPERTY(prop_padding,							_t("padding"),						prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_padding_bottom,					_t("padding-bottom"),				prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_padding_left,					_t("padding-left"),					prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_padding_right,					_t("padding-right"),				prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_padding_top,						_t("padding-top"),					prop_type_length,	0,									_t("0"))
+LITEHTML_PROPERTY(prop_position,						_t("position"),						prop_type_keyword,	&element_position_keywords,			_t("static"))
+LITEHTML_PROPERTY(prop_right,							_t("right"),						prop_type_length,	&length_auto_keywords,				_t("auto"))
+LITEHTML_PROPERTY(prop_table_layout,					_t("table-layout"),					prop_type_keyword,	&table_layout_keywords,				_t("auto"))
+LITEHTML_PROPERTY(prop_text_align,						_t("text-align"),					prop_type_keyword,	&text_align_keywords,				_t("left"))
+LITEHTML_PROPERTY(prop_text_decoration,					_t("text-decoration"),				prop_type_string,	0,									0)
+LITEHTML_PROPERTY(prop_text_indent,						_t("text-indent"),					prop_type_length,	&length_zero_keywords,				_t("0"))
+LITEHTML_PROPERTY(prop_text_transform,					_t("text-transform"),				prop_type_keyword,	&text_transform_keywords,			_t("none"))
+LITEHTML_PROPERTY(prop_top,								_t("top"),							prop_type_length,	&length_auto_keywords,				_t("auto"))
+LITEHTML_PROPERTY(prop_vertical_align,					_t("vertical-align"),				prop_type_keyword,	&vertical_align_keywords,			_t("baseline"))
+LITEHTML_PROPERTY(prop_visibility,						_t("visibility"),					prop_type_keyword,	&visibility_keywords,				_t("visible"))
+LITEHTML_PROPERTY(prop_white_space,						_t("white-space"),					prop_type_keyword,	&white_space_keywords,				_t("normal"))
+LITEHTML_PROPERTY(prop_width,							_t("width"),						prop_type_length,	&length_auto_keywords,				_t("auto"))
+LITEHTML_PROPERTY(prop_z_index,							_t("z-index"),						prop_type_string,	0,									0)
\ No newline at end of file
@@ -6,13 +6,121 @@
 #include <locale>
 #endif
 
+struct property_info
+{
+	const litehtml::tchar_t*	name;
+	litehtml::property_type		type;
+	const litehtml::keyword_table*	keywords;
+	const litehtml::tchar_t*	def;
+};
+
+namespace litehtml
+{
+	// In the order of litehtml::property_id
+	static const property_info g_properties[] =
+	{
+#define LITEHTML_PROPERTY(id, name, type, keywords, def)	{ name, type, keywords, def },
+#include "properties.h"
+#undef LITEHTML_PROPERTY
+	};
+}
+
+namespace
+{
+	// the parsed def column of properties.h
+	struct property_defaults
+	{
+		litehtml::property_value	values[litehtml::prop_count];
+
+		property_defaults()
+		{
+			for(int i = 0; i < litehtml::prop_count; i++)
+			{
+				if(litehtml::g_properties[i].def)
+				{
+					values[i] = litehtml::property_value((litehtml::property_id) i, litehtml::g_properties[i].def, false);
+				}
+			}
+		}
+	};
+
+	property_defaults g_property_defaults;
+}
+
+litehtml::property_id litehtml::property_from_name( const tchar_t* name )
+{
+	int lo = 0;
+	int hi = prop_count - 1;
+	while(lo <= hi)
+	{
+		int mid = (lo + hi) / 2;
+		int cmp = t_strcmp(g_properties[mid].name, name);
+		if(cmp < 0)
+		{
+			lo = mid + 1;
+		} else if(cmp > 0)
+		{
+			hi = mid - 1;
+		} else
+		{
+			return (property_id) mid;
+		}
+	}
+	return prop_unknown;
+}
+
+const litehtml::tchar_t* litehtml::property_name( property_id id )
+{
+	if(id >= 0 && id < prop_count)
+	{
+		return g_properties[id].name;
+	}
+	return 0;
+}
+
+void litehtml::property_value::parse_value()
+{
+	m_inherit	= !t_strcasecmp(m_value.c_str(), _t("inherit"));
+	m_keyword	= -1;
+	if(m_id < 0 || m_id >= prop_count)
+	{
+		return;
+	}
+	switch(g_properties[m_id].type)
+	{
+	case prop_type_keyword:
+		m_keyword = keyword_index(*g_properties[m_id].keywords, m_value.c_str());
+		break;
+	case prop_type_length:
+		m_length.fromString(m_value, g_properties[m_id].keywords);
+		break;
+	case prop_type_color:
+		m_color = web_color::from_string(m_value.c_str());
+		break;
+	case prop_type_string:
+		break;
+	}
+}
+
+const litehtml::property_value* litehtml::property_value::get_default( property_id id )
+{
+	if(id >= 0 && id < prop_count && g_properties[id].def)
+	{
+		return &g_property_defaults.values[id];
+	}
+	return 0;
+}
+
 litehtml::style::style()
 {
+	clear();
 }
 
 litehtml::style::style( const style& val )
 {
-	m_properties = val.m_properties;
+	m_properties	= val.m_properties;
+	m_unknown		= val.m_unknown;
+	memcpy(m_mask, val.m_mask, sizeof(m_mask));
 }
 
 litehtml::style::~style()
@@ -20,6 +128,39 @@ litehtml::style::~style()
 
 }
 
+void litehtml::style::operator=( const style& val )
+{
+	m_properties	= val.m_properties;
+	m_unknown		= val.m_unknown;
+	memcpy(m_mask, val.m_mask, sizeof(m_mask));
+}
+
+void litehtml::style::clear()
+{
+	m_properties.clear();
+	m_unknown.clear();
+	memset(m_mask, 0, sizeof(m_mask));
+}
+
+const litehtml::property_value* litehtml::style::get_value( const tchar_t* name ) const
+{
+	if(!name)
+	{
+		return 0;
+	}
+	property_id id = property_from_name(name);
+	if(id != prop_unknown)
+	{
+		return find(id);
+	}
+	props_map::const_iterator prop = m_unknown.find(name);
+	if(prop != m_unknown.end())
+	{
+		return &prop->second;
+	}
+	return 0;
+}
+
 void litehtml::style::parse( const tchar_t* txt, const tchar_t* baseurl )
 {
 	std::vector<tstring> properties;
@@ -70,9 +211,13 @@ void litehtml::style::parse_property( const tstring& txt, const tchar_t* baseurl
 
 void litehtml::style::combine( const litehtml::style& src )
 {
-	for(props_map::const_iterator i = src.m_properties.begin(); i != src.m_properties.end(); i++)
+	for(props_vector::const_iterator i = src.m_properties.begin(); i != src.m_properties.end(); i++)
 	{
-		add_parsed_property(i->first.c_str(), i->second.m_value.c_str(), i->second.m_important);
+		add_parsed_property(*i);
+	}
+	for(props_map::const_iterator i = src.m_unknown.begin(); i != src.m_unknown.end(); i++)
+	{
+		add_unknown_property(i->first, i->second);
 	}
 }
 
@@ -119,7 +264,7 @@ void litehtml::style::add_property( const tchar_t* name, const tchar_t* val, con
 		tstring str;
 		for(string_vector::const_iterator tok = tokens.begin(); tok != tokens.end(); tok++)
 		{
-			idx = value_index(tok->c_str(), border_style_strings, -1);
+			idx = keyword_index(border_style_keywords, tok->c_str(), -1);
 			if(idx >= 0)
 			{
 				add_property(_t("border-left-style"), tok->c_str(), baseurl, important);
@@ -154,7 +299,7 @@ void litehtml::style::add_property( const tchar_t* name, const tchar_t* val, con
 		tstring str;
 		for(string_vector::const_iterator tok = tokens.begin(); tok != tokens.end(); tok++)
 		{
-			idx = value_index(tok->c_str(), border_style_strings, -1);
+			idx = keyword_index(border_style_keywords, tok->c_str(), -1);
 			if(idx >= 0)
 			{
 				str = name;
@@ -323,13 +468,13 @@ void litehtml::style::add_property( const tchar_t* name, const tchar_t* val, con
 		split_string(val, tokens, _t(" "), _t(""), _t("("));
 		for(string_vector::iterator tok = tokens.begin(); tok != tokens.end(); tok++)
 		{
-			int idx = value_index(tok->c_str(), list_style_type_strings, -1);
+			int idx = keyword_index(list_style_type_keywords, tok->c_str(), -1);
 			if(idx >= 0)
 			{
 				add_parsed_property(_t("list-style-type"), *tok, important);
 			} else
 			{
-				idx = value_index(tok->c_str(), list_style_position_strings, -1);
+				idx = keyword_index(list_style_position_keywords, tok->c_str(), -1);
 				if(idx >= 0)
 				{
 					add_parsed_property(_t("list-style-position"), *tok, important);
@@ -462,7 +607,7 @@ void litehtml::style::parse_short_border( const tstring& prefix, const tstring&
 		add_parsed_property(prefix + _t("-color"),	tokens[2], important);
 	} else if(tokens.size() == 2)
 	{
-		if(iswdigit(tokens[0][0]) || value_index(val.c_str(), border_width_strings) >= 0)
+		if(iswdigit(tokens[0][0]) || keyword_index(border_width_keywords, val.c_str()) >= 0)
 		{
 			add_parsed_property(prefix + _t("-width"),	tokens[0], important);
 			add_parsed_property(prefix + _t("-style"),	tokens[1], important);
@@ -505,13 +650,13 @@ void litehtml::style::parse_short_background( const tstring& val, const tchar_t*
 				add_parsed_property(_t("background-image-baseurl"), baseurl, important);
 			}
 
-		} else if( value_in_list(tok->c_str(), background_repeat_strings) )
+		} else if( keyword_index(background_repeat_keywords, tok->c_str()) >= 0 )
 		{
 			add_parsed_property(_t("background-repeat"), *tok, important);
-		} else if( value_in_list(tok->c_str(), background_attachment_strings) )
+		} else if( keyword_index(background_attachment_keywords, tok->c_str()) >= 0 )
 		{
 			add_parsed_property(_t("background-attachment"), *tok, important);
-		} else if( value_in_list(tok->c_str(), background_box_strings) )
+		} else if( keyword_index(background_box_keywords, tok->c_str()) >= 0 )
 		{
 			if(!origin_found)
 			{
@@ -527,12 +672,14 @@ void litehtml::style::parse_short_background( const tstring& val, const tchar_t*
 					(*tok)[0] == _t('.')	||
 					(*tok)[0] == _t('+'))
 		{
-			if(m_properties.find(_t("background-position")) != m_properties.end())
+			property_value* pos = find(prop_background_position);
+			if(pos)
 			{
-				m_properties[_t("background-position")].m_value = m_properties[_t("background-position")].m_value + _t(" ") + *tok;
+				pos->m_value = pos->m_value + _t(" ") + *tok;
+				pos->parse_value();
 			} else
 			{
-				add_parsed_property(_t("background-position"), *tok, important);
+				add_parsed_property(prop_background_position, *tok, important);
 			}
 		}
 	}
@@ -555,7 +702,7 @@ void litehtml::style::parse_short_font( const tstring& val, bool important )
 	tstring font_family;
 	for(string_vector::iterator tok = tokens.begin(); tok != tokens.end(); tok++)
 	{
-		idx = value_index(tok->c_str(), font_style_strings);
+		idx = keyword_index(font_style_keywords, tok->c_str());
 		if(!is_family)
 		{
 			if(idx >= 0)
@@ -571,12 +718,12 @@ void litehtml::style::parse_short_font( const tstring& val, bool important )
 				}
 			} else
 			{
-				if(value_in_list(tok->c_str(), font_weight_strings))
+				if(keyword_index(font_weight_keywords, tok->c_str()) >= 0)
 				{
 					add_parsed_property(_t("font-weight"),		*tok, important);
 				} else
 				{
-					if(value_in_list(tok->c_str(), font_variant_strings))
+					if(keyword_index(font_variant_keywords, tok->c_str()) >= 0)
 					{
 						add_parsed_property(_t("font-variant"),	*tok, important);
 					} else if( iswdigit((*tok)[0]) )
@@ -609,28 +756,80 @@ void litehtml::style::parse_short_font( const tstring& val, bool important )
 
 void litehtml::style::add_parsed_property( const tstring& name, const tstring& val, bool important )
 {
-	props_map::iterator prop = m_properties.find(name);
-	if(prop != m_properties.end())
+	property_id id = property_from_name(name.c_str());
+	if(id != prop_unknown)
+	{
+		add_parsed_property(id, val, important);
+	} else
+	{
+		add_unknown_property(name, property_value(prop_unknown, val.c_str(), important));
+	}
+}
+
+// litehtml doesn't use these, they are kept for element::get_style_property(name)
+void litehtml::style::add_unknown_property( const tstring& name, const property_value& val )
+{
+	props_map::iterator prop = m_unknown.find(name);
+	if(prop == m_unknown.end())
+	{
+		m_unknown.insert(std::make_pair(name, val));
+	} else if( !prop->second.m_important || (val.m_important && prop->second.m_important) )
+	{
+		prop->second = val;
+	}
+}
+
+void litehtml::style::add_parsed_property( property_id id, const tstring& val, bool important )
+{
+	add_parsed_property(property_value(id, val.c_str(), important));
+}
+
+// val is parsed already, so combined styles copy it as is
+void litehtml::style::add_parsed_property( const property_value& val )
+{
+	props_vector::iterator prop = lower_bound(val.m_id);
+	if(prop != m_properties.end() && prop->m_id == val.m_id)
 	{
-		if( !prop->second.m_important || (important && prop->second.m_important) )
+		if( !prop->m_important || (val.m_important && prop->m_important) )
 		{
-			prop->second.m_value		= val;
-			prop->second.m_important	= important;
+			*prop = val;
 		}
 	} else
 	{
-		m_properties[name] = property_value(val.c_str(), important);
+		m_properties.insert(prop, val);
+		m_mask[val.m_id / 32] |= 1u << (val.m_id % 32);
 	}
 }
 
-void litehtml::style::remove_property( const tstring& name, bool important )
+void litehtml::style::remove_property( property_id id, bool important )
 {
-	props_map::iterator prop = m_properties.find(name);
-	if(prop != m_properties.end())
+	props_vector::iterator prop = lower_bound(id);
+	if(prop != m_properties.end() && prop->m_id == id)
 	{
-		if( !prop->second.m_important || (important && prop->second.m_important) )
+		if( !prop->m_important || (important && prop->m_important) )
 		{
 			m_properties.erase(prop);
+			m_mask[id / 32] &= ~(1u << (id % 32));
+		}
+	}
+}
+
+litehtml::props_vector::iterator litehtml::style::lower_bound( property_id id )
+{
+	props_vector::iterator first = m_properties.begin();
+	int count = (int) m_properties.size();
+	while(count > 0)
+	{
+		int step = count / 2;
+		props_vector::iterator mid = first + step;
+		if(mid->m_id < id)
+		{
+			first = mid + 1;
+			count -= step + 1;
+		} else
+		{
+			count = step;
 		}
 	}
+	return first;
 }
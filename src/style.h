@@ -1,56 +1,104 @@
 #pragma once
 #include "attributes.h"
+#include "css_length.h"
+#include "web_color.h"
 #include <string>
 
 namespace litehtml
 {
+	enum property_id
+	{
+#define LITEHTML_PROPERTY(id, name, type, keywords, def)	id,
+#include "properties.h"
+#undef LITEHTML_PROPERTY
+
+		prop_count,
+		prop_unknown = prop_count
+	};
+
+	enum property_type
+	{
+		prop_type_string,
+		prop_type_keyword,
+		prop_type_length,
+		prop_type_color
+	};
+
+	// prop_unknown for names not in properties.h
+	property_id		property_from_name(const tchar_t* name);
+	const tchar_t*	property_name(property_id id);
+
+	// The value is parsed by the type of the property once, when it is
+	// added to a style. Elements copy the parsed value along with the text.
 	class property_value
 	{
 	public:
-		tstring	m_value;
+		property_id		m_id;
+		tstring			m_value;
 		bool			m_important;
+		bool			m_inherit;	// m_value is "inherit"
+		int				m_keyword;	// prop_type_keyword: index in the keyword list or -1
+		css_length		m_length;	// prop_type_length
+		web_color		m_color;	// prop_type_color
 
 		property_value()
 		{
+			m_id		= prop_unknown;
 			m_important = false;
+			m_inherit	= false;
+			m_keyword	= -1;
 		}
-		property_value(const tchar_t* val, bool imp)
+		property_value(property_id id, const tchar_t* val, bool imp)
 		{
+			m_id		= id;
 			m_important = imp;
 			m_value		= val;
+			parse_value();
 		}
 		property_value(const property_value& val)
 		{
-			m_value		= val.m_value;
-			m_important	= val.m_important;
+			*this = val;
 		}
 
 		property_value& operator=(const property_value& val)
 		{
+			m_id		= val.m_id;
 			m_value		= val.m_value;
 			m_important	= val.m_important;
+			m_inherit	= val.m_inherit;
+			m_keyword	= val.m_keyword;
+			m_length	= val.m_length;
+			m_color		= val.m_color;
 			return *this;
 		}
+
+		// updates the typed fields from m_value
+		void parse_value();
+
+		// value of the property if no style sets it, 0 if there is none in properties.h
+		static const property_value* get_default(property_id id);
 	};
 
+	typedef std::vector<property_value>	props_vector;
 	typedef std::map<tstring, property_value>	props_map;
 
+	const int style_mask_size = (prop_count + 31) / 32;
+
 	class style : public object
 	{
 	public:
 		typedef object_ptr<style>			ptr;
 		typedef std::vector<style::ptr>		vector;
 	private:
-		props_map	m_properties;
+		props_vector	m_properties;				// sorted by m_id
+		unsigned int	m_mask[style_mask_size];	// bit per property present in m_properties
+		props_map		m_unknown;					// names not in properties.h, for the container
 	public:
 		style();
 		style(const style& val);
 		virtual ~style();
 
-		void operator=(const style& val)
-		{
-			m_properties = val.m_properties;
-		}
+		void operator=(const style& val);
 
 		void add(const tchar_t* txt, const tchar_t* baseurl)
 		{
@@ -59,25 +107,36 @@ namespace litehtml
 
 		void add_property(const tchar_t* name, const tchar_t* val, const tchar_t* baseurl, bool important);
 
-		const tchar_t* get_property(const tchar_t* name) const
+		const tchar_t* get_property(property_id id) const
 		{
-			if(name)
+			const property_value* prop = find(id);
+			if(prop)
 			{
-				props_map::const_iterator f = m_properties.find(name);
-				if(f != m_properties.end())
-				{
-					return f->second.m_value.c_str();
-				}
+				return prop->m_value.c_str();
 			}
 			return 0;
 		}
 
-		void combine(const litehtml::style& src);
-		void clear()
+		const property_value* get_value(property_id id) const
 		{
-			m_properties.clear();
+			return find(id);
 		}
 
+		const tchar_t* get_property(const tchar_t* name) const
+		{
+			const property_value* prop = get_value(name);
+			if(prop)
+			{
+				return prop->m_value.c_str();
+			}
+			return 0;
+		}
+
+		const property_value* get_value(const tchar_t* name) const;
+
+		void combine(const litehtml::style& src);
+		void clear();
+
 	private:
 		void parse_property(const tstring& txt, const tchar_t* baseurl);
 		void parse(const tchar_t* txt, const tchar_t* baseurl);
@@ -85,7 +144,14 @@ namespace litehtml
 		void parse_short_background(const tstring& val, const tchar_t* baseurl, bool important);
 		void parse_short_font(const tstring& val, bool important);
 		void add_parsed_property(const tstring& name, const tstring& val, bool important);
-		void remove_property(const tstring& name, bool important);
+		void add_parsed_property(property_id id, const tstring& val, bool important);
+		void add_parsed_property(const property_value& val);
+		void add_unknown_property(const tstring& name, const property_value& val);
+		void remove_property(property_id id, bool important);
+
+		const property_value*	find(property_id id) const;
+		property_value*			find(property_id id);
+		props_vector::iterator	lower_bound(property_id id);
 	};
 
 /*
@@ -115,4 +181,38 @@ namespace litehtml
 		}
 	};
 */
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inline functions
+	//////////////////////////////////////////////////////////////////////////
+
+	inline const property_value* style::find(property_id id) const
+	{
+		if(id >= prop_count || !(m_mask[id / 32] & (1u << (id % 32))))
+		{
+			return 0;
+		}
+		int lo = 0;
+		int hi = (int) m_properties.size() - 1;
+		while(lo <= hi)
+		{
+			int mid = (lo + hi) / 2;
+			if(m_properties[mid].m_id < id)
+			{
+				lo = mid + 1;
+			} else if(m_properties[mid].m_id > id)
+			{
+				hi = mid - 1;
+			} else
+			{
+				return &m_properties[mid];
+			}
+		}
+		return 0;
+	}
+
+	inline property_value* style::find(property_id id)
+	{
+		return const_cast<property_value*>(((const style*) this)->find(id));
+	}
 }
\ No newline at end of file
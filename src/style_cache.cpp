@@ -0,0 +1,18 @@
+#include "html.h"
+#include "style_cache.h"
+
+litehtml::style_cache::style_cache()
+{
+	m_last_id = 0;
+	clear();
+}
+
+void litehtml::style_cache::clear()
+{
+	for(int i = 0; i < style_cache_size; i++)
+	{
+		m_entries[i].el			= 0;
+		m_entries[i].style_id	= 0;
+		m_entries[i].applied.clear();
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+namespace litehtml
+{
+	class html_tag;
+
+	// Elements styled in the current cascade pass. An element that matched
+	// the same rules as a cached one, and had an equal m_style before the
+	// pass, copies its m_style instead of combining the rules again, see
+	// html_tag::apply_styles(). Direct-mapped: a new entry replaces the
+	// one in its slot.
+	const int style_cache_size = 256;
+
+	class style_cache
+	{
+	public:
+		struct entry
+		{
+			html_tag*			el;
+			int					style_id;	// el's m_style id before the pass
+			style::vector		applied;	// styles el combined in the pass
+		};
+	private:
+		entry		m_entries[style_cache_size];
+		int			m_last_id;
+	public:
+		style_cache();
+
+		entry&		find(unsigned int hash);
+		// returns an id not used before in this document
+		int			new_id();
+		void		clear();
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inline functions
+	//////////////////////////////////////////////////////////////////////////
+
+	inline style_cache::entry& style_cache::find(unsigned int hash)
+	{
+		return m_entries[hash % style_cache_size];
+	}
+
+	inline int style_cache::new_id()
+	{
+		return ++m_last_id;
+	}
+}
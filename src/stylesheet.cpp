@@ -117,6 +117,7 @@ bool litehtml::css::parse_selectors( const tstring& txt, litehtml::style::ptr st
 		if(selector->parse(*tok))
 		{
 			selector->calc_specificity();
+			selector->calc_ancestor_hashes();
 			add_selector(selector);
 			added_something = true;
 		}
@@ -128,6 +129,129 @@ bool litehtml::css::parse_selectors( const tstring& txt, litehtml::style::ptr st
 void litehtml::css::sort_selectors()
 {
 	sort(m_selectors.begin(), m_selectors.end(), std::less<css_selector::ptr>( ));
+	build_index();
+}
+
+void litehtml::css::build_index()
+{
+	m_id_index.clear();
+	m_class_index.clear();
+	m_tag_index.clear();
+	m_universal.clear();
+
+	for(int i = 0; i < (int) m_selectors.size(); i++)
+	{
+		const css_element_selector& right = m_selectors[i]->m_right;
+
+		// id and class values are compared case-insensitively, so the keys are lowercase
+		tstring id;
+		tstring cls;
+		bool has_id = false;
+		for(css_attribute_selector::vector::const_iterator attr = right.m_attrs.begin(); attr != right.m_attrs.end() && !has_id; attr++)
+		{
+			if(attr->condition != select_equal)
+			{
+				continue;
+			}
+			if(attr->attribute == _t("id"))
+			{
+				id = attr->val;
+				has_id = true;
+			} else if(attr->attribute == _t("class") && cls.empty())
+			{
+				// the element must have every listed class, the first one is enough as a key
+				string_vector tokens;
+				split_string(attr->val, tokens, _t(" "));
+				if(!tokens.empty())
+				{
+					cls = tokens.front();
+				}
+			}
+		}
+
+		if(has_id)
+		{
+			lcase(id);
+			m_id_index[id].push_back(i);
+		} else if(!cls.empty())
+		{
+			lcase(cls);
+			m_class_index[cls].push_back(i);
+		} else if(!right.m_tag.empty() && right.m_tag != _t("*"))
+		{
+			tstring tag = right.m_tag;
+			lcase(tag);
+			m_tag_index[tag].push_back(i);
+		} else
+		{
+			m_universal.push_back(i);
+		}
+	}
+	m_indexed = true;
+}
+
+void litehtml::css::resolve_atoms( atom_pool& atoms ) const
+{
+	for(css_selector::vector::const_iterator i = m_selectors.begin(); i != m_selectors.end(); i++)
+	{
+		for(const css_selector* sel = *i; sel; sel = sel->m_left)
+		{
+			sel->m_right.resolve_atoms(atoms);
+		}
+	}
+}
+
+bool litehtml::css::find_candidates( const tchar_t* tag, const tchar_t* id, const tchar_t* classes, std::vector<int>& res ) const
+{
+	res.clear();
+	if(!m_indexed)
+	{
+		return false;
+	}
+
+	res.insert(res.end(), m_universal.begin(), m_universal.end());
+
+	tstring key;
+	selector_index::const_iterator found;
+	if(tag && !m_tag_index.empty())
+	{
+		key = tag;
+		lcase(key);
+		found = m_tag_index.find(key);
+		if(found != m_tag_index.end())
+		{
+			res.insert(res.end(), found->second.begin(), found->second.end());
+		}
+	}
+	if(id && !m_id_index.empty())
+	{
+		key = id;
+		lcase(key);
+		found = m_id_index.find(key);
+		if(found != m_id_index.end())
+		{
+			res.insert(res.end(), found->second.begin(), found->second.end());
+		}
+	}
+	if(classes && classes[0] && !m_class_index.empty())
+	{
+		string_vector tokens;
+		split_string(classes, tokens, _t(" "));
+		for(string_vector::iterator tok = tokens.begin(); tok != tokens.end(); tok++)
+		{
+			lcase(*tok);
+			found = m_class_index.find(*tok);
+			if(found != m_class_index.end())
+			{
+				res.insert(res.end(), found->second.begin(), found->second.end());
+			}
+		}
+	}
+
+	// every selector is in one bucket only, but a class can be listed twice
+	std::sort(res.begin(), res.end());
+	res.erase(std::unique(res.begin(), res.end()), res.end());
+	return true;
 }
 
 void litehtml::css::parse_atrule( const tstring& text, const tchar_t* baseurl, document* doc, media_query_list::ptr& media )
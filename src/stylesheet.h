@@ -8,11 +8,20 @@ namespace litehtml
 
 	class css
 	{
+		// Positions in m_selectors (ascending) of the selectors whose
+		// rightmost compound selector has the given id, class or tag
+		typedef std::map<tstring, std::vector<int> >	selector_index;
+
 		css_selector::vector	m_selectors;
+		selector_index			m_id_index;
+		selector_index			m_class_index;
+		selector_index			m_tag_index;
+		std::vector<int>		m_universal;	// selectors without an id, class or tag
+		bool					m_indexed;
 	public:
 		css()
 		{
-
+			m_indexed = false;
 		}
 		
 		~css()
@@ -28,16 +37,29 @@ namespace litehtml
 		void clear()
 		{
 			m_selectors.clear();
+			m_id_index.clear();
+			m_class_index.clear();
+			m_tag_index.clear();
+			m_universal.clear();
+			m_indexed = false;
 		}
 
 		void	parse_stylesheet(const tchar_t* str, const tchar_t* baseurl, document* doc, media_query_list::ptr& media);
 		void	sort_selectors();
+		// Fills res with the positions in selectors() of the rules an element
+		// with this tag, id and class attributes can match, in selectors() order.
+		// Returns false if the stylesheet is not indexed (sort_selectors() was
+		// not called after the last change), all selectors must be tested then.
+		bool	find_candidates(const tchar_t* tag, const tchar_t* id, const tchar_t* classes, std::vector<int>& res) const;
+		// resolves the atoms of all selectors, html_tag::select() does it lazily otherwise
+		void	resolve_atoms(atom_pool& atoms) const;
 		static void	parse_css_url(const tstring& str, tstring& url);
 
 	private:
 		void	parse_atrule(const tstring& text, const tchar_t* baseurl, document* doc, media_query_list::ptr& media);
 		void	add_selector(css_selector::ptr selector);
 		bool	parse_selectors(const tstring& txt, litehtml::style::ptr styles, media_query_list::ptr& media);
+		void	build_index();
 
 	};
 
@@ -45,6 +67,7 @@ namespace litehtml
 	{
 		selector->m_order = (int) m_selectors.size();
 		m_selectors.push_back(selector);
+		m_indexed = false;
 	}
 
 }
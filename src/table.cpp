@@ -380,6 +380,51 @@ int litehtml::table_grid::calc_table_width( int block_width, bool is_auto )
 	return cur_width;
 }
 
+// table-layout: fixed. The columns with a width take it, the others share
+// the rest of block_width equally, the contents of the cells don't count.
+int litehtml::table_grid::calc_fixed_table_width( int block_width )
+{
+	int fixed_width	= 0;
+	int auto_count	= 0;
+	for(int col = 0; col < m_cols_count; col++)
+	{
+		if(!m_columns[col].css_width.is_predefined())
+		{
+			m_columns[col].width = m_columns[col].css_width.calc_percent(block_width);
+			fixed_width += m_columns[col].width;
+		} else
+		{
+			m_columns[col].width = 0;
+			auto_count++;
+		}
+	}
+
+	int rest = block_width - fixed_width;
+	if(rest > 0)
+	{
+		int idx = 0;
+		for(int col = 0; col < m_cols_count; col++)
+		{
+			if(!auto_count)
+			{
+				// the table is wider than the columns
+				m_columns[col].width += rest * (col + 1) / m_cols_count - rest * col / m_cols_count;
+			} else if(m_columns[col].css_width.is_predefined())
+			{
+				m_columns[col].width = rest * (idx + 1) / auto_count - rest * idx / auto_count;
+				idx++;
+			}
+		}
+	}
+
+	int cur_width = 0;
+	for(int col = 0; col < m_cols_count; col++)
+	{
+		cur_width += m_columns[col].width;
+	}
+	return cur_width;
+}
+
 void litehtml::table_grid::clear()
 {
 	m_rows_count	= 0;
@@ -130,6 +130,9 @@ namespace litehtml
 		int				width;
 		int				height;
 		margins			borders;
+		int				measured_width;	// max_width min_width and max_width of the text were found at, -1 if they are not kept
+		bool			measured_line;	// the text was one line at measured_width
+		bool			measure_kept;	// min_width and max_width are kept from an earlier layout, the cell was not rendered
 
 		table_cell()
 		{
@@ -142,6 +145,9 @@ namespace litehtml
 			colspan			= 1;
 			rowspan			= 1;
 			el				= 0;
+			measured_width	= -1;
+			measured_line	= false;
+			measure_kept	= false;
 		}
 
 		table_cell(const table_cell& val)
@@ -156,6 +162,9 @@ namespace litehtml
 			max_width		= val.max_width;
 			max_height		= val.max_height;
 			borders			= val.borders;
+			measured_width	= val.measured_width;
+			measured_line	= val.measured_line;
+			measure_kept	= val.measure_kept;
 		}
 	};
 
@@ -194,6 +203,7 @@ namespace litehtml
 		void			distribute_width(int width, int start, int end);
 		void			distribute_width(int width, int start, int end, table_column_accessor* acc);
 		int				calc_table_width(int block_width, bool is_auto);
+		int				calc_fixed_table_width(int block_width);
 		void			calc_horizontal_positions(margins& table_borders, border_collapse bc, int bdr_space_x);
 		void			calc_vertical_positions(margins& table_borders, border_collapse bc, int bdr_space_y);
 	};
@@ -0,0 +1,66 @@
+#include "html.h"
+#include "text_cache.h"
+
+bool litehtml::text_cache::key::operator<( const key& val ) const
+{
+	if(font != val.font)
+	{
+		return font < val.font;
+	}
+	return text < val.text;
+}
+
+litehtml::text_cache::text_cache()
+{
+	m_hits		= 0;
+	m_misses	= 0;
+}
+
+bool litehtml::text_cache::find( uint_ptr font, const tchar_t* text, int& width )
+{
+	key k;
+	k.font	= font;
+	k.text	= text;
+
+	items_map::iterator i = m_index.find(k);
+	if(i == m_index.end())
+	{
+		m_misses++;
+		return false;
+	}
+	m_hits++;
+	if(i->second != m_items.begin())
+	{
+		m_items.splice(m_items.begin(), m_items, i->second);
+	}
+	width = i->second->width;
+	return true;
+}
+
+void litehtml::text_cache::add( uint_ptr font, const tchar_t* text, int width )
+{
+	item it;
+	it.name.font	= font;
+	it.name.text	= text;
+	it.width		= width;
+
+	std::pair<items_map::iterator, bool> ins = m_index.insert(items_map::value_type(it.name, m_items.end()));
+	if(!ins.second)
+	{
+		return;
+	}
+	m_items.push_front(it);
+	ins.first->second = m_items.begin();
+
+	if((int) m_index.size() > text_cache_size)
+	{
+		m_index.erase(m_items.back().name);
+		m_items.pop_back();
+	}
+}
+
+void litehtml::text_cache::clear()
+{
+	m_items.clear();
+	m_index.clear();
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+namespace litehtml
+{
+	// Widths returned by document_container::text_width() for the fonts
+	// of one document, see document::queue_text_width() and
+	// document::flush_text_widths(). Once text_cache_size entries are
+	// kept, the least recently used one is dropped.
+	const int text_cache_size = 4096;
+
+	// Word waiting in document::queue_text_width() to be measured
+	struct text_request
+	{
+		typedef std::vector<text_request>	vector;
+
+		object_ptr<object>	owner;	// holds text and width, init() may remove it from the tree before the flush
+		const tchar_t*		text;
+		uint_ptr			font;
+		int*				width;
+		int					index;	// position in the container batch, -1 if cached
+	};
+
+	class text_cache
+	{
+		struct key
+		{
+			uint_ptr	font;
+			tstring		text;
+
+			bool operator<(const key& val) const;
+		};
+
+		struct item
+		{
+			key		name;
+			int		width;
+		};
+
+		typedef std::list<item>							items_list;
+		typedef std::map<key, items_list::iterator>		items_map;
+
+		items_list	m_items;	// most recently used first
+		items_map	m_index;
+		int			m_hits;
+		int			m_misses;
+	public:
+		text_cache();
+
+		// returns false if the width of text is not known yet
+		bool	find(uint_ptr font, const tchar_t* text, int& width);
+		void	add(uint_ptr font, const tchar_t* text, int width);
+		void	clear();
+		int		hits() const;
+		int		misses() const;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inline functions
+	//////////////////////////////////////////////////////////////////////////
+
+	inline int text_cache::hits() const
+	{
+		return m_hits;
+	}
+
+	inline int text_cache::misses() const
+	{
+		return m_misses;
+	}
+}
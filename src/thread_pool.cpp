@@ -0,0 +1,281 @@
+#include "html.h"
+#include "thread_pool.h"
+
+#if defined( WIN32 ) || defined( WINCE )
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+namespace
+{
+	class mutex
+	{
+#if defined( WIN32 ) || defined( WINCE )
+		CRITICAL_SECTION	m_cs;
+	public:
+		mutex()			{ InitializeCriticalSection(&m_cs);	}
+		~mutex()		{ DeleteCriticalSection(&m_cs);		}
+		void lock()		{ EnterCriticalSection(&m_cs);		}
+		void unlock()	{ LeaveCriticalSection(&m_cs);		}
+#else
+		pthread_mutex_t		m_mutex;
+	public:
+		mutex()			{ pthread_mutex_init(&m_mutex, 0);	}
+		~mutex()		{ pthread_mutex_destroy(&m_mutex);	}
+		void lock()		{ pthread_mutex_lock(&m_mutex);		}
+		void unlock()	{ pthread_mutex_unlock(&m_mutex);	}
+#endif
+	};
+
+	class semaphore
+	{
+#if defined( WIN32 ) || defined( WINCE )
+		HANDLE				m_sem;
+	public:
+		semaphore()			{ m_sem = CreateSemaphore(NULL, 0, LONG_MAX, NULL);	}
+		~semaphore()		{ CloseHandle(m_sem);									}
+		void post(int n)	{ ReleaseSemaphore(m_sem, n, NULL);					}
+		void wait()			{ WaitForSingleObject(m_sem, INFINITE);				}
+#else
+		pthread_mutex_t		m_mutex;
+		pthread_cond_t		m_cond;
+		int					m_count;
+	public:
+		semaphore() : m_count(0)
+		{
+			pthread_mutex_init(&m_mutex, 0);
+			pthread_cond_init(&m_cond, 0);
+		}
+		~semaphore()
+		{
+			pthread_cond_destroy(&m_cond);
+			pthread_mutex_destroy(&m_mutex);
+		}
+		void post(int n)
+		{
+			pthread_mutex_lock(&m_mutex);
+			m_count += n;
+			pthread_cond_broadcast(&m_cond);
+			pthread_mutex_unlock(&m_mutex);
+		}
+		void wait()
+		{
+			pthread_mutex_lock(&m_mutex);
+			while(!m_count)
+			{
+				pthread_cond_wait(&m_cond, &m_mutex);
+			}
+			m_count--;
+			pthread_mutex_unlock(&m_mutex);
+		}
+#endif
+	};
+
+	struct task_range
+	{
+		mutex	lock;
+		int		begin;
+		int		end;
+	};
+}
+
+struct litehtml::thread_pool_state
+{
+#if defined( WIN32 ) || defined( WINCE )
+	typedef HANDLE		thread_handle;
+#else
+	typedef pthread_t	thread_handle;
+#endif
+
+	mutex						lock;		// guards busy, stop and next_worker
+	bool						busy;
+	bool						stop;
+	semaphore					start;		// one post per worker taking part in a run
+	semaphore					done;		// posted by a worker when it has no more tasks
+	std::vector<thread_handle>	threads;
+
+	// the current run
+	parallel_tasks*				tasks;
+	std::vector<task_range*>	ranges;
+	int							ranges_count;
+	int							next_worker;
+
+	thread_pool_state() : busy(false), stop(false), tasks(0), ranges_count(0), next_worker(0) {}
+
+	bool next_task(int index, int& task)
+	{
+		task_range& own = *ranges[index];
+		own.lock.lock();
+		if(own.begin < own.end)
+		{
+			task = own.begin++;
+			own.lock.unlock();
+			return true;
+		}
+		own.lock.unlock();
+
+		for(int i = 1; i < ranges_count; i++)
+		{
+			task_range& victim = *ranges[(index + i) % ranges_count];
+			victim.lock.lock();
+			if(victim.begin < victim.end)
+			{
+				task = --victim.end;
+				victim.lock.unlock();
+				return true;
+			}
+			victim.lock.unlock();
+		}
+		return false;
+	}
+
+	void run_worker(int index)
+	{
+		int task;
+		while(next_task(index, task))
+		{
+			tasks->run_task(task);
+		}
+	}
+
+	// returns false when the pool is destroyed
+	bool worker_loop()
+	{
+		start.wait();
+		lock.lock();
+		if(stop)
+		{
+			lock.unlock();
+			return false;
+		}
+		int index = next_worker++;
+		lock.unlock();
+
+		run_worker(index);
+		done.post(1);
+		return true;
+	}
+
+	bool start_thread();
+};
+
+namespace
+{
+#if defined( WIN32 ) || defined( WINCE )
+	DWORD WINAPI worker_proc(LPVOID param)
+	{
+		while(((litehtml::thread_pool_state*) param)->worker_loop()) {}
+		return 0;
+	}
+#else
+	void* worker_proc(void* param)
+	{
+		while(((litehtml::thread_pool_state*) param)->worker_loop()) {}
+		return 0;
+	}
+#endif
+}
+
+bool litehtml::thread_pool_state::start_thread()
+{
+#if defined( WIN32 ) || defined( WINCE )
+	HANDLE th = CreateThread(NULL, 0, worker_proc, this, 0, NULL);
+	if(!th)
+	{
+		return false;
+	}
+#else
+	pthread_t th;
+	if(pthread_create(&th, 0, worker_proc, this))
+	{
+		return false;
+	}
+#endif
+	threads.push_back(th);
+	return true;
+}
+
+litehtml::thread_pool::thread_pool()
+{
+	m_state = new thread_pool_state;
+}
+
+litehtml::thread_pool::~thread_pool()
+{
+	m_state->lock.lock();
+	m_state->stop = true;
+	m_state->lock.unlock();
+	m_state->start.post((int) m_state->threads.size());
+
+	for(size_t i = 0; i < m_state->threads.size(); i++)
+	{
+#if defined( WIN32 ) || defined( WINCE )
+		WaitForSingleObject(m_state->threads[i], INFINITE);
+		CloseHandle(m_state->threads[i]);
+#else
+		pthread_join(m_state->threads[i], 0);
+#endif
+	}
+	for(size_t i = 0; i < m_state->ranges.size(); i++)
+	{
+		delete m_state->ranges[i];
+	}
+	delete m_state;
+}
+
+void litehtml::thread_pool::run( parallel_tasks& tasks, int count, int threads_count )
+{
+	if(threads_count > count)
+	{
+		threads_count = count;
+	}
+
+	bool busy = true;
+	if(threads_count > 1)
+	{
+		m_state->lock.lock();
+		busy = m_state->busy;
+		m_state->busy = true;
+		m_state->lock.unlock();
+	}
+	if(busy)
+	{
+		for(int i = 0; i < count; i++)
+		{
+			tasks.run_task(i);
+		}
+		return;
+	}
+
+	// a thread that fails to start leaves its share to the others
+	while((int) m_state->threads.size() < threads_count - 1 && m_state->start_thread())
+	{
+	}
+	int workers = std::min(threads_count - 1, (int) m_state->threads.size());
+
+	while((int) m_state->ranges.size() < workers + 1)
+	{
+		m_state->ranges.push_back(new task_range);
+	}
+	for(int i = 0; i <= workers; i++)
+	{
+		m_state->ranges[i]->begin	= count * i / (workers + 1);
+		m_state->ranges[i]->end		= count * (i + 1) / (workers + 1);
+	}
+	m_state->ranges_count	= workers + 1;
+	m_state->tasks			= &tasks;
+	m_state->next_worker	= 1;
+
+	m_state->start.post(workers);
+	m_state->run_worker(0);
+	for(int i = 0; i < workers; i++)
+	{
+		m_state->done.wait();
+	}
+
+	m_state->lock.lock();
+	m_state->tasks	= 0;
+	m_state->busy	= false;
+	m_state->lock.unlock();
+}
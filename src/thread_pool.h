@@ -0,0 +1,36 @@
+#pragma once
+
+namespace litehtml
+{
+	// Work of thread_pool::run(): tasks are numbered 0..count-1
+	class parallel_tasks
+	{
+	public:
+		virtual ~parallel_tasks() {}
+		virtual void run_task(int task) = 0;
+	};
+
+	struct thread_pool_state;
+
+	// Worker threads kept by litehtml::context for the parallel cascade and
+	// layout. They are started by the first run() that needs them and wait
+	// for the next one until the pool is destroyed.
+	class thread_pool
+	{
+		thread_pool_state*	m_state;
+	public:
+		thread_pool();
+		~thread_pool();
+
+		// Runs all tasks on threads_count threads, the calling one included,
+		// and returns when they are done. Every thread starts with its own
+		// contiguous range of tasks and, once it is empty, steals tasks from
+		// the end of the other ranges. Tasks must not share mutable state.
+		// A run() while another one is in progress runs its tasks on the
+		// calling thread.
+		void run(parallel_tasks& tasks, int count, int threads_count);
+	private:
+		thread_pool(const thread_pool&);
+		thread_pool& operator=(const thread_pool&);
+	};
+}
@@ -478,6 +478,14 @@ namespace litehtml
 		border_collapse_separate,
 	};
 
+#define table_layout_strings		_t("auto;fixed")
+
+	enum table_layout
+	{
+		table_layout_auto,
+		table_layout_fixed,
+	};
+
 
 #define pseudo_class_strings		_t("only-child;only-of-type;first-child;first-of-type;last-child;last-of-type;nth-child;nth-of-type;nth-last-child;nth-last-of-type;not")
 
@@ -691,6 +699,14 @@ namespace litehtml
 		render_fixed_only,
 	};
 
+	// element::m_dirty bits, set when styles are refreshed after a pseudo class change
+	enum dirty_flags
+	{
+		dirty_style			= 0x01,	// styles were refreshed, computed values are not checked yet
+		dirty_layout		= 0x02,	// the element must be laid out again
+		dirty_child_layout	= 0x04,	// some descendant has dirty_layout
+	};
+
 	// List of the Void Elements (can't have any contents)
 	const litehtml::tchar_t* const void_elements = _t("area;base;br;col;command;embed;hr;img;input;keygen;link;meta;param;source;track;wbr");
 }
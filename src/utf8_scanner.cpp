@@ -0,0 +1,631 @@
+#include "html.h"
+#include "utf8_scanner.h"
+
+#ifdef LITEHTML_UTF8
+
+#if !defined(LITEHTML_NO_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define LITEHTML_SSE2
+#include <emmintrin.h>
+#endif
+
+// Returns the first char of str that is below min_char (this includes the
+// terminating zero at end), is not ASCII or is one of the stop chars.
+static const litehtml::tchar_t* skip_run(const litehtml::tchar_t* str, const litehtml::tchar_t* end, litehtml::tchar_t min_char, litehtml::tchar_t stop1, litehtml::tchar_t stop2)
+{
+	// most runs are short words, check them without the vector setup
+	for(int i = 0; i < 16; i++, str++)
+	{
+		unsigned char c = (unsigned char) *str;
+		if(c < (unsigned char) min_char || c >= 0x80 || c == (unsigned char) stop1 || c == (unsigned char) stop2)
+		{
+			return str;
+		}
+	}
+#ifdef LITEHTML_SSE2
+	// whole 16 byte chunks before end only, the tail is checked one char at a time
+	const __m128i vmin	= _mm_set1_epi8(min_char);
+	const __m128i vstop1	= _mm_set1_epi8(stop1);
+	const __m128i vstop2	= _mm_set1_epi8(stop2);
+	for(; end - str >= 16; str += 16)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*) str);
+		// signed compare catches both bytes below min_char and non-ASCII bytes
+		__m128i stop = _mm_or_si128(_mm_cmpgt_epi8(vmin, v),
+						_mm_or_si128(_mm_cmpeq_epi8(v, vstop1), _mm_cmpeq_epi8(v, vstop2)));
+		unsigned int bits = _mm_movemask_epi8(stop);
+		if(bits)
+		{
+			int i = 0;
+			while(!(bits & 1))
+			{
+				bits >>= 1;
+				i++;
+			}
+			return str + i;
+		}
+	}
+#endif
+	for(;; str++)
+	{
+		unsigned char c = (unsigned char) *str;
+		if(c < (unsigned char) min_char || c >= 0x80 || c == (unsigned char) stop1 || c == (unsigned char) stop2)
+		{
+			return str;
+		}
+	}
+}
+
+void litehtml::utf8_span::clear()
+{
+	m_start		= 0;
+	m_length	= 0;
+	m_copied	= false;
+	m_copy.clear();
+}
+
+void litehtml::utf8_span::append( const tchar_t* src, size_t len )
+{
+	if(!m_copied)
+	{
+		if(!m_length)
+		{
+			m_start		= src;
+			m_length	= len;
+			return;
+		}
+		if(m_start + m_length == src)
+		{
+			m_length += len;
+			return;
+		}
+		make_copy();
+	}
+	m_copy.append(src, len);
+}
+
+void litehtml::utf8_span::append( ucode_t code )
+{
+	make_copy();
+	if (code <= 0x7F)
+	{
+		m_copy += (tchar_t) code;
+	} else if (code <= 0x7FF)
+	{
+		m_copy += (code >> 6) + 192;
+		m_copy += (code & 63) + 128;
+	} else if (0xd800 <= code && code <= 0xdfff)
+	{
+		//invalid block of utf8
+	} else if (code <= 0xFFFF)
+	{
+		m_copy += (code >> 12) + 224;
+		m_copy += ((code >> 6) & 63) + 128;
+		m_copy += (code & 63) + 128;
+	} else if (code <= 0x10FFFF)
+	{
+		m_copy += (code >> 18) + 240;
+		m_copy += ((code >> 12) & 63) + 128;
+		m_copy += ((code >> 6) & 63) + 128;
+		m_copy += (code & 63) + 128;
+	}
+}
+
+void litehtml::utf8_span::erase_tail( size_t len )
+{
+	if(m_copied)
+	{
+		m_copy.erase(m_copy.length() - len);
+	} else
+	{
+		m_length -= len;
+	}
+}
+
+const litehtml::tchar_t* litehtml::utf8_span::data() const
+{
+	if(m_copied)
+	{
+		return m_copy.c_str();
+	}
+	return m_start ? m_start : _t("");
+}
+
+size_t litehtml::utf8_span::length() const
+{
+	if(m_copied)
+	{
+		return m_copy.length();
+	}
+	return m_length;
+}
+
+void litehtml::utf8_span::make_copy()
+{
+	if(!m_copied)
+	{
+		m_copy.assign(m_start ? m_start : _t(""), m_length);
+		m_copied = true;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+litehtml::utf8_scanner::utf8_scanner( const tchar_t* src )
+{
+	m_pos		= src;
+	m_end		= src + t_strlen(src);
+	m_char		= src;
+	m_char_len	= 0;
+	got_tail	= false;
+	c_scan		= &utf8_scanner::scan_body;
+}
+
+litehtml::scanner::token_type litehtml::utf8_scanner::scan_body()
+{
+	ucode_t c = get_char();
+
+	m_value.clear();
+
+	bool ws = false;
+
+	if(c == 0) return scanner::TT_EOF;
+	else if(c == '<') return scan_tag();
+	else if(c == '&')
+		c = scan_entity();
+	else
+		ws = is_whitespace(c);
+	if(!ws)
+	{
+		while(true)
+		{
+			append_char(m_value, c);
+
+			// CJK character range
+			if (c >= 0x4E00 && c <= 0x9FCC)
+			{
+				break;
+			}
+
+			// take the plain ASCII part of the word at once
+			append_run(m_value, 0x21, '<', '&');
+
+			c = get_char();
+			if(c == 0)	{ push_back(c); break; }
+			if(c == '<')	{ push_back(c); break; }
+			if(c == '&')	{ push_back(c); break; }
+
+			if(is_whitespace(c) != ws)
+			{
+				push_back(c);
+				break;
+			}
+		}
+	} else
+	{
+		append_char(m_value, c);
+	}
+
+	return ws ? scanner::TT_SPACE : scanner::TT_WORD;
+}
+
+litehtml::scanner::token_type litehtml::utf8_scanner::scan_head()
+{
+	ucode_t c = skip_whitespace();
+
+	if(c == '>')
+	{
+		if(m_tag_name.length() == 6 && !t_strncasecmp(m_tag_name.data(), _t("script"), 6))
+		{
+			c_scan = &utf8_scanner::scan_raw_body;
+			return scan_raw_body();
+		} else
+		{
+			c_scan = &utf8_scanner::scan_body;
+			return scan_body();
+		}
+	}
+
+	if(c == '/')
+	{
+		ucode_t t = get_char();
+		if(t == '>')   { c_scan = &utf8_scanner::scan_body; return scanner::TT_TAG_END_EMPTY; }
+		else { push_back(t); return scanner::TT_ERROR; } // erroneous situtation - standalone '/'
+	}
+
+	m_attr_name.clear();
+	m_value.clear();
+
+	// attribute name...
+	while(c != '=')
+	{
+		if( c == 0) return scanner::TT_EOF;
+		if( c == '>' ) { push_back(c); return scanner::TT_ATTR; } // attribute without value (HTML style)
+		if( is_whitespace(c) )
+		{
+			c = skip_whitespace();
+			if(c != '=') { push_back(c); return scanner::TT_ATTR; } // attribute without value (HTML style)
+			else break;
+		}
+		if( c == '<') return scanner::TT_ERROR;
+		append_char(m_attr_name, c);
+		c = get_char();
+	}
+
+	c = skip_whitespace();
+	// attribute value...
+
+	if(c == '\"')
+		for(;;)
+		{
+			append_run(m_value, 1, '\"', '&');
+			if( !(c = get_char()) ) break;
+			if(c == '\"') return scanner::TT_ATTR;
+			if(c == '&') c = scan_entity();
+			append_char(m_value, c);
+		}
+	else if(c == '\'') // allowed in html
+		for(;;)
+		{
+			append_run(m_value, 1, '\'', '&');
+			if( !(c = get_char()) ) break;
+			if(c == '\'') return scanner::TT_ATTR;
+			if(c == '&') c = scan_entity();
+			append_char(m_value, c);
+		}
+	else  // scan token, allowed in html: e.g. align=center
+		do
+		{
+			if( is_whitespace(c) ) return scanner::TT_ATTR;
+			if( c == '>' ) { push_back(c); return scanner::TT_ATTR; }
+			append_char(m_value, c);
+		} while( (c = get_char()) );
+
+	return scanner::TT_ERROR;
+}
+
+// caller already consumed '<'
+// scan header start or tag tail
+litehtml::scanner::token_type litehtml::utf8_scanner::scan_tag()
+{
+	m_tag_name.clear();
+
+	ucode_t c = get_char();
+
+	bool is_tail = c == '/';
+	if(is_tail) c = get_char();
+
+	while(c)
+	{
+		if(is_whitespace(c)) { c = skip_whitespace(); break; }
+		if(c == '/' || c == '>') break;
+		append_char(m_tag_name, c);
+
+		switch(m_tag_name.length())
+		{
+		case 3:
+			if(!t_strncmp(m_tag_name.data(), _t("!--"), 3))  { c_scan = &utf8_scanner::scan_comment; return scanner::TT_COMMENT_START; }
+			break;
+		case 8:
+			if(!t_strncmp(m_tag_name.data(), _t("![CDATA["), 8)) { c_scan = &utf8_scanner::scan_cdata; return scanner::TT_CDATA_START; }
+			if(!t_strncmp(m_tag_name.data(), _t("!DOCTYPE"), 8)) { c_scan = &utf8_scanner::scan_entity_decl; return scanner::TT_DOCTYPE_START; }
+			if(!t_strncmp(m_tag_name.data(), _t("!doctype"), 8)) { c_scan = &utf8_scanner::scan_entity_decl; return scanner::TT_DOCTYPE_START; }
+			break;
+		case 7:
+			if(!t_strncmp(m_tag_name.data(), _t("!ENTITY"), 7)) { c_scan = &utf8_scanner::scan_entity_decl; return scanner::TT_ENTITY_START; }
+			break;
+		}
+
+		c = get_char();
+	}
+
+	if(c == 0) return scanner::TT_ERROR;
+
+	if(is_tail)
+	{
+		if(c == '>') return scanner::TT_TAG_END;
+		return scanner::TT_ERROR;
+	}
+	else
+		push_back(c);
+
+	c_scan = &utf8_scanner::scan_head;
+	return scanner::TT_TAG_START;
+}
+
+// skip whitespaces.
+// returns first non-whitespace char
+litehtml::ucode_t litehtml::utf8_scanner::skip_whitespace()
+{
+	while(ucode_t c = get_char())
+	{
+		if(!is_whitespace(c)) return c;
+	}
+	return 0;
+}
+
+// pushed back char is read from the source again
+void litehtml::utf8_scanner::push_back( ucode_t c )
+{
+	if(c)
+	{
+		m_pos = m_char;
+	}
+}
+
+litehtml::ucode_t litehtml::utf8_scanner::get_char()
+{
+	const unsigned char* p = (const unsigned char*) m_pos;
+	ucode_t b1 = *p;
+
+	m_char = m_pos;
+	if(!b1)
+	{
+		m_char_len = 0;
+		return 0;
+	}
+	if(!(b1 & 0x80))
+	{
+		m_pos++;
+		m_char_len = 1;
+		return b1;
+	}
+
+	// decode the same way as utf8_instream does
+	int len;
+	ucode_t r;
+	if ((b1 & 0xe0) == 0xc0)
+	{
+		len = 2;
+		r = b1 & 0x1f;
+	} else if ((b1 & 0xf0) == 0xe0)
+	{
+		len = 3;
+		r = b1 & 0x0f;
+	} else if ((b1 & 0xf8) == 0xf0)
+	{
+		len = 4;
+		r = b1 & 0x07;
+	} else
+	{
+		//bad start for UTF-8 multi-byte sequence
+		m_pos++;
+		m_char_len = 0;
+		return '?';
+	}
+	p++;
+
+	bool valid = true;
+	for(int i = 1; i < len; i++)
+	{
+		r <<= 6;
+		if(!(*p))
+		{
+			valid = false;
+			continue;
+		}
+		if((*p & 0xc0) != 0x80)
+		{
+			valid = false;
+		}
+		r |= *p & 0x3f;
+		p++;
+	}
+	if(valid)
+	{
+		// reject overlong forms and chars we can't encode back
+		switch(len)
+		{
+		case 2:	valid = r > 0x7F;											break;
+		case 3:	valid = r > 0x7FF && (r < 0xd800 || r > 0xdfff);			break;
+		case 4:	valid = r > 0xFFFF && r <= 0x10FFFF;						break;
+		}
+	}
+	m_pos		= (const tchar_t*) p;
+	m_char_len	= valid ? len : 0;
+	return r;
+}
+
+// caller consumed '&'
+litehtml::ucode_t litehtml::utf8_scanner::scan_entity()
+{
+	const tchar_t* start = m_char;
+	tchar_t buf[32];
+	int i = 0;
+	ucode_t t;
+	for(; i < 31 ; ++i )
+	{
+		t = get_char();
+
+		if(t == ';')
+			break;
+
+		if(t == 0) return 0;
+		if( t >= 0x80 || (!isalnum(t) && t != '#') )
+		{
+			push_back(t);
+			t = 0;
+			break; // appears a erroneous entity token.
+			// but we try to use it.
+		}
+		buf[i] = (tchar_t) t;
+	}
+	buf[i] = 0;
+
+	ucode_t entity = 0;
+	if(i == 2 && buf[1] == 't' && (buf[0] == 'g' || buf[0] == 'l'))
+	{
+		entity = buf[0] == 'g' ? '>' : '<';
+	} else if(i == 3 && !t_strcmp(buf, _t("amp")))
+	{
+		entity = '&';
+	} else
+	{
+		if(i == 4 && !t_strcmp(buf, _t("apos")))		entity = '\'';
+		else if(i == 4 && !t_strcmp(buf, _t("quot")))	entity = '\"';
+		else											entity = resolve_entity(buf, i);
+	}
+	if(entity)
+	{
+		// decoded char doesn't match the source
+		m_char_len = 0;
+		return entity;
+	}
+	// no luck ...
+	m_value.append(start, i + 1);
+	if(t) return t;
+	return get_char();
+}
+
+// appends the plain ASCII chars up to the next char of interest
+void litehtml::utf8_scanner::append_run( utf8_span& dst, tchar_t min_char, tchar_t stop1, tchar_t stop2 )
+{
+	const tchar_t* run = skip_run(m_pos, m_end, min_char, stop1, stop2);
+	if(run != m_pos)
+	{
+		dst.append(m_pos, run - m_pos);
+		m_pos = run;
+	}
+}
+
+bool litehtml::utf8_scanner::is_whitespace( ucode_t c )
+{
+	return c <= ' '
+		&& (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f');
+}
+
+void litehtml::utf8_scanner::append_char( utf8_span& dst, ucode_t c )
+{
+	if(m_char_len)
+	{
+		dst.append(m_char, m_char_len);
+	} else if(c)
+	{
+		// zero is returned for an entity cut off by the end of input
+		dst.append(c);
+	}
+}
+
+bool litehtml::utf8_scanner::value_ends_with( const tchar_t* tail, size_t len, bool nocase )
+{
+	if(m_value.length() < len)
+	{
+		return false;
+	}
+	const tchar_t* str = m_value.data() + m_value.length() - len;
+	if(nocase)
+	{
+		return !t_strncasecmp(str, tail, len);
+	}
+	return !t_strncmp(str, tail, len);
+}
+
+litehtml::ucode_t litehtml::utf8_scanner::resolve_entity( const tchar_t* buf, int buf_size )
+{
+	return scanner::find_entity(buf, buf_size);
+}
+
+litehtml::scanner::token_type litehtml::utf8_scanner::scan_comment()
+{
+	if(got_tail)
+	{
+		c_scan = &utf8_scanner::scan_body;
+		got_tail = false;
+		return scanner::TT_COMMENT_END;
+	}
+	m_value.clear();
+	for(;;)
+	{
+		append_run(m_value, 1, '>', '>');
+		ucode_t c = get_char();
+		if( c == 0) return scanner::TT_EOF;
+		append_char(m_value, c);
+
+		if(c == '>' && value_ends_with(_t("-->"), 3))
+		{
+			got_tail = true;
+			m_value.erase_tail(3);
+			break;
+		}
+	}
+	return scanner::TT_DATA;
+}
+
+litehtml::scanner::token_type litehtml::utf8_scanner::scan_cdata()
+{
+	if(got_tail)
+	{
+		c_scan = &utf8_scanner::scan_body;
+		got_tail = false;
+		return scanner::TT_CDATA_END;
+	}
+	m_value.clear();
+	for(;;)
+	{
+		append_run(m_value, 1, '>', '>');
+		ucode_t c = get_char();
+		if( c == 0) return scanner::TT_EOF;
+		append_char(m_value, c);
+
+		if(c == '>' && value_ends_with(_t("]]>"), 3))
+		{
+			got_tail = true;
+			m_value.erase_tail(3);
+			break;
+		}
+	}
+	return scanner::TT_DATA;
+}
+
+litehtml::scanner::token_type litehtml::utf8_scanner::scan_entity_decl()
+{
+	if(got_tail)
+	{
+		c_scan = &utf8_scanner::scan_body;
+		got_tail = false;
+		return scanner::TT_ENTITY_END;
+	}
+	ucode_t t;
+	unsigned int tc = 0;
+	m_value.clear();
+	for(;;)
+	{
+		t = get_char();
+		if( t == 0 ) return scanner::TT_EOF;
+		append_char(m_value, t);
+		if(t == '\"') tc++;
+		else if( t == '>' && (tc & 1) == 0 )
+		{
+			got_tail = true;
+			break;
+		}
+	}
+	return scanner::TT_DATA;
+}
+
+litehtml::scanner::token_type litehtml::utf8_scanner::scan_raw_body()
+{
+	if(got_tail)
+	{
+		c_scan = &utf8_scanner::scan_body;
+		got_tail = false;
+		return scanner::TT_TAG_END;
+	}
+	m_value.clear();
+	for(;;)
+	{
+		append_run(m_value, 1, '>', '>');
+		ucode_t c = get_char();
+		if( c == 0) return scanner::TT_EOF;
+		append_char(m_value, c);
+
+		if(c == '>' && value_ends_with(_t("</script>"), 9, true))
+		{
+			got_tail = true;
+			m_value.erase_tail(9);
+			break;
+		}
+	}
+	return scanner::TT_DATA;
+}
+
+#endif
@@ -0,0 +1,94 @@
+#pragma once
+#include "xh_scanner.h"
+
+namespace litehtml
+{
+#ifdef LITEHTML_UTF8
+
+	// Token text returned by utf8_scanner. Points into the source buffer
+	// until an entity or an invalid UTF-8 sequence forces an own copy.
+	class utf8_span
+	{
+		const tchar_t*	m_start;
+		size_t			m_length;
+		tstring			m_copy;
+		bool			m_copied;
+	public:
+		utf8_span() : m_start(0), m_length(0), m_copied(false) {}
+
+		void			clear();
+		void			append(const tchar_t* src, size_t len);
+		void			append(ucode_t c);
+		void			erase_tail(size_t len);
+		const tchar_t*	data() const;
+		size_t			length() const;
+	private:
+		void			make_copy();
+	};
+
+	// The same tokenizer as litehtml::scanner, working directly on
+	// a zero-terminated UTF-8 buffer. Values are returned as (pointer, length)
+	// pairs and stay valid until the next get_token() call.
+	class utf8_scanner
+	{
+	public:
+		utf8_scanner(const tchar_t* src);
+		virtual ~utf8_scanner() {}
+
+		// get next token
+		scanner::token_type	get_token() { return (this->*c_scan)(); }
+
+		// get value of TT_WORD, TT_SPACE, TT_ATTR and TT_DATA
+		const tchar_t*		get_value() const				{ return m_value.data();		}
+		size_t				get_value_length() const		{ return m_value.length();		}
+
+		// get attribute name
+		const tchar_t*		get_attr_name() const			{ return m_attr_name.data();	}
+		size_t				get_attr_name_length() const	{ return m_attr_name.length();	}
+
+		// get tag name
+		const tchar_t*		get_tag_name() const			{ return m_tag_name.data();		}
+		size_t				get_tag_name_length() const		{ return m_tag_name.length();	}
+
+		// should be override to resolve entities, e.g. &nbsp;
+		virtual ucode_t		resolve_entity(const tchar_t* buf, int buf_size);
+
+	private: /* methods */
+
+		typedef scanner::token_type (utf8_scanner::*scan)();
+		scan		c_scan; // current 'reader'
+
+		// content 'readers'
+		scanner::token_type	scan_body();
+		scanner::token_type	scan_head();
+		scanner::token_type	scan_comment();
+		scanner::token_type	scan_cdata();
+		scanner::token_type	scan_tag();
+		scanner::token_type	scan_entity_decl();
+		scanner::token_type	scan_raw_body();
+
+		ucode_t		skip_whitespace();
+		void		push_back(ucode_t c);
+
+		ucode_t		get_char();
+		ucode_t		scan_entity();
+
+		bool		is_whitespace(ucode_t c);
+		void		append_char(utf8_span& dst, ucode_t c);
+		void		append_run(utf8_span& dst, tchar_t min_char, tchar_t stop1, tchar_t stop2);
+		bool		value_ends_with(const tchar_t* tail, size_t len, bool nocase = false);
+
+	private:
+		utf8_span		m_value;
+		utf8_span		m_tag_name;
+		utf8_span		m_attr_name;
+
+		const tchar_t*	m_pos;		// next char to read
+		const tchar_t*	m_end;		// terminating zero of the source
+		const tchar_t*	m_char;		// last char returned by get_char()
+		size_t			m_char_len;	// its length in the source, 0 if the source bytes differ from the returned char
+		bool			got_tail;	// aux flag used in scan_comment, etc.
+	};
+
+#endif
+}
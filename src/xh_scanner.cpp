@@ -420,268 +420,2050 @@ litehtml::scanner::token_type litehtml::scanner::scan_doctype_decl()
 	return TT_DATA;
 }
 
+// Sorted by name (in strcmp order) for the binary search in find_entity().
+// Single code point entities of HTML5, names are without '&' and ';'.
 litehtml::html_entities  litehtml::scanner::m_HTMLCodes[] =
 {
-
-	{ _t("&quot;"),		0x0022},
-	{ _t("&amp;"),		0x0026},
-	{ _t("&lt;"),		0x003C},
-	{ _t("&gt;"),		0x003E},
-	{ _t("&nbsp;"),		0x00A0},
-	{ _t("&iexcl;"),	0x00A1},
-	{ _t("&cent;"),		0x00A2},
-	{ _t("&pound;"),	0x00A3},
-	{ _t("&curren;"),	0x00A4},
-	{ _t("&yen;"),		0x00A5},
-	{ _t("&brvbar;"),	0x00A6},
-	{ _t("&sect;"),		0x00A7},
-	{ _t("&uml;"),		0x00A8},
-	{ _t("&copy;"),		0x00A9},
-	{ _t("&ordf;"),		0x00AA},
-	{ _t("&laquo;"),	0x00AB},
-	{ _t("&lsaquo;"),	0x00AB},
-	{ _t("&not;"),		0x00AC},
-	{ _t("&shy;"),		0x00AD},
-	{ _t("&reg;"),		0x00AE},
-	{ _t("&macr;"),		0x00AF},
-	{ _t("&deg;"),		0x00B0},
-	{ _t("&plusmn;"),	0x00B1},
-	{ _t("&sup2;"),		0x00B2},
-	{ _t("&sup3;"),		0x00B3},
-	{ _t("&acute;"),	0x00B4},
-	{ _t("&micro;"),	0x00B5},
-	{ _t("&para;"),		0x00B6},
-	{ _t("&middot;"),	0x00B7},
-	{ _t("&cedil;"),	0x00B8},
-	{ _t("&sup1;"),		0x00B9},
-	{ _t("&ordm;"),		0x00BA},
-	{ _t("&raquo;"),	0x00BB},
-	{ _t("&rsaquo;"),	0x00BB},
-	{ _t("&frac14;"),	0x00BC},
-	{ _t("&frac12;"),	0x00BD},
-	{ _t("&frac34;"),	0x00BE},
-	{ _t("&iquest;"),	0x00BF},
-	{ _t("&Agrave;"),	0x00C0},
-	{ _t("&Aacute;"),	0x00C1},
-	{ _t("&Acirc;"),	0x00C2},
-	{ _t("&Atilde;"),	0x00C3},
-	{ _t("&Auml;"),		0x00C4},
-	{ _t("&Aring;"),	0x00C5},
-	{ _t("&AElig;"),	0x00C6},
-	{ _t("&Ccedil;"),	0x00C7},
-	{ _t("&Egrave;"),	0x00C8},
-	{ _t("&Eacute;"),	0x00C9},
-	{ _t("&Ecirc;"),	0x00CA},
-	{ _t("&Euml;"),		0x00CB},
-	{ _t("&Igrave;"),	0x00CC},
-	{ _t("&Iacute;"),	0x00CD},
-	{ _t("&Icirc;"),	0x00CE},
-	{ _t("&Iuml;"),		0x00CF},
-	{ _t("&ETH;"),		0x00D0},
-	{ _t("&Ntilde;"),	0x00D1},
-	{ _t("&Ograve;"),	0x00D2},
-	{ _t("&Oacute;"),	0x00D3},
-	{ _t("&Ocirc;"),	0x00D4},
-	{ _t("&Otilde;"),	0x00D5},
-	{ _t("&Ouml;"),		0x00D6},
-	{ _t("&times;"),	0x00D7},
-	{ _t("&Oslash;"),	0x00D8},
-	{ _t("&Ugrave;"),	0x00D9},
-	{ _t("&Uacute;"),	0x00DA},
-	{ _t("&Ucirc;"),	0x00DB},
-	{ _t("&Uuml;"),		0x00DC},
-	{ _t("&Yacute;"),	0x00DD},
-	{ _t("&THORN;"),	0x00DE},
-	{ _t("&szlig;"),	0x00DF},
-	{ _t("&agrave;"),	0x00E0},
-	{ _t("&aacute;"),	0x00E1},
-	{ _t("&acirc;"),	0x00E2},
-	{ _t("&atilde;"),	0x00E3},
-	{ _t("&auml;"),		0x00E4},
-	{ _t("&aring;"),	0x00E5},
-	{ _t("&aelig;"),	0x00E6},
-	{ _t("&ccedil;"),	0x00E7},
-	{ _t("&egrave;"),	0x00E8},
-	{ _t("&eacute;"),	0x00E9},
-	{ _t("&ecirc;"),	0x00EA},
-	{ _t("&euml;"),		0x00EB},
-	{ _t("&igrave;"),	0x00EC},
-	{ _t("&iacute;"),	0x00ED},
-	{ _t("&icirc;"),	0x00EE},
-	{ _t("&iuml;"),		0x00EF},
-	{ _t("&eth;"),		0x00F0},
-	{ _t("&ntilde;"),	0x00F1},
-	{ _t("&ograve;"),	0x00F2},
-	{ _t("&oacute;"),	0x00F3},
-	{ _t("&ocirc;"),	0x00F4},
-	{ _t("&otilde;"),	0x00F5},
-	{ _t("&ouml;"),		0x00F6},
-	{ _t("&divide;"),	0x00F7},
-	{ _t("&oslash;"),	0x00F8},
-	{ _t("&ugrave;"),	0x00F9},
-	{ _t("&uacute;"),	0x00FA},
-	{ _t("&ucirc;"),	0x00FB},
-	{ _t("&uuml;"),		0x00FC},
-	{ _t("&yacute;"),	0x00FD},
-	{ _t("&thorn;"),	0x00FE},
-	{ _t("&yuml;"),		0x00FF},
-	{ _t("&OElig;"),	0x0152},
-	{ _t("&oelig;"),	0x0153},
-	{ _t("&Scaron;"),	0x0160},
-	{ _t("&scaron;"),	0x0161},
-	{ _t("&Yuml;"),		0x0178},
-	{ _t("&fnof;"),		0x0192},
-	{ _t("&circ;"),		0x02C6},
-	{ _t("&tilde;"),	0x02DC},
-	{ _t("&Alpha;"),	0x0391},
-	{ _t("&Beta;"),		0x0392},
-	{ _t("&Gamma;"),	0x0393},
-	{ _t("&Delta;"),	0x0394},
-	{ _t("&Epsilon;"),	0x0395},
-	{ _t("&Zeta;"),		0x0396},
-	{ _t("&Eta;"),		0x0397},
-	{ _t("&Theta;"),	0x0398},
-	{ _t("&Iota;"),		0x0399},
-	{ _t("&Kappa;"),	0x039A},
-	{ _t("&Lambda;"),	0x039B},
-	{ _t("&Mu;"),		0x039C},
-	{ _t("&Nu;"),		0x039D},
-	{ _t("&Xi;"),		0x039E},
-	{ _t("&Omicron;"),	0x039F},
-	{ _t("&Pi;"),		0x03A0},
-	{ _t("&Rho;"),		0x03A1},
-	{ _t("&Sigma;"),	0x03A3},
-	{ _t("&Tau;"),		0x03A4},
-	{ _t("&Upsilon;"),	0x03A5},
-	{ _t("&Phi;"),		0x03A6},
-	{ _t("&Chi;"),		0x03A7},
-	{ _t("&Psi;"),		0x03A8},
-	{ _t("&Omega;"),	0x03A9},
-	{ _t("&alpha;"),	0x03B1},
-	{ _t("&beta;"),		0x03B2},
-	{ _t("&gamma;"),	0x03B3},
-	{ _t("&delta;"),	0x03B4},
-	{ _t("&epsilon;"),	0x03B5},
-	{ _t("&zeta;"),		0x03B6},
-	{ _t("&eta;"),		0x03B7},
-	{ _t("&theta;"),	0x03B8},
-	{ _t("&iota;"),		0x03B9},
-	{ _t("&kappa;"),	0x03BA},
-	{ _t("&lambda;"),	0x03BB},
-	{ _t("&mu;"),		0x03BC},
-	{ _t("&nu;"),		0x03BD},
-	{ _t("&xi;"),		0x03BE},
-	{ _t("&omicron;"),	0x03BF},
-	{ _t("&pi;"),		0x03C0},
-	{ _t("&rho;"),		0x03C1},
-	{ _t("&sigmaf;"),	0x03C2},
-	{ _t("&sigma;"),	0x03C3},
-	{ _t("&tau;"),		0x03C4},
-	{ _t("&upsilon;"),	0x03C5},
-	{ _t("&phi;"),		0x03C6},
-	{ _t("&chi;"),		0x03C7},
-	{ _t("&psi;"),		0x03C8},
-	{ _t("&omega;"),	0x03C9},
-	{ _t("&thetasym;"),	0x03D1},
-	{ _t("&upsih;"),	0x03D2},
-	{ _t("&piv;"),		0x03D6},
-	{ _t("&ensp;"),		0x2002},
-	{ _t("&emsp;"),		0x2003},
-	{ _t("&thinsp;"),	0x2009},
-	{ _t("&zwnj;"),		0x200C},
-	{ _t("&zwj;"),		0x200D},
-	{ _t("&lrm;"),		0x200E},
-	{ _t("&rlm;"),		0x200F},
-	{ _t("&ndash;"),	0x2013},
-	{ _t("&mdash;"),	0x2014},
-	{ _t("&lsquo;"),	0x2018},
-	{ _t("&rsquo;"),	0x2019},
-	{ _t("&sbquo;"),	0x201A},
-	{ _t("&ldquo;"),	0x201C},
-	{ _t("&rdquo;"),	0x201D},
-	{ _t("&bdquo;"),	0x201E},
-	{ _t("&dagger;"),	0x2020},
-	{ _t("&Dagger;"),	0x2021},
-	{ _t("&bull;"),		0x2022},
-	{ _t("&hellip;"),	0x2026},
-	{ _t("&permil;"),	0x2030},
-	{ _t("&prime;"),	0x2032},
-	{ _t("&Prime;"),	0x2033},
-	{ _t("&lsaquo;"),	0x2039},
-	{ _t("&rsaquo;"),	0x203A},
-	{ _t("&oline;"),	0x203E},
-	{ _t("&frasl;"),	0x2044},
-	{ _t("&euro;"),		0x20AC},
-	{ _t("&image;"),	0x2111},
-	{ _t("&weierp;"),	0x2118},
-	{ _t("&real;"),		0x211C},
-	{ _t("&trade;"),	0x2122},
-	{ _t("&alefsym;"),	0x2135},
-	{ _t("&larr;"),		0x2190},
-	{ _t("&uarr;"),		0x2191},
-	{ _t("&rarr;"),		0x2192},
-	{ _t("&darr;"),		0x2193},
-	{ _t("&harr;"),		0x2194},
-	{ _t("&crarr;"),	0x21B5},
-	{ _t("&lArr;"),		0x21D0},
-	{ _t("&uArr;"),		0x21D1},
-	{ _t("&rArr;"),		0x21D2},
-	{ _t("&dArr;"),		0x21D3},
-	{ _t("&hArr;"),		0x21D4},
-	{ _t("&forall;"),	0x2200},
-	{ _t("&part;"),		0x2202},
-	{ _t("&exist;"),	0x2203},
-	{ _t("&empty;"),	0x2205},
-	{ _t("&nabla;"),	0x2207},
-	{ _t("&isin;"),		0x2208},
-	{ _t("&notin;"),	0x2209},
-	{ _t("&ni;"),		0x220B},
-	{ _t("&prod;"),		0x220F},
-	{ _t("&sum;"),		0x2211},
-	{ _t("&minus;"),	0x2212},
-	{ _t("&lowast;"),	0x2217},
-	{ _t("&radic;"),	0x221A},
-	{ _t("&prop;"),		0x221D},
-	{ _t("&infin;"),	0x221E},
-	{ _t("&ang;"),		0x2220},
-	{ _t("&and;"),		0x2227},
-	{ _t("&or;"),		0x2228},
-	{ _t("&cap;"),		0x2229},
-	{ _t("&cup;"),		0x222A},
-	{ _t("&int;"),		0x222B},
-	{ _t("&there4;"),	0x2234},
-	{ _t("&sim;"),		0x223C},
-	{ _t("&cong;"),		0x2245},
-	{ _t("&asymp;"),	0x2248},
-	{ _t("&ne;"),		0x2260},
-	{ _t("&equiv;"),	0x2261},
-	{ _t("&le;"),		0x2264},
-	{ _t("&ge;"),		0x2265},
-	{ _t("&sub;"),		0x2282},
-	{ _t("&sup;"),		0x2283},
-	{ _t("&nsub;"),		0x2284},
-	{ _t("&sube;"),		0x2286},
-	{ _t("&supe;"),		0x2287},
-	{ _t("&oplus;"),	0x2295},
-	{ _t("&otimes;"),	0x2297},
-	{ _t("&perp;"),		0x22A5},
-	{ _t("&sdot;"),		0x22C5},
-	{ _t("&lceil;"),	0x2308},
-	{ _t("&rceil;"),	0x2309},
-	{ _t("&lfloor;"),	0x230A},
-	{ _t("&rfloor;"),	0x230B},
-	{ _t("&lang;"),		0x2329},
-	{ _t("&rang;"),		0x232A},
-	{ _t("&loz;"),		0x25CA},
-	{ _t("&spades;"),	0x2660},
-	{ _t("&clubs;"),	0x2663},
-	{ _t("&hearts;"),	0x2665},
-	{ _t("&diams;"),	0x2666},
-
-	{_t(""),0}
+	{ _t("AElig"),							0x00C6},
+	{ _t("AMP"),							0x0026},
+	{ _t("Aacute"),							0x00C1},
+	{ _t("Abreve"),							0x0102},
+	{ _t("Acirc"),							0x00C2},
+	{ _t("Acy"),							0x0410},
+	{ _t("Afr"),							0x1D504},
+	{ _t("Agrave"),							0x00C0},
+	{ _t("Alpha"),							0x0391},
+	{ _t("Amacr"),							0x0100},
+	{ _t("And"),							0x2A53},
+	{ _t("Aogon"),							0x0104},
+	{ _t("Aopf"),							0x1D538},
+	{ _t("ApplyFunction"),					0x2061},
+	{ _t("Aring"),							0x00C5},
+	{ _t("Ascr"),							0x1D49C},
+	{ _t("Assign"),							0x2254},
+	{ _t("Atilde"),							0x00C3},
+	{ _t("Auml"),							0x00C4},
+	{ _t("Backslash"),						0x2216},
+	{ _t("Barv"),							0x2AE7},
+	{ _t("Barwed"),							0x2306},
+	{ _t("Bcy"),							0x0411},
+	{ _t("Because"),						0x2235},
+	{ _t("Bernoullis"),						0x212C},
+	{ _t("Beta"),							0x0392},
+	{ _t("Bfr"),							0x1D505},
+	{ _t("Bopf"),							0x1D539},
+	{ _t("Breve"),							0x02D8},
+	{ _t("Bscr"),							0x212C},
+	{ _t("Bumpeq"),							0x224E},
+	{ _t("CHcy"),							0x0427},
+	{ _t("COPY"),							0x00A9},
+	{ _t("Cacute"),							0x0106},
+	{ _t("Cap"),							0x22D2},
+	{ _t("CapitalDifferentialD"),			0x2145},
+	{ _t("Cayleys"),						0x212D},
+	{ _t("Ccaron"),							0x010C},
+	{ _t("Ccedil"),							0x00C7},
+	{ _t("Ccirc"),							0x0108},
+	{ _t("Cconint"),						0x2230},
+	{ _t("Cdot"),							0x010A},
+	{ _t("Cedilla"),						0x00B8},
+	{ _t("CenterDot"),						0x00B7},
+	{ _t("Cfr"),							0x212D},
+	{ _t("Chi"),							0x03A7},
+	{ _t("CircleDot"),						0x2299},
+	{ _t("CircleMinus"),					0x2296},
+	{ _t("CirclePlus"),						0x2295},
+	{ _t("CircleTimes"),					0x2297},
+	{ _t("ClockwiseContourIntegral"),		0x2232},
+	{ _t("CloseCurlyDoubleQuote"),			0x201D},
+	{ _t("CloseCurlyQuote"),				0x2019},
+	{ _t("Colon"),							0x2237},
+	{ _t("Colone"),							0x2A74},
+	{ _t("Congruent"),						0x2261},
+	{ _t("Conint"),							0x222F},
+	{ _t("ContourIntegral"),				0x222E},
+	{ _t("Copf"),							0x2102},
+	{ _t("Coproduct"),						0x2210},
+	{ _t("CounterClockwiseContourIntegral"),	0x2233},
+	{ _t("Cross"),							0x2A2F},
+	{ _t("Cscr"),							0x1D49E},
+	{ _t("Cup"),							0x22D3},
+	{ _t("CupCap"),							0x224D},
+	{ _t("DD"),								0x2145},
+	{ _t("DDotrahd"),						0x2911},
+	{ _t("DJcy"),							0x0402},
+	{ _t("DScy"),							0x0405},
+	{ _t("DZcy"),							0x040F},
+	{ _t("Dagger"),							0x2021},
+	{ _t("Darr"),							0x21A1},
+	{ _t("Dashv"),							0x2AE4},
+	{ _t("Dcaron"),							0x010E},
+	{ _t("Dcy"),							0x0414},
+	{ _t("Del"),							0x2207},
+	{ _t("Delta"),							0x0394},
+	{ _t("Dfr"),							0x1D507},
+	{ _t("DiacriticalAcute"),				0x00B4},
+	{ _t("DiacriticalDot"),					0x02D9},
+	{ _t("DiacriticalDoubleAcute"),			0x02DD},
+	{ _t("DiacriticalGrave"),				0x0060},
+	{ _t("DiacriticalTilde"),				0x02DC},
+	{ _t("Diamond"),						0x22C4},
+	{ _t("DifferentialD"),					0x2146},
+	{ _t("Dopf"),							0x1D53B},
+	{ _t("Dot"),							0x00A8},
+	{ _t("DotDot"),							0x20DC},
+	{ _t("DotEqual"),						0x2250},
+	{ _t("DoubleContourIntegral"),			0x222F},
+	{ _t("DoubleDot"),						0x00A8},
+	{ _t("DoubleDownArrow"),				0x21D3},
+	{ _t("DoubleLeftArrow"),				0x21D0},
+	{ _t("DoubleLeftRightArrow"),			0x21D4},
+	{ _t("DoubleLeftTee"),					0x2AE4},
+	{ _t("DoubleLongLeftArrow"),			0x27F8},
+	{ _t("DoubleLongLeftRightArrow"),		0x27FA},
+	{ _t("DoubleLongRightArrow"),			0x27F9},
+	{ _t("DoubleRightArrow"),				0x21D2},
+	{ _t("DoubleRightTee"),					0x22A8},
+	{ _t("DoubleUpArrow"),					0x21D1},
+	{ _t("DoubleUpDownArrow"),				0x21D5},
+	{ _t("DoubleVerticalBar"),				0x2225},
+	{ _t("DownArrow"),						0x2193},
+	{ _t("DownArrowBar"),					0x2913},
+	{ _t("DownArrowUpArrow"),				0x21F5},
+	{ _t("DownBreve"),						0x0311},
+	{ _t("DownLeftRightVector"),			0x2950},
+	{ _t("DownLeftTeeVector"),				0x295E},
+	{ _t("DownLeftVector"),					0x21BD},
+	{ _t("DownLeftVectorBar"),				0x2956},
+	{ _t("DownRightTeeVector"),				0x295F},
+	{ _t("DownRightVector"),				0x21C1},
+	{ _t("DownRightVectorBar"),				0x2957},
+	{ _t("DownTee"),						0x22A4},
+	{ _t("DownTeeArrow"),					0x21A7},
+	{ _t("Downarrow"),						0x21D3},
+	{ _t("Dscr"),							0x1D49F},
+	{ _t("Dstrok"),							0x0110},
+	{ _t("ENG"),							0x014A},
+	{ _t("ETH"),							0x00D0},
+	{ _t("Eacute"),							0x00C9},
+	{ _t("Ecaron"),							0x011A},
+	{ _t("Ecirc"),							0x00CA},
+	{ _t("Ecy"),							0x042D},
+	{ _t("Edot"),							0x0116},
+	{ _t("Efr"),							0x1D508},
+	{ _t("Egrave"),							0x00C8},
+	{ _t("Element"),						0x2208},
+	{ _t("Emacr"),							0x0112},
+	{ _t("EmptySmallSquare"),				0x25FB},
+	{ _t("EmptyVerySmallSquare"),			0x25AB},
+	{ _t("Eogon"),							0x0118},
+	{ _t("Eopf"),							0x1D53C},
+	{ _t("Epsilon"),						0x0395},
+	{ _t("Equal"),							0x2A75},
+	{ _t("EqualTilde"),						0x2242},
+	{ _t("Equilibrium"),					0x21CC},
+	{ _t("Escr"),							0x2130},
+	{ _t("Esim"),							0x2A73},
+	{ _t("Eta"),							0x0397},
+	{ _t("Euml"),							0x00CB},
+	{ _t("Exists"),							0x2203},
+	{ _t("ExponentialE"),					0x2147},
+	{ _t("Fcy"),							0x0424},
+	{ _t("Ffr"),							0x1D509},
+	{ _t("FilledSmallSquare"),				0x25FC},
+	{ _t("FilledVerySmallSquare"),			0x25AA},
+	{ _t("Fopf"),							0x1D53D},
+	{ _t("ForAll"),							0x2200},
+	{ _t("Fouriertrf"),						0x2131},
+	{ _t("Fscr"),							0x2131},
+	{ _t("GJcy"),							0x0403},
+	{ _t("GT"),								0x003E},
+	{ _t("Gamma"),							0x0393},
+	{ _t("Gammad"),							0x03DC},
+	{ _t("Gbreve"),							0x011E},
+	{ _t("Gcedil"),							0x0122},
+	{ _t("Gcirc"),							0x011C},
+	{ _t("Gcy"),							0x0413},
+	{ _t("Gdot"),							0x0120},
+	{ _t("Gfr"),							0x1D50A},
+	{ _t("Gg"),								0x22D9},
+	{ _t("Gopf"),							0x1D53E},
+	{ _t("GreaterEqual"),					0x2265},
+	{ _t("GreaterEqualLess"),				0x22DB},
+	{ _t("GreaterFullEqual"),				0x2267},
+	{ _t("GreaterGreater"),					0x2AA2},
+	{ _t("GreaterLess"),					0x2277},
+	{ _t("GreaterSlantEqual"),				0x2A7E},
+	{ _t("GreaterTilde"),					0x2273},
+	{ _t("Gscr"),							0x1D4A2},
+	{ _t("Gt"),								0x226B},
+	{ _t("HARDcy"),							0x042A},
+	{ _t("Hacek"),							0x02C7},
+	{ _t("Hat"),							0x005E},
+	{ _t("Hcirc"),							0x0124},
+	{ _t("Hfr"),							0x210C},
+	{ _t("HilbertSpace"),					0x210B},
+	{ _t("Hopf"),							0x210D},
+	{ _t("HorizontalLine"),					0x2500},
+	{ _t("Hscr"),							0x210B},
+	{ _t("Hstrok"),							0x0126},
+	{ _t("HumpDownHump"),					0x224E},
+	{ _t("HumpEqual"),						0x224F},
+	{ _t("IEcy"),							0x0415},
+	{ _t("IJlig"),							0x0132},
+	{ _t("IOcy"),							0x0401},
+	{ _t("Iacute"),							0x00CD},
+	{ _t("Icirc"),							0x00CE},
+	{ _t("Icy"),							0x0418},
+	{ _t("Idot"),							0x0130},
+	{ _t("Ifr"),							0x2111},
+	{ _t("Igrave"),							0x00CC},
+	{ _t("Im"),								0x2111},
+	{ _t("Imacr"),							0x012A},
+	{ _t("ImaginaryI"),						0x2148},
+	{ _t("Implies"),						0x21D2},
+	{ _t("Int"),							0x222C},
+	{ _t("Integral"),						0x222B},
+	{ _t("Intersection"),					0x22C2},
+	{ _t("InvisibleComma"),					0x2063},
+	{ _t("InvisibleTimes"),					0x2062},
+	{ _t("Iogon"),							0x012E},
+	{ _t("Iopf"),							0x1D540},
+	{ _t("Iota"),							0x0399},
+	{ _t("Iscr"),							0x2110},
+	{ _t("Itilde"),							0x0128},
+	{ _t("Iukcy"),							0x0406},
+	{ _t("Iuml"),							0x00CF},
+	{ _t("Jcirc"),							0x0134},
+	{ _t("Jcy"),							0x0419},
+	{ _t("Jfr"),							0x1D50D},
+	{ _t("Jopf"),							0x1D541},
+	{ _t("Jscr"),							0x1D4A5},
+	{ _t("Jsercy"),							0x0408},
+	{ _t("Jukcy"),							0x0404},
+	{ _t("KHcy"),							0x0425},
+	{ _t("KJcy"),							0x040C},
+	{ _t("Kappa"),							0x039A},
+	{ _t("Kcedil"),							0x0136},
+	{ _t("Kcy"),							0x041A},
+	{ _t("Kfr"),							0x1D50E},
+	{ _t("Kopf"),							0x1D542},
+	{ _t("Kscr"),							0x1D4A6},
+	{ _t("LJcy"),							0x0409},
+	{ _t("LT"),								0x003C},
+	{ _t("Lacute"),							0x0139},
+	{ _t("Lambda"),							0x039B},
+	{ _t("Lang"),							0x27EA},
+	{ _t("Laplacetrf"),						0x2112},
+	{ _t("Larr"),							0x219E},
+	{ _t("Lcaron"),							0x013D},
+	{ _t("Lcedil"),							0x013B},
+	{ _t("Lcy"),							0x041B},
+	{ _t("LeftAngleBracket"),				0x27E8},
+	{ _t("LeftArrow"),						0x2190},
+	{ _t("LeftArrowBar"),					0x21E4},
+	{ _t("LeftArrowRightArrow"),			0x21C6},
+	{ _t("LeftCeiling"),					0x2308},
+	{ _t("LeftDoubleBracket"),				0x27E6},
+	{ _t("LeftDownTeeVector"),				0x2961},
+	{ _t("LeftDownVector"),					0x21C3},
+	{ _t("LeftDownVectorBar"),				0x2959},
+	{ _t("LeftFloor"),						0x230A},
+	{ _t("LeftRightArrow"),					0x2194},
+	{ _t("LeftRightVector"),				0x294E},
+	{ _t("LeftTee"),						0x22A3},
+	{ _t("LeftTeeArrow"),					0x21A4},
+	{ _t("LeftTeeVector"),					0x295A},
+	{ _t("LeftTriangle"),					0x22B2},
+	{ _t("LeftTriangleBar"),				0x29CF},
+	{ _t("LeftTriangleEqual"),				0x22B4},
+	{ _t("LeftUpDownVector"),				0x2951},
+	{ _t("LeftUpTeeVector"),				0x2960},
+	{ _t("LeftUpVector"),					0x21BF},
+	{ _t("LeftUpVectorBar"),				0x2958},
+	{ _t("LeftVector"),						0x21BC},
+	{ _t("LeftVectorBar"),					0x2952},
+	{ _t("Leftarrow"),						0x21D0},
+	{ _t("Leftrightarrow"),					0x21D4},
+	{ _t("LessEqualGreater"),				0x22DA},
+	{ _t("LessFullEqual"),					0x2266},
+	{ _t("LessGreater"),					0x2276},
+	{ _t("LessLess"),						0x2AA1},
+	{ _t("LessSlantEqual"),					0x2A7D},
+	{ _t("LessTilde"),						0x2272},
+	{ _t("Lfr"),							0x1D50F},
+	{ _t("Ll"),								0x22D8},
+	{ _t("Lleftarrow"),						0x21DA},
+	{ _t("Lmidot"),							0x013F},
+	{ _t("LongLeftArrow"),					0x27F5},
+	{ _t("LongLeftRightArrow"),				0x27F7},
+	{ _t("LongRightArrow"),					0x27F6},
+	{ _t("Longleftarrow"),					0x27F8},
+	{ _t("Longleftrightarrow"),				0x27FA},
+	{ _t("Longrightarrow"),					0x27F9},
+	{ _t("Lopf"),							0x1D543},
+	{ _t("LowerLeftArrow"),					0x2199},
+	{ _t("LowerRightArrow"),				0x2198},
+	{ _t("Lscr"),							0x2112},
+	{ _t("Lsh"),							0x21B0},
+	{ _t("Lstrok"),							0x0141},
+	{ _t("Lt"),								0x226A},
+	{ _t("Map"),							0x2905},
+	{ _t("Mcy"),							0x041C},
+	{ _t("MediumSpace"),					0x205F},
+	{ _t("Mellintrf"),						0x2133},
+	{ _t("Mfr"),							0x1D510},
+	{ _t("MinusPlus"),						0x2213},
+	{ _t("Mopf"),							0x1D544},
+	{ _t("Mscr"),							0x2133},
+	{ _t("Mu"),								0x039C},
+	{ _t("NJcy"),							0x040A},
+	{ _t("Nacute"),							0x0143},
+	{ _t("Ncaron"),							0x0147},
+	{ _t("Ncedil"),							0x0145},
+	{ _t("Ncy"),							0x041D},
+	{ _t("NegativeMediumSpace"),			0x200B},
+	{ _t("NegativeThickSpace"),				0x200B},
+	{ _t("NegativeThinSpace"),				0x200B},
+	{ _t("NegativeVeryThinSpace"),			0x200B},
+	{ _t("NestedGreaterGreater"),			0x226B},
+	{ _t("NestedLessLess"),					0x226A},
+	{ _t("NewLine"),						0x000A},
+	{ _t("Nfr"),							0x1D511},
+	{ _t("NoBreak"),						0x2060},
+	{ _t("NonBreakingSpace"),				0x00A0},
+	{ _t("Nopf"),							0x2115},
+	{ _t("Not"),							0x2AEC},
+	{ _t("NotCongruent"),					0x2262},
+	{ _t("NotCupCap"),						0x226D},
+	{ _t("NotDoubleVerticalBar"),			0x2226},
+	{ _t("NotElement"),						0x2209},
+	{ _t("NotEqual"),						0x2260},
+	{ _t("NotExists"),						0x2204},
+	{ _t("NotGreater"),						0x226F},
+	{ _t("NotGreaterEqual"),				0x2271},
+	{ _t("NotGreaterLess"),					0x2279},
+	{ _t("NotGreaterTilde"),				0x2275},
+	{ _t("NotLeftTriangle"),				0x22EA},
+	{ _t("NotLeftTriangleEqual"),			0x22EC},
+	{ _t("NotLess"),						0x226E},
+	{ _t("NotLessEqual"),					0x2270},
+	{ _t("NotLessGreater"),					0x2278},
+	{ _t("NotLessTilde"),					0x2274},
+	{ _t("NotPrecedes"),					0x2280},
+	{ _t("NotPrecedesSlantEqual"),			0x22E0},
+	{ _t("NotReverseElement"),				0x220C},
+	{ _t("NotRightTriangle"),				0x22EB},
+	{ _t("NotRightTriangleEqual"),			0x22ED},
+	{ _t("NotSquareSubsetEqual"),			0x22E2},
+	{ _t("NotSquareSupersetEqual"),			0x22E3},
+	{ _t("NotSubsetEqual"),					0x2288},
+	{ _t("NotSucceeds"),					0x2281},
+	{ _t("NotSucceedsSlantEqual"),			0x22E1},
+	{ _t("NotSupersetEqual"),				0x2289},
+	{ _t("NotTilde"),						0x2241},
+	{ _t("NotTildeEqual"),					0x2244},
+	{ _t("NotTildeFullEqual"),				0x2247},
+	{ _t("NotTildeTilde"),					0x2249},
+	{ _t("NotVerticalBar"),					0x2224},
+	{ _t("Nscr"),							0x1D4A9},
+	{ _t("Ntilde"),							0x00D1},
+	{ _t("Nu"),								0x039D},
+	{ _t("OElig"),							0x0152},
+	{ _t("Oacute"),							0x00D3},
+	{ _t("Ocirc"),							0x00D4},
+	{ _t("Ocy"),							0x041E},
+	{ _t("Odblac"),							0x0150},
+	{ _t("Ofr"),							0x1D512},
+	{ _t("Ograve"),							0x00D2},
+	{ _t("Omacr"),							0x014C},
+	{ _t("Omega"),							0x03A9},
+	{ _t("Omicron"),						0x039F},
+	{ _t("Oopf"),							0x1D546},
+	{ _t("OpenCurlyDoubleQuote"),			0x201C},
+	{ _t("OpenCurlyQuote"),					0x2018},
+	{ _t("Or"),								0x2A54},
+	{ _t("Oscr"),							0x1D4AA},
+	{ _t("Oslash"),							0x00D8},
+	{ _t("Otilde"),							0x00D5},
+	{ _t("Otimes"),							0x2A37},
+	{ _t("Ouml"),							0x00D6},
+	{ _t("OverBar"),						0x203E},
+	{ _t("OverBrace"),						0x23DE},
+	{ _t("OverBracket"),					0x23B4},
+	{ _t("OverParenthesis"),				0x23DC},
+	{ _t("PartialD"),						0x2202},
+	{ _t("Pcy"),							0x041F},
+	{ _t("Pfr"),							0x1D513},
+	{ _t("Phi"),							0x03A6},
+	{ _t("Pi"),								0x03A0},
+	{ _t("PlusMinus"),						0x00B1},
+	{ _t("Poincareplane"),					0x210C},
+	{ _t("Popf"),							0x2119},
+	{ _t("Pr"),								0x2ABB},
+	{ _t("Precedes"),						0x227A},
+	{ _t("PrecedesEqual"),					0x2AAF},
+	{ _t("PrecedesSlantEqual"),				0x227C},
+	{ _t("PrecedesTilde"),					0x227E},
+	{ _t("Prime"),							0x2033},
+	{ _t("Product"),						0x220F},
+	{ _t("Proportion"),						0x2237},
+	{ _t("Proportional"),					0x221D},
+	{ _t("Pscr"),							0x1D4AB},
+	{ _t("Psi"),							0x03A8},
+	{ _t("QUOT"),							0x0022},
+	{ _t("Qfr"),							0x1D514},
+	{ _t("Qopf"),							0x211A},
+	{ _t("Qscr"),							0x1D4AC},
+	{ _t("RBarr"),							0x2910},
+	{ _t("REG"),							0x00AE},
+	{ _t("Racute"),							0x0154},
+	{ _t("Rang"),							0x27EB},
+	{ _t("Rarr"),							0x21A0},
+	{ _t("Rarrtl"),							0x2916},
+	{ _t("Rcaron"),							0x0158},
+	{ _t("Rcedil"),							0x0156},
+	{ _t("Rcy"),							0x0420},
+	{ _t("Re"),								0x211C},
+	{ _t("ReverseElement"),					0x220B},
+	{ _t("ReverseEquilibrium"),				0x21CB},
+	{ _t("ReverseUpEquilibrium"),			0x296F},
+	{ _t("Rfr"),							0x211C},
+	{ _t("Rho"),							0x03A1},
+	{ _t("RightAngleBracket"),				0x27E9},
+	{ _t("RightArrow"),						0x2192},
+	{ _t("RightArrowBar"),					0x21E5},
+	{ _t("RightArrowLeftArrow"),			0x21C4},
+	{ _t("RightCeiling"),					0x2309},
+	{ _t("RightDoubleBracket"),				0x27E7},
+	{ _t("RightDownTeeVector"),				0x295D},
+	{ _t("RightDownVector"),				0x21C2},
+	{ _t("RightDownVectorBar"),				0x2955},
+	{ _t("RightFloor"),						0x230B},
+	{ _t("RightTee"),						0x22A2},
+	{ _t("RightTeeArrow"),					0x21A6},
+	{ _t("RightTeeVector"),					0x295B},
+	{ _t("RightTriangle"),					0x22B3},
+	{ _t("RightTriangleBar"),				0x29D0},
+	{ _t("RightTriangleEqual"),				0x22B5},
+	{ _t("RightUpDownVector"),				0x294F},
+	{ _t("RightUpTeeVector"),				0x295C},
+	{ _t("RightUpVector"),					0x21BE},
+	{ _t("RightUpVectorBar"),				0x2954},
+	{ _t("RightVector"),					0x21C0},
+	{ _t("RightVectorBar"),					0x2953},
+	{ _t("Rightarrow"),						0x21D2},
+	{ _t("Ropf"),							0x211D},
+	{ _t("RoundImplies"),					0x2970},
+	{ _t("Rrightarrow"),					0x21DB},
+	{ _t("Rscr"),							0x211B},
+	{ _t("Rsh"),							0x21B1},
+	{ _t("RuleDelayed"),					0x29F4},
+	{ _t("SHCHcy"),							0x0429},
+	{ _t("SHcy"),							0x0428},
+	{ _t("SOFTcy"),							0x042C},
+	{ _t("Sacute"),							0x015A},
+	{ _t("Sc"),								0x2ABC},
+	{ _t("Scaron"),							0x0160},
+	{ _t("Scedil"),							0x015E},
+	{ _t("Scirc"),							0x015C},
+	{ _t("Scy"),							0x0421},
+	{ _t("Sfr"),							0x1D516},
+	{ _t("ShortDownArrow"),					0x2193},
+	{ _t("ShortLeftArrow"),					0x2190},
+	{ _t("ShortRightArrow"),				0x2192},
+	{ _t("ShortUpArrow"),					0x2191},
+	{ _t("Sigma"),							0x03A3},
+	{ _t("SmallCircle"),					0x2218},
+	{ _t("Sopf"),							0x1D54A},
+	{ _t("Sqrt"),							0x221A},
+	{ _t("Square"),							0x25A1},
+	{ _t("SquareIntersection"),				0x2293},
+	{ _t("SquareSubset"),					0x228F},
+	{ _t("SquareSubsetEqual"),				0x2291},
+	{ _t("SquareSuperset"),					0x2290},
+	{ _t("SquareSupersetEqual"),			0x2292},
+	{ _t("SquareUnion"),					0x2294},
+	{ _t("Sscr"),							0x1D4AE},
+	{ _t("Star"),							0x22C6},
+	{ _t("Sub"),							0x22D0},
+	{ _t("Subset"),							0x22D0},
+	{ _t("SubsetEqual"),					0x2286},
+	{ _t("Succeeds"),						0x227B},
+	{ _t("SucceedsEqual"),					0x2AB0},
+	{ _t("SucceedsSlantEqual"),				0x227D},
+	{ _t("SucceedsTilde"),					0x227F},
+	{ _t("SuchThat"),						0x220B},
+	{ _t("Sum"),							0x2211},
+	{ _t("Sup"),							0x22D1},
+	{ _t("Superset"),						0x2283},
+	{ _t("SupersetEqual"),					0x2287},
+	{ _t("Supset"),							0x22D1},
+	{ _t("THORN"),							0x00DE},
+	{ _t("TRADE"),							0x2122},
+	{ _t("TSHcy"),							0x040B},
+	{ _t("TScy"),							0x0426},
+	{ _t("Tab"),							0x0009},
+	{ _t("Tau"),							0x03A4},
+	{ _t("Tcaron"),							0x0164},
+	{ _t("Tcedil"),							0x0162},
+	{ _t("Tcy"),							0x0422},
+	{ _t("Tfr"),							0x1D517},
+	{ _t("Therefore"),						0x2234},
+	{ _t("Theta"),							0x0398},
+	{ _t("ThinSpace"),						0x2009},
+	{ _t("Tilde"),							0x223C},
+	{ _t("TildeEqual"),						0x2243},
+	{ _t("TildeFullEqual"),					0x2245},
+	{ _t("TildeTilde"),						0x2248},
+	{ _t("Topf"),							0x1D54B},
+	{ _t("TripleDot"),						0x20DB},
+	{ _t("Tscr"),							0x1D4AF},
+	{ _t("Tstrok"),							0x0166},
+	{ _t("Uacute"),							0x00DA},
+	{ _t("Uarr"),							0x219F},
+	{ _t("Uarrocir"),						0x2949},
+	{ _t("Ubrcy"),							0x040E},
+	{ _t("Ubreve"),							0x016C},
+	{ _t("Ucirc"),							0x00DB},
+	{ _t("Ucy"),							0x0423},
+	{ _t("Udblac"),							0x0170},
+	{ _t("Ufr"),							0x1D518},
+	{ _t("Ugrave"),							0x00D9},
+	{ _t("Umacr"),							0x016A},
+	{ _t("UnderBar"),						0x005F},
+	{ _t("UnderBrace"),						0x23DF},
+	{ _t("UnderBracket"),					0x23B5},
+	{ _t("UnderParenthesis"),				0x23DD},
+	{ _t("Union"),							0x22C3},
+	{ _t("UnionPlus"),						0x228E},
+	{ _t("Uogon"),							0x0172},
+	{ _t("Uopf"),							0x1D54C},
+	{ _t("UpArrow"),						0x2191},
+	{ _t("UpArrowBar"),						0x2912},
+	{ _t("UpArrowDownArrow"),				0x21C5},
+	{ _t("UpDownArrow"),					0x2195},
+	{ _t("UpEquilibrium"),					0x296E},
+	{ _t("UpTee"),							0x22A5},
+	{ _t("UpTeeArrow"),						0x21A5},
+	{ _t("Uparrow"),						0x21D1},
+	{ _t("Updownarrow"),					0x21D5},
+	{ _t("UpperLeftArrow"),					0x2196},
+	{ _t("UpperRightArrow"),				0x2197},
+	{ _t("Upsi"),							0x03D2},
+	{ _t("Upsilon"),						0x03A5},
+	{ _t("Uring"),							0x016E},
+	{ _t("Uscr"),							0x1D4B0},
+	{ _t("Utilde"),							0x0168},
+	{ _t("Uuml"),							0x00DC},
+	{ _t("VDash"),							0x22AB},
+	{ _t("Vbar"),							0x2AEB},
+	{ _t("Vcy"),							0x0412},
+	{ _t("Vdash"),							0x22A9},
+	{ _t("Vdashl"),							0x2AE6},
+	{ _t("Vee"),							0x22C1},
+	{ _t("Verbar"),							0x2016},
+	{ _t("Vert"),							0x2016},
+	{ _t("VerticalBar"),					0x2223},
+	{ _t("VerticalLine"),					0x007C},
+	{ _t("VerticalSeparator"),				0x2758},
+	{ _t("VerticalTilde"),					0x2240},
+	{ _t("VeryThinSpace"),					0x200A},
+	{ _t("Vfr"),							0x1D519},
+	{ _t("Vopf"),							0x1D54D},
+	{ _t("Vscr"),							0x1D4B1},
+	{ _t("Vvdash"),							0x22AA},
+	{ _t("Wcirc"),							0x0174},
+	{ _t("Wedge"),							0x22C0},
+	{ _t("Wfr"),							0x1D51A},
+	{ _t("Wopf"),							0x1D54E},
+	{ _t("Wscr"),							0x1D4B2},
+	{ _t("Xfr"),							0x1D51B},
+	{ _t("Xi"),								0x039E},
+	{ _t("Xopf"),							0x1D54F},
+	{ _t("Xscr"),							0x1D4B3},
+	{ _t("YAcy"),							0x042F},
+	{ _t("YIcy"),							0x0407},
+	{ _t("YUcy"),							0x042E},
+	{ _t("Yacute"),							0x00DD},
+	{ _t("Ycirc"),							0x0176},
+	{ _t("Ycy"),							0x042B},
+	{ _t("Yfr"),							0x1D51C},
+	{ _t("Yopf"),							0x1D550},
+	{ _t("Yscr"),							0x1D4B4},
+	{ _t("Yuml"),							0x0178},
+	{ _t("ZHcy"),							0x0416},
+	{ _t("Zacute"),							0x0179},
+	{ _t("Zcaron"),							0x017D},
+	{ _t("Zcy"),							0x0417},
+	{ _t("Zdot"),							0x017B},
+	{ _t("ZeroWidthSpace"),					0x200B},
+	{ _t("Zeta"),							0x0396},
+	{ _t("Zfr"),							0x2128},
+	{ _t("Zopf"),							0x2124},
+	{ _t("Zscr"),							0x1D4B5},
+	{ _t("aacute"),							0x00E1},
+	{ _t("abreve"),							0x0103},
+	{ _t("ac"),								0x223E},
+	{ _t("acd"),							0x223F},
+	{ _t("acirc"),							0x00E2},
+	{ _t("acute"),							0x00B4},
+	{ _t("acy"),							0x0430},
+	{ _t("aelig"),							0x00E6},
+	{ _t("af"),								0x2061},
+	{ _t("afr"),							0x1D51E},
+	{ _t("agrave"),							0x00E0},
+	{ _t("alefsym"),						0x2135},
+	{ _t("aleph"),							0x2135},
+	{ _t("alpha"),							0x03B1},
+	{ _t("amacr"),							0x0101},
+	{ _t("amalg"),							0x2A3F},
+	{ _t("amp"),							0x0026},
+	{ _t("and"),							0x2227},
+	{ _t("andand"),							0x2A55},
+	{ _t("andd"),							0x2A5C},
+	{ _t("andslope"),						0x2A58},
+	{ _t("andv"),							0x2A5A},
+	{ _t("ang"),							0x2220},
+	{ _t("ange"),							0x29A4},
+	{ _t("angle"),							0x2220},
+	{ _t("angmsd"),							0x2221},
+	{ _t("angmsdaa"),						0x29A8},
+	{ _t("angmsdab"),						0x29A9},
+	{ _t("angmsdac"),						0x29AA},
+	{ _t("angmsdad"),						0x29AB},
+	{ _t("angmsdae"),						0x29AC},
+	{ _t("angmsdaf"),						0x29AD},
+	{ _t("angmsdag"),						0x29AE},
+	{ _t("angmsdah"),						0x29AF},
+	{ _t("angrt"),							0x221F},
+	{ _t("angrtvb"),						0x22BE},
+	{ _t("angrtvbd"),						0x299D},
+	{ _t("angsph"),							0x2222},
+	{ _t("angst"),							0x00C5},
+	{ _t("angzarr"),						0x237C},
+	{ _t("aogon"),							0x0105},
+	{ _t("aopf"),							0x1D552},
+	{ _t("ap"),								0x2248},
+	{ _t("apE"),							0x2A70},
+	{ _t("apacir"),							0x2A6F},
+	{ _t("ape"),							0x224A},
+	{ _t("apid"),							0x224B},
+	{ _t("apos"),							0x0027},
+	{ _t("approx"),							0x2248},
+	{ _t("approxeq"),						0x224A},
+	{ _t("aring"),							0x00E5},
+	{ _t("ascr"),							0x1D4B6},
+	{ _t("ast"),							0x002A},
+	{ _t("asymp"),							0x2248},
+	{ _t("asympeq"),						0x224D},
+	{ _t("atilde"),							0x00E3},
+	{ _t("auml"),							0x00E4},
+	{ _t("awconint"),						0x2233},
+	{ _t("awint"),							0x2A11},
+	{ _t("bNot"),							0x2AED},
+	{ _t("backcong"),						0x224C},
+	{ _t("backepsilon"),					0x03F6},
+	{ _t("backprime"),						0x2035},
+	{ _t("backsim"),						0x223D},
+	{ _t("backsimeq"),						0x22CD},
+	{ _t("barvee"),							0x22BD},
+	{ _t("barwed"),							0x2305},
+	{ _t("barwedge"),						0x2305},
+	{ _t("bbrk"),							0x23B5},
+	{ _t("bbrktbrk"),						0x23B6},
+	{ _t("bcong"),							0x224C},
+	{ _t("bcy"),							0x0431},
+	{ _t("bdquo"),							0x201E},
+	{ _t("becaus"),							0x2235},
+	{ _t("because"),						0x2235},
+	{ _t("bemptyv"),						0x29B0},
+	{ _t("bepsi"),							0x03F6},
+	{ _t("bernou"),							0x212C},
+	{ _t("beta"),							0x03B2},
+	{ _t("beth"),							0x2136},
+	{ _t("between"),						0x226C},
+	{ _t("bfr"),							0x1D51F},
+	{ _t("bigcap"),							0x22C2},
+	{ _t("bigcirc"),						0x25EF},
+	{ _t("bigcup"),							0x22C3},
+	{ _t("bigodot"),						0x2A00},
+	{ _t("bigoplus"),						0x2A01},
+	{ _t("bigotimes"),						0x2A02},
+	{ _t("bigsqcup"),						0x2A06},
+	{ _t("bigstar"),						0x2605},
+	{ _t("bigtriangledown"),				0x25BD},
+	{ _t("bigtriangleup"),					0x25B3},
+	{ _t("biguplus"),						0x2A04},
+	{ _t("bigvee"),							0x22C1},
+	{ _t("bigwedge"),						0x22C0},
+	{ _t("bkarow"),							0x290D},
+	{ _t("blacklozenge"),					0x29EB},
+	{ _t("blacksquare"),					0x25AA},
+	{ _t("blacktriangle"),					0x25B4},
+	{ _t("blacktriangledown"),				0x25BE},
+	{ _t("blacktriangleleft"),				0x25C2},
+	{ _t("blacktriangleright"),				0x25B8},
+	{ _t("blank"),							0x2423},
+	{ _t("blk12"),							0x2592},
+	{ _t("blk14"),							0x2591},
+	{ _t("blk34"),							0x2593},
+	{ _t("block"),							0x2588},
+	{ _t("bnot"),							0x2310},
+	{ _t("bopf"),							0x1D553},
+	{ _t("bot"),							0x22A5},
+	{ _t("bottom"),							0x22A5},
+	{ _t("bowtie"),							0x22C8},
+	{ _t("boxDL"),							0x2557},
+	{ _t("boxDR"),							0x2554},
+	{ _t("boxDl"),							0x2556},
+	{ _t("boxDr"),							0x2553},
+	{ _t("boxH"),							0x2550},
+	{ _t("boxHD"),							0x2566},
+	{ _t("boxHU"),							0x2569},
+	{ _t("boxHd"),							0x2564},
+	{ _t("boxHu"),							0x2567},
+	{ _t("boxUL"),							0x255D},
+	{ _t("boxUR"),							0x255A},
+	{ _t("boxUl"),							0x255C},
+	{ _t("boxUr"),							0x2559},
+	{ _t("boxV"),							0x2551},
+	{ _t("boxVH"),							0x256C},
+	{ _t("boxVL"),							0x2563},
+	{ _t("boxVR"),							0x2560},
+	{ _t("boxVh"),							0x256B},
+	{ _t("boxVl"),							0x2562},
+	{ _t("boxVr"),							0x255F},
+	{ _t("boxbox"),							0x29C9},
+	{ _t("boxdL"),							0x2555},
+	{ _t("boxdR"),							0x2552},
+	{ _t("boxdl"),							0x2510},
+	{ _t("boxdr"),							0x250C},
+	{ _t("boxh"),							0x2500},
+	{ _t("boxhD"),							0x2565},
+	{ _t("boxhU"),							0x2568},
+	{ _t("boxhd"),							0x252C},
+	{ _t("boxhu"),							0x2534},
+	{ _t("boxminus"),						0x229F},
+	{ _t("boxplus"),						0x229E},
+	{ _t("boxtimes"),						0x22A0},
+	{ _t("boxuL"),							0x255B},
+	{ _t("boxuR"),							0x2558},
+	{ _t("boxul"),							0x2518},
+	{ _t("boxur"),							0x2514},
+	{ _t("boxv"),							0x2502},
+	{ _t("boxvH"),							0x256A},
+	{ _t("boxvL"),							0x2561},
+	{ _t("boxvR"),							0x255E},
+	{ _t("boxvh"),							0x253C},
+	{ _t("boxvl"),							0x2524},
+	{ _t("boxvr"),							0x251C},
+	{ _t("bprime"),							0x2035},
+	{ _t("breve"),							0x02D8},
+	{ _t("brvbar"),							0x00A6},
+	{ _t("bscr"),							0x1D4B7},
+	{ _t("bsemi"),							0x204F},
+	{ _t("bsim"),							0x223D},
+	{ _t("bsime"),							0x22CD},
+	{ _t("bsol"),							0x005C},
+	{ _t("bsolb"),							0x29C5},
+	{ _t("bsolhsub"),						0x27C8},
+	{ _t("bull"),							0x2022},
+	{ _t("bullet"),							0x2022},
+	{ _t("bump"),							0x224E},
+	{ _t("bumpE"),							0x2AAE},
+	{ _t("bumpe"),							0x224F},
+	{ _t("bumpeq"),							0x224F},
+	{ _t("cacute"),							0x0107},
+	{ _t("cap"),							0x2229},
+	{ _t("capand"),							0x2A44},
+	{ _t("capbrcup"),						0x2A49},
+	{ _t("capcap"),							0x2A4B},
+	{ _t("capcup"),							0x2A47},
+	{ _t("capdot"),							0x2A40},
+	{ _t("caret"),							0x2041},
+	{ _t("caron"),							0x02C7},
+	{ _t("ccaps"),							0x2A4D},
+	{ _t("ccaron"),							0x010D},
+	{ _t("ccedil"),							0x00E7},
+	{ _t("ccirc"),							0x0109},
+	{ _t("ccups"),							0x2A4C},
+	{ _t("ccupssm"),						0x2A50},
+	{ _t("cdot"),							0x010B},
+	{ _t("cedil"),							0x00B8},
+	{ _t("cemptyv"),						0x29B2},
+	{ _t("cent"),							0x00A2},
+	{ _t("centerdot"),						0x00B7},
+	{ _t("cfr"),							0x1D520},
+	{ _t("chcy"),							0x0447},
+	{ _t("check"),							0x2713},
+	{ _t("checkmark"),						0x2713},
+	{ _t("chi"),							0x03C7},
+	{ _t("cir"),							0x25CB},
+	{ _t("cirE"),							0x29C3},
+	{ _t("circ"),							0x02C6},
+	{ _t("circeq"),							0x2257},
+	{ _t("circlearrowleft"),				0x21BA},
+	{ _t("circlearrowright"),				0x21BB},
+	{ _t("circledR"),						0x00AE},
+	{ _t("circledS"),						0x24C8},
+	{ _t("circledast"),						0x229B},
+	{ _t("circledcirc"),					0x229A},
+	{ _t("circleddash"),					0x229D},
+	{ _t("cire"),							0x2257},
+	{ _t("cirfnint"),						0x2A10},
+	{ _t("cirmid"),							0x2AEF},
+	{ _t("cirscir"),						0x29C2},
+	{ _t("clubs"),							0x2663},
+	{ _t("clubsuit"),						0x2663},
+	{ _t("colon"),							0x003A},
+	{ _t("colone"),							0x2254},
+	{ _t("coloneq"),						0x2254},
+	{ _t("comma"),							0x002C},
+	{ _t("commat"),							0x0040},
+	{ _t("comp"),							0x2201},
+	{ _t("compfn"),							0x2218},
+	{ _t("complement"),						0x2201},
+	{ _t("complexes"),						0x2102},
+	{ _t("cong"),							0x2245},
+	{ _t("congdot"),						0x2A6D},
+	{ _t("conint"),							0x222E},
+	{ _t("copf"),							0x1D554},
+	{ _t("coprod"),							0x2210},
+	{ _t("copy"),							0x00A9},
+	{ _t("copysr"),							0x2117},
+	{ _t("crarr"),							0x21B5},
+	{ _t("cross"),							0x2717},
+	{ _t("cscr"),							0x1D4B8},
+	{ _t("csub"),							0x2ACF},
+	{ _t("csube"),							0x2AD1},
+	{ _t("csup"),							0x2AD0},
+	{ _t("csupe"),							0x2AD2},
+	{ _t("ctdot"),							0x22EF},
+	{ _t("cudarrl"),						0x2938},
+	{ _t("cudarrr"),						0x2935},
+	{ _t("cuepr"),							0x22DE},
+	{ _t("cuesc"),							0x22DF},
+	{ _t("cularr"),							0x21B6},
+	{ _t("cularrp"),						0x293D},
+	{ _t("cup"),							0x222A},
+	{ _t("cupbrcap"),						0x2A48},
+	{ _t("cupcap"),							0x2A46},
+	{ _t("cupcup"),							0x2A4A},
+	{ _t("cupdot"),							0x228D},
+	{ _t("cupor"),							0x2A45},
+	{ _t("curarr"),							0x21B7},
+	{ _t("curarrm"),						0x293C},
+	{ _t("curlyeqprec"),					0x22DE},
+	{ _t("curlyeqsucc"),					0x22DF},
+	{ _t("curlyvee"),						0x22CE},
+	{ _t("curlywedge"),						0x22CF},
+	{ _t("curren"),							0x00A4},
+	{ _t("curvearrowleft"),					0x21B6},
+	{ _t("curvearrowright"),				0x21B7},
+	{ _t("cuvee"),							0x22CE},
+	{ _t("cuwed"),							0x22CF},
+	{ _t("cwconint"),						0x2232},
+	{ _t("cwint"),							0x2231},
+	{ _t("cylcty"),							0x232D},
+	{ _t("dArr"),							0x21D3},
+	{ _t("dHar"),							0x2965},
+	{ _t("dagger"),							0x2020},
+	{ _t("daleth"),							0x2138},
+	{ _t("darr"),							0x2193},
+	{ _t("dash"),							0x2010},
+	{ _t("dashv"),							0x22A3},
+	{ _t("dbkarow"),						0x290F},
+	{ _t("dblac"),							0x02DD},
+	{ _t("dcaron"),							0x010F},
+	{ _t("dcy"),							0x0434},
+	{ _t("dd"),								0x2146},
+	{ _t("ddagger"),						0x2021},
+	{ _t("ddarr"),							0x21CA},
+	{ _t("ddotseq"),						0x2A77},
+	{ _t("deg"),							0x00B0},
+	{ _t("delta"),							0x03B4},
+	{ _t("demptyv"),						0x29B1},
+	{ _t("dfisht"),							0x297F},
+	{ _t("dfr"),							0x1D521},
+	{ _t("dharl"),							0x21C3},
+	{ _t("dharr"),							0x21C2},
+	{ _t("diam"),							0x22C4},
+	{ _t("diamond"),						0x22C4},
+	{ _t("diamondsuit"),					0x2666},
+	{ _t("diams"),							0x2666},
+	{ _t("die"),							0x00A8},
+	{ _t("digamma"),						0x03DD},
+	{ _t("disin"),							0x22F2},
+	{ _t("div"),							0x00F7},
+	{ _t("divide"),							0x00F7},
+	{ _t("divideontimes"),					0x22C7},
+	{ _t("divonx"),							0x22C7},
+	{ _t("djcy"),							0x0452},
+	{ _t("dlcorn"),							0x231E},
+	{ _t("dlcrop"),							0x230D},
+	{ _t("dollar"),							0x0024},
+	{ _t("dopf"),							0x1D555},
+	{ _t("dot"),							0x02D9},
+	{ _t("doteq"),							0x2250},
+	{ _t("doteqdot"),						0x2251},
+	{ _t("dotminus"),						0x2238},
+	{ _t("dotplus"),						0x2214},
+	{ _t("dotsquare"),						0x22A1},
+	{ _t("doublebarwedge"),					0x2306},
+	{ _t("downarrow"),						0x2193},
+	{ _t("downdownarrows"),					0x21CA},
+	{ _t("downharpoonleft"),				0x21C3},
+	{ _t("downharpoonright"),				0x21C2},
+	{ _t("drbkarow"),						0x2910},
+	{ _t("drcorn"),							0x231F},
+	{ _t("drcrop"),							0x230C},
+	{ _t("dscr"),							0x1D4B9},
+	{ _t("dscy"),							0x0455},
+	{ _t("dsol"),							0x29F6},
+	{ _t("dstrok"),							0x0111},
+	{ _t("dtdot"),							0x22F1},
+	{ _t("dtri"),							0x25BF},
+	{ _t("dtrif"),							0x25BE},
+	{ _t("duarr"),							0x21F5},
+	{ _t("duhar"),							0x296F},
+	{ _t("dwangle"),						0x29A6},
+	{ _t("dzcy"),							0x045F},
+	{ _t("dzigrarr"),						0x27FF},
+	{ _t("eDDot"),							0x2A77},
+	{ _t("eDot"),							0x2251},
+	{ _t("eacute"),							0x00E9},
+	{ _t("easter"),							0x2A6E},
+	{ _t("ecaron"),							0x011B},
+	{ _t("ecir"),							0x2256},
+	{ _t("ecirc"),							0x00EA},
+	{ _t("ecolon"),							0x2255},
+	{ _t("ecy"),							0x044D},
+	{ _t("edot"),							0x0117},
+	{ _t("ee"),								0x2147},
+	{ _t("efDot"),							0x2252},
+	{ _t("efr"),							0x1D522},
+	{ _t("eg"),								0x2A9A},
+	{ _t("egrave"),							0x00E8},
+	{ _t("egs"),							0x2A96},
+	{ _t("egsdot"),							0x2A98},
+	{ _t("el"),								0x2A99},
+	{ _t("elinters"),						0x23E7},
+	{ _t("ell"),							0x2113},
+	{ _t("els"),							0x2A95},
+	{ _t("elsdot"),							0x2A97},
+	{ _t("emacr"),							0x0113},
+	{ _t("empty"),							0x2205},
+	{ _t("emptyset"),						0x2205},
+	{ _t("emptyv"),							0x2205},
+	{ _t("emsp"),							0x2003},
+	{ _t("emsp13"),							0x2004},
+	{ _t("emsp14"),							0x2005},
+	{ _t("eng"),							0x014B},
+	{ _t("ensp"),							0x2002},
+	{ _t("eogon"),							0x0119},
+	{ _t("eopf"),							0x1D556},
+	{ _t("epar"),							0x22D5},
+	{ _t("eparsl"),							0x29E3},
+	{ _t("eplus"),							0x2A71},
+	{ _t("epsi"),							0x03B5},
+	{ _t("epsilon"),						0x03B5},
+	{ _t("epsiv"),							0x03F5},
+	{ _t("eqcirc"),							0x2256},
+	{ _t("eqcolon"),						0x2255},
+	{ _t("eqsim"),							0x2242},
+	{ _t("eqslantgtr"),						0x2A96},
+	{ _t("eqslantless"),					0x2A95},
+	{ _t("equals"),							0x003D},
+	{ _t("equest"),							0x225F},
+	{ _t("equiv"),							0x2261},
+	{ _t("equivDD"),						0x2A78},
+	{ _t("eqvparsl"),						0x29E5},
+	{ _t("erDot"),							0x2253},
+	{ _t("erarr"),							0x2971},
+	{ _t("escr"),							0x212F},
+	{ _t("esdot"),							0x2250},
+	{ _t("esim"),							0x2242},
+	{ _t("eta"),							0x03B7},
+	{ _t("eth"),							0x00F0},
+	{ _t("euml"),							0x00EB},
+	{ _t("euro"),							0x20AC},
+	{ _t("excl"),							0x0021},
+	{ _t("exist"),							0x2203},
+	{ _t("expectation"),					0x2130},
+	{ _t("exponentiale"),					0x2147},
+	{ _t("fallingdotseq"),					0x2252},
+	{ _t("fcy"),							0x0444},
+	{ _t("female"),							0x2640},
+	{ _t("ffilig"),							0xFB03},
+	{ _t("fflig"),							0xFB00},
+	{ _t("ffllig"),							0xFB04},
+	{ _t("ffr"),							0x1D523},
+	{ _t("filig"),							0xFB01},
+	{ _t("flat"),							0x266D},
+	{ _t("fllig"),							0xFB02},
+	{ _t("fltns"),							0x25B1},
+	{ _t("fnof"),							0x0192},
+	{ _t("fopf"),							0x1D557},
+	{ _t("forall"),							0x2200},
+	{ _t("fork"),							0x22D4},
+	{ _t("forkv"),							0x2AD9},
+	{ _t("fpartint"),						0x2A0D},
+	{ _t("frac12"),							0x00BD},
+	{ _t("frac13"),							0x2153},
+	{ _t("frac14"),							0x00BC},
+	{ _t("frac15"),							0x2155},
+	{ _t("frac16"),							0x2159},
+	{ _t("frac18"),							0x215B},
+	{ _t("frac23"),							0x2154},
+	{ _t("frac25"),							0x2156},
+	{ _t("frac34"),							0x00BE},
+	{ _t("frac35"),							0x2157},
+	{ _t("frac38"),							0x215C},
+	{ _t("frac45"),							0x2158},
+	{ _t("frac56"),							0x215A},
+	{ _t("frac58"),							0x215D},
+	{ _t("frac78"),							0x215E},
+	{ _t("frasl"),							0x2044},
+	{ _t("frown"),							0x2322},
+	{ _t("fscr"),							0x1D4BB},
+	{ _t("gE"),								0x2267},
+	{ _t("gEl"),							0x2A8C},
+	{ _t("gacute"),							0x01F5},
+	{ _t("gamma"),							0x03B3},
+	{ _t("gammad"),							0x03DD},
+	{ _t("gap"),							0x2A86},
+	{ _t("gbreve"),							0x011F},
+	{ _t("gcirc"),							0x011D},
+	{ _t("gcy"),							0x0433},
+	{ _t("gdot"),							0x0121},
+	{ _t("ge"),								0x2265},
+	{ _t("gel"),							0x22DB},
+	{ _t("geq"),							0x2265},
+	{ _t("geqq"),							0x2267},
+	{ _t("geqslant"),						0x2A7E},
+	{ _t("ges"),							0x2A7E},
+	{ _t("gescc"),							0x2AA9},
+	{ _t("gesdot"),							0x2A80},
+	{ _t("gesdoto"),						0x2A82},
+	{ _t("gesdotol"),						0x2A84},
+	{ _t("gesles"),							0x2A94},
+	{ _t("gfr"),							0x1D524},
+	{ _t("gg"),								0x226B},
+	{ _t("ggg"),							0x22D9},
+	{ _t("gimel"),							0x2137},
+	{ _t("gjcy"),							0x0453},
+	{ _t("gl"),								0x2277},
+	{ _t("glE"),							0x2A92},
+	{ _t("gla"),							0x2AA5},
+	{ _t("glj"),							0x2AA4},
+	{ _t("gnE"),							0x2269},
+	{ _t("gnap"),							0x2A8A},
+	{ _t("gnapprox"),						0x2A8A},
+	{ _t("gne"),							0x2A88},
+	{ _t("gneq"),							0x2A88},
+	{ _t("gneqq"),							0x2269},
+	{ _t("gnsim"),							0x22E7},
+	{ _t("gopf"),							0x1D558},
+	{ _t("grave"),							0x0060},
+	{ _t("gscr"),							0x210A},
+	{ _t("gsim"),							0x2273},
+	{ _t("gsime"),							0x2A8E},
+	{ _t("gsiml"),							0x2A90},
+	{ _t("gt"),								0x003E},
+	{ _t("gtcc"),							0x2AA7},
+	{ _t("gtcir"),							0x2A7A},
+	{ _t("gtdot"),							0x22D7},
+	{ _t("gtlPar"),							0x2995},
+	{ _t("gtquest"),						0x2A7C},
+	{ _t("gtrapprox"),						0x2A86},
+	{ _t("gtrarr"),							0x2978},
+	{ _t("gtrdot"),							0x22D7},
+	{ _t("gtreqless"),						0x22DB},
+	{ _t("gtreqqless"),						0x2A8C},
+	{ _t("gtrless"),						0x2277},
+	{ _t("gtrsim"),							0x2273},
+	{ _t("hArr"),							0x21D4},
+	{ _t("hairsp"),							0x200A},
+	{ _t("half"),							0x00BD},
+	{ _t("hamilt"),							0x210B},
+	{ _t("hardcy"),							0x044A},
+	{ _t("harr"),							0x2194},
+	{ _t("harrcir"),						0x2948},
+	{ _t("harrw"),							0x21AD},
+	{ _t("hbar"),							0x210F},
+	{ _t("hcirc"),							0x0125},
+	{ _t("hearts"),							0x2665},
+	{ _t("heartsuit"),						0x2665},
+	{ _t("hellip"),							0x2026},
+	{ _t("hercon"),							0x22B9},
+	{ _t("hfr"),							0x1D525},
+	{ _t("hksearow"),						0x2925},
+	{ _t("hkswarow"),						0x2926},
+	{ _t("hoarr"),							0x21FF},
+	{ _t("homtht"),							0x223B},
+	{ _t("hookleftarrow"),					0x21A9},
+	{ _t("hookrightarrow"),					0x21AA},
+	{ _t("hopf"),							0x1D559},
+	{ _t("horbar"),							0x2015},
+	{ _t("hscr"),							0x1D4BD},
+	{ _t("hslash"),							0x210F},
+	{ _t("hstrok"),							0x0127},
+	{ _t("hybull"),							0x2043},
+	{ _t("hyphen"),							0x2010},
+	{ _t("iacute"),							0x00ED},
+	{ _t("ic"),								0x2063},
+	{ _t("icirc"),							0x00EE},
+	{ _t("icy"),							0x0438},
+	{ _t("iecy"),							0x0435},
+	{ _t("iexcl"),							0x00A1},
+	{ _t("iff"),							0x21D4},
+	{ _t("ifr"),							0x1D526},
+	{ _t("igrave"),							0x00EC},
+	{ _t("ii"),								0x2148},
+	{ _t("iiiint"),							0x2A0C},
+	{ _t("iiint"),							0x222D},
+	{ _t("iinfin"),							0x29DC},
+	{ _t("iiota"),							0x2129},
+	{ _t("ijlig"),							0x0133},
+	{ _t("imacr"),							0x012B},
+	{ _t("image"),							0x2111},
+	{ _t("imagline"),						0x2110},
+	{ _t("imagpart"),						0x2111},
+	{ _t("imath"),							0x0131},
+	{ _t("imof"),							0x22B7},
+	{ _t("imped"),							0x01B5},
+	{ _t("in"),								0x2208},
+	{ _t("incare"),							0x2105},
+	{ _t("infin"),							0x221E},
+	{ _t("infintie"),						0x29DD},
+	{ _t("inodot"),							0x0131},
+	{ _t("int"),							0x222B},
+	{ _t("intcal"),							0x22BA},
+	{ _t("integers"),						0x2124},
+	{ _t("intercal"),						0x22BA},
+	{ _t("intlarhk"),						0x2A17},
+	{ _t("intprod"),						0x2A3C},
+	{ _t("iocy"),							0x0451},
+	{ _t("iogon"),							0x012F},
+	{ _t("iopf"),							0x1D55A},
+	{ _t("iota"),							0x03B9},
+	{ _t("iprod"),							0x2A3C},
+	{ _t("iquest"),							0x00BF},
+	{ _t("iscr"),							0x1D4BE},
+	{ _t("isin"),							0x2208},
+	{ _t("isinE"),							0x22F9},
+	{ _t("isindot"),						0x22F5},
+	{ _t("isins"),							0x22F4},
+	{ _t("isinsv"),							0x22F3},
+	{ _t("isinv"),							0x2208},
+	{ _t("it"),								0x2062},
+	{ _t("itilde"),							0x0129},
+	{ _t("iukcy"),							0x0456},
+	{ _t("iuml"),							0x00EF},
+	{ _t("jcirc"),							0x0135},
+	{ _t("jcy"),							0x0439},
+	{ _t("jfr"),							0x1D527},
+	{ _t("jmath"),							0x0237},
+	{ _t("jopf"),							0x1D55B},
+	{ _t("jscr"),							0x1D4BF},
+	{ _t("jsercy"),							0x0458},
+	{ _t("jukcy"),							0x0454},
+	{ _t("kappa"),							0x03BA},
+	{ _t("kappav"),							0x03F0},
+	{ _t("kcedil"),							0x0137},
+	{ _t("kcy"),							0x043A},
+	{ _t("kfr"),							0x1D528},
+	{ _t("kgreen"),							0x0138},
+	{ _t("khcy"),							0x0445},
+	{ _t("kjcy"),							0x045C},
+	{ _t("kopf"),							0x1D55C},
+	{ _t("kscr"),							0x1D4C0},
+	{ _t("lAarr"),							0x21DA},
+	{ _t("lArr"),							0x21D0},
+	{ _t("lAtail"),							0x291B},
+	{ _t("lBarr"),							0x290E},
+	{ _t("lE"),								0x2266},
+	{ _t("lEg"),							0x2A8B},
+	{ _t("lHar"),							0x2962},
+	{ _t("lacute"),							0x013A},
+	{ _t("laemptyv"),						0x29B4},
+	{ _t("lagran"),							0x2112},
+	{ _t("lambda"),							0x03BB},
+	{ _t("lang"),							0x2329},
+	{ _t("langd"),							0x2991},
+	{ _t("langle"),							0x27E8},
+	{ _t("lap"),							0x2A85},
+	{ _t("laquo"),							0x00AB},
+	{ _t("larr"),							0x2190},
+	{ _t("larrb"),							0x21E4},
+	{ _t("larrbfs"),						0x291F},
+	{ _t("larrfs"),							0x291D},
+	{ _t("larrhk"),							0x21A9},
+	{ _t("larrlp"),							0x21AB},
+	{ _t("larrpl"),							0x2939},
+	{ _t("larrsim"),						0x2973},
+	{ _t("larrtl"),							0x21A2},
+	{ _t("lat"),							0x2AAB},
+	{ _t("latail"),							0x2919},
+	{ _t("late"),							0x2AAD},
+	{ _t("lbarr"),							0x290C},
+	{ _t("lbbrk"),							0x2772},
+	{ _t("lbrace"),							0x007B},
+	{ _t("lbrack"),							0x005B},
+	{ _t("lbrke"),							0x298B},
+	{ _t("lbrksld"),						0x298F},
+	{ _t("lbrkslu"),						0x298D},
+	{ _t("lcaron"),							0x013E},
+	{ _t("lcedil"),							0x013C},
+	{ _t("lceil"),							0x2308},
+	{ _t("lcub"),							0x007B},
+	{ _t("lcy"),							0x043B},
+	{ _t("ldca"),							0x2936},
+	{ _t("ldquo"),							0x201C},
+	{ _t("ldquor"),							0x201E},
+	{ _t("ldrdhar"),						0x2967},
+	{ _t("ldrushar"),						0x294B},
+	{ _t("ldsh"),							0x21B2},
+	{ _t("le"),								0x2264},
+	{ _t("leftarrow"),						0x2190},
+	{ _t("leftarrowtail"),					0x21A2},
+	{ _t("leftharpoondown"),				0x21BD},
+	{ _t("leftharpoonup"),					0x21BC},
+	{ _t("leftleftarrows"),					0x21C7},
+	{ _t("leftrightarrow"),					0x2194},
+	{ _t("leftrightarrows"),				0x21C6},
+	{ _t("leftrightharpoons"),				0x21CB},
+	{ _t("leftrightsquigarrow"),			0x21AD},
+	{ _t("leftthreetimes"),					0x22CB},
+	{ _t("leg"),							0x22DA},
+	{ _t("leq"),							0x2264},
+	{ _t("leqq"),							0x2266},
+	{ _t("leqslant"),						0x2A7D},
+	{ _t("les"),							0x2A7D},
+	{ _t("lescc"),							0x2AA8},
+	{ _t("lesdot"),							0x2A7F},
+	{ _t("lesdoto"),						0x2A81},
+	{ _t("lesdotor"),						0x2A83},
+	{ _t("lesges"),							0x2A93},
+	{ _t("lessapprox"),						0x2A85},
+	{ _t("lessdot"),						0x22D6},
+	{ _t("lesseqgtr"),						0x22DA},
+	{ _t("lesseqqgtr"),						0x2A8B},
+	{ _t("lessgtr"),						0x2276},
+	{ _t("lesssim"),						0x2272},
+	{ _t("lfisht"),							0x297C},
+	{ _t("lfloor"),							0x230A},
+	{ _t("lfr"),							0x1D529},
+	{ _t("lg"),								0x2276},
+	{ _t("lgE"),							0x2A91},
+	{ _t("lhard"),							0x21BD},
+	{ _t("lharu"),							0x21BC},
+	{ _t("lharul"),							0x296A},
+	{ _t("lhblk"),							0x2584},
+	{ _t("ljcy"),							0x0459},
+	{ _t("ll"),								0x226A},
+	{ _t("llarr"),							0x21C7},
+	{ _t("llcorner"),						0x231E},
+	{ _t("llhard"),							0x296B},
+	{ _t("lltri"),							0x25FA},
+	{ _t("lmidot"),							0x0140},
+	{ _t("lmoust"),							0x23B0},
+	{ _t("lmoustache"),						0x23B0},
+	{ _t("lnE"),							0x2268},
+	{ _t("lnap"),							0x2A89},
+	{ _t("lnapprox"),						0x2A89},
+	{ _t("lne"),							0x2A87},
+	{ _t("lneq"),							0x2A87},
+	{ _t("lneqq"),							0x2268},
+	{ _t("lnsim"),							0x22E6},
+	{ _t("loang"),							0x27EC},
+	{ _t("loarr"),							0x21FD},
+	{ _t("lobrk"),							0x27E6},
+	{ _t("longleftarrow"),					0x27F5},
+	{ _t("longleftrightarrow"),				0x27F7},
+	{ _t("longmapsto"),						0x27FC},
+	{ _t("longrightarrow"),					0x27F6},
+	{ _t("looparrowleft"),					0x21AB},
+	{ _t("looparrowright"),					0x21AC},
+	{ _t("lopar"),							0x2985},
+	{ _t("lopf"),							0x1D55D},
+	{ _t("loplus"),							0x2A2D},
+	{ _t("lotimes"),						0x2A34},
+	{ _t("lowast"),							0x2217},
+	{ _t("lowbar"),							0x005F},
+	{ _t("loz"),							0x25CA},
+	{ _t("lozenge"),						0x25CA},
+	{ _t("lozf"),							0x29EB},
+	{ _t("lpar"),							0x0028},
+	{ _t("lparlt"),							0x2993},
+	{ _t("lrarr"),							0x21C6},
+	{ _t("lrcorner"),						0x231F},
+	{ _t("lrhar"),							0x21CB},
+	{ _t("lrhard"),							0x296D},
+	{ _t("lrm"),							0x200E},
+	{ _t("lrtri"),							0x22BF},
+	{ _t("lsaquo"),							0x00AB},
+	{ _t("lscr"),							0x1D4C1},
+	{ _t("lsh"),							0x21B0},
+	{ _t("lsim"),							0x2272},
+	{ _t("lsime"),							0x2A8D},
+	{ _t("lsimg"),							0x2A8F},
+	{ _t("lsqb"),							0x005B},
+	{ _t("lsquo"),							0x2018},
+	{ _t("lsquor"),							0x201A},
+	{ _t("lstrok"),							0x0142},
+	{ _t("lt"),								0x003C},
+	{ _t("ltcc"),							0x2AA6},
+	{ _t("ltcir"),							0x2A79},
+	{ _t("ltdot"),							0x22D6},
+	{ _t("lthree"),							0x22CB},
+	{ _t("ltimes"),							0x22C9},
+	{ _t("ltlarr"),							0x2976},
+	{ _t("ltquest"),						0x2A7B},
+	{ _t("ltrPar"),							0x2996},
+	{ _t("ltri"),							0x25C3},
+	{ _t("ltrie"),							0x22B4},
+	{ _t("ltrif"),							0x25C2},
+	{ _t("lurdshar"),						0x294A},
+	{ _t("luruhar"),						0x2966},
+	{ _t("mDDot"),							0x223A},
+	{ _t("macr"),							0x00AF},
+	{ _t("male"),							0x2642},
+	{ _t("malt"),							0x2720},
+	{ _t("maltese"),						0x2720},
+	{ _t("map"),							0x21A6},
+	{ _t("mapsto"),							0x21A6},
+	{ _t("mapstodown"),						0x21A7},
+	{ _t("mapstoleft"),						0x21A4},
+	{ _t("mapstoup"),						0x21A5},
+	{ _t("marker"),							0x25AE},
+	{ _t("mcomma"),							0x2A29},
+	{ _t("mcy"),							0x043C},
+	{ _t("mdash"),							0x2014},
+	{ _t("measuredangle"),					0x2221},
+	{ _t("mfr"),							0x1D52A},
+	{ _t("mho"),							0x2127},
+	{ _t("micro"),							0x00B5},
+	{ _t("mid"),							0x2223},
+	{ _t("midast"),							0x002A},
+	{ _t("midcir"),							0x2AF0},
+	{ _t("middot"),							0x00B7},
+	{ _t("minus"),							0x2212},
+	{ _t("minusb"),							0x229F},
+	{ _t("minusd"),							0x2238},
+	{ _t("minusdu"),						0x2A2A},
+	{ _t("mlcp"),							0x2ADB},
+	{ _t("mldr"),							0x2026},
+	{ _t("mnplus"),							0x2213},
+	{ _t("models"),							0x22A7},
+	{ _t("mopf"),							0x1D55E},
+	{ _t("mp"),								0x2213},
+	{ _t("mscr"),							0x1D4C2},
+	{ _t("mstpos"),							0x223E},
+	{ _t("mu"),								0x03BC},
+	{ _t("multimap"),						0x22B8},
+	{ _t("mumap"),							0x22B8},
+	{ _t("nLeftarrow"),						0x21CD},
+	{ _t("nLeftrightarrow"),				0x21CE},
+	{ _t("nRightarrow"),					0x21CF},
+	{ _t("nVDash"),							0x22AF},
+	{ _t("nVdash"),							0x22AE},
+	{ _t("nabla"),							0x2207},
+	{ _t("nacute"),							0x0144},
+	{ _t("nap"),							0x2249},
+	{ _t("napos"),							0x0149},
+	{ _t("napprox"),						0x2249},
+	{ _t("natur"),							0x266E},
+	{ _t("natural"),						0x266E},
+	{ _t("naturals"),						0x2115},
+	{ _t("nbsp"),							0x00A0},
+	{ _t("ncap"),							0x2A43},
+	{ _t("ncaron"),							0x0148},
+	{ _t("ncedil"),							0x0146},
+	{ _t("ncong"),							0x2247},
+	{ _t("ncup"),							0x2A42},
+	{ _t("ncy"),							0x043D},
+	{ _t("ndash"),							0x2013},
+	{ _t("ne"),								0x2260},
+	{ _t("neArr"),							0x21D7},
+	{ _t("nearhk"),							0x2924},
+	{ _t("nearr"),							0x2197},
+	{ _t("nearrow"),						0x2197},
+	{ _t("nequiv"),							0x2262},
+	{ _t("nesear"),							0x2928},
+	{ _t("nexist"),							0x2204},
+	{ _t("nexists"),						0x2204},
+	{ _t("nfr"),							0x1D52B},
+	{ _t("nge"),							0x2271},
+	{ _t("ngeq"),							0x2271},
+	{ _t("ngsim"),							0x2275},
+	{ _t("ngt"),							0x226F},
+	{ _t("ngtr"),							0x226F},
+	{ _t("nhArr"),							0x21CE},
+	{ _t("nharr"),							0x21AE},
+	{ _t("nhpar"),							0x2AF2},
+	{ _t("ni"),								0x220B},
+	{ _t("nis"),							0x22FC},
+	{ _t("nisd"),							0x22FA},
+	{ _t("niv"),							0x220B},
+	{ _t("njcy"),							0x045A},
+	{ _t("nlArr"),							0x21CD},
+	{ _t("nlarr"),							0x219A},
+	{ _t("nldr"),							0x2025},
+	{ _t("nle"),							0x2270},
+	{ _t("nleftarrow"),						0x219A},
+	{ _t("nleftrightarrow"),				0x21AE},
+	{ _t("nleq"),							0x2270},
+	{ _t("nless"),							0x226E},
+	{ _t("nlsim"),							0x2274},
+	{ _t("nlt"),							0x226E},
+	{ _t("nltri"),							0x22EA},
+	{ _t("nltrie"),							0x22EC},
+	{ _t("nmid"),							0x2224},
+	{ _t("nopf"),							0x1D55F},
+	{ _t("not"),							0x00AC},
+	{ _t("notin"),							0x2209},
+	{ _t("notinva"),						0x2209},
+	{ _t("notinvb"),						0x22F7},
+	{ _t("notinvc"),						0x22F6},
+	{ _t("notni"),							0x220C},
+	{ _t("notniva"),						0x220C},
+	{ _t("notnivb"),						0x22FE},
+	{ _t("notnivc"),						0x22FD},
+	{ _t("npar"),							0x2226},
+	{ _t("nparallel"),						0x2226},
+	{ _t("npolint"),						0x2A14},
+	{ _t("npr"),							0x2280},
+	{ _t("nprcue"),							0x22E0},
+	{ _t("nprec"),							0x2280},
+	{ _t("nrArr"),							0x21CF},
+	{ _t("nrarr"),							0x219B},
+	{ _t("nrightarrow"),					0x219B},
+	{ _t("nrtri"),							0x22EB},
+	{ _t("nrtrie"),							0x22ED},
+	{ _t("nsc"),							0x2281},
+	{ _t("nsccue"),							0x22E1},
+	{ _t("nscr"),							0x1D4C3},
+	{ _t("nshortmid"),						0x2224},
+	{ _t("nshortparallel"),					0x2226},
+	{ _t("nsim"),							0x2241},
+	{ _t("nsime"),							0x2244},
+	{ _t("nsimeq"),							0x2244},
+	{ _t("nsmid"),							0x2224},
+	{ _t("nspar"),							0x2226},
+	{ _t("nsqsube"),						0x22E2},
+	{ _t("nsqsupe"),						0x22E3},
+	{ _t("nsub"),							0x2284},
+	{ _t("nsube"),							0x2288},
+	{ _t("nsubseteq"),						0x2288},
+	{ _t("nsucc"),							0x2281},
+	{ _t("nsup"),							0x2285},
+	{ _t("nsupe"),							0x2289},
+	{ _t("nsupseteq"),						0x2289},
+	{ _t("ntgl"),							0x2279},
+	{ _t("ntilde"),							0x00F1},
+	{ _t("ntlg"),							0x2278},
+	{ _t("ntriangleleft"),					0x22EA},
+	{ _t("ntrianglelefteq"),				0x22EC},
+	{ _t("ntriangleright"),					0x22EB},
+	{ _t("ntrianglerighteq"),				0x22ED},
+	{ _t("nu"),								0x03BD},
+	{ _t("num"),							0x0023},
+	{ _t("numero"),							0x2116},
+	{ _t("numsp"),							0x2007},
+	{ _t("nvDash"),							0x22AD},
+	{ _t("nvHarr"),							0x2904},
+	{ _t("nvdash"),							0x22AC},
+	{ _t("nvinfin"),						0x29DE},
+	{ _t("nvlArr"),							0x2902},
+	{ _t("nvrArr"),							0x2903},
+	{ _t("nwArr"),							0x21D6},
+	{ _t("nwarhk"),							0x2923},
+	{ _t("nwarr"),							0x2196},
+	{ _t("nwarrow"),						0x2196},
+	{ _t("nwnear"),							0x2927},
+	{ _t("oS"),								0x24C8},
+	{ _t("oacute"),							0x00F3},
+	{ _t("oast"),							0x229B},
+	{ _t("ocir"),							0x229A},
+	{ _t("ocirc"),							0x00F4},
+	{ _t("ocy"),							0x043E},
+	{ _t("odash"),							0x229D},
+	{ _t("odblac"),							0x0151},
+	{ _t("odiv"),							0x2A38},
+	{ _t("odot"),							0x2299},
+	{ _t("odsold"),							0x29BC},
+	{ _t("oelig"),							0x0153},
+	{ _t("ofcir"),							0x29BF},
+	{ _t("ofr"),							0x1D52C},
+	{ _t("ogon"),							0x02DB},
+	{ _t("ograve"),							0x00F2},
+	{ _t("ogt"),							0x29C1},
+	{ _t("ohbar"),							0x29B5},
+	{ _t("ohm"),							0x03A9},
+	{ _t("oint"),							0x222E},
+	{ _t("olarr"),							0x21BA},
+	{ _t("olcir"),							0x29BE},
+	{ _t("olcross"),						0x29BB},
+	{ _t("oline"),							0x203E},
+	{ _t("olt"),							0x29C0},
+	{ _t("omacr"),							0x014D},
+	{ _t("omega"),							0x03C9},
+	{ _t("omicron"),						0x03BF},
+	{ _t("omid"),							0x29B6},
+	{ _t("ominus"),							0x2296},
+	{ _t("oopf"),							0x1D560},
+	{ _t("opar"),							0x29B7},
+	{ _t("operp"),							0x29B9},
+	{ _t("oplus"),							0x2295},
+	{ _t("or"),								0x2228},
+	{ _t("orarr"),							0x21BB},
+	{ _t("ord"),							0x2A5D},
+	{ _t("order"),							0x2134},
+	{ _t("orderof"),						0x2134},
+	{ _t("ordf"),							0x00AA},
+	{ _t("ordm"),							0x00BA},
+	{ _t("origof"),							0x22B6},
+	{ _t("oror"),							0x2A56},
+	{ _t("orslope"),						0x2A57},
+	{ _t("orv"),							0x2A5B},
+	{ _t("oscr"),							0x2134},
+	{ _t("oslash"),							0x00F8},
+	{ _t("osol"),							0x2298},
+	{ _t("otilde"),							0x00F5},
+	{ _t("otimes"),							0x2297},
+	{ _t("otimesas"),						0x2A36},
+	{ _t("ouml"),							0x00F6},
+	{ _t("ovbar"),							0x233D},
+	{ _t("par"),							0x2225},
+	{ _t("para"),							0x00B6},
+	{ _t("parallel"),						0x2225},
+	{ _t("parsim"),							0x2AF3},
+	{ _t("parsl"),							0x2AFD},
+	{ _t("part"),							0x2202},
+	{ _t("pcy"),							0x043F},
+	{ _t("percnt"),							0x0025},
+	{ _t("period"),							0x002E},
+	{ _t("permil"),							0x2030},
+	{ _t("perp"),							0x22A5},
+	{ _t("pertenk"),						0x2031},
+	{ _t("pfr"),							0x1D52D},
+	{ _t("phi"),							0x03C6},
+	{ _t("phiv"),							0x03D5},
+	{ _t("phmmat"),							0x2133},
+	{ _t("phone"),							0x260E},
+	{ _t("pi"),								0x03C0},
+	{ _t("pitchfork"),						0x22D4},
+	{ _t("piv"),							0x03D6},
+	{ _t("planck"),							0x210F},
+	{ _t("planckh"),						0x210E},
+	{ _t("plankv"),							0x210F},
+	{ _t("plus"),							0x002B},
+	{ _t("plusacir"),						0x2A23},
+	{ _t("plusb"),							0x229E},
+	{ _t("pluscir"),						0x2A22},
+	{ _t("plusdo"),							0x2214},
+	{ _t("plusdu"),							0x2A25},
+	{ _t("pluse"),							0x2A72},
+	{ _t("plusmn"),							0x00B1},
+	{ _t("plussim"),						0x2A26},
+	{ _t("plustwo"),						0x2A27},
+	{ _t("pm"),								0x00B1},
+	{ _t("pointint"),						0x2A15},
+	{ _t("popf"),							0x1D561},
+	{ _t("pound"),							0x00A3},
+	{ _t("pr"),								0x227A},
+	{ _t("prE"),							0x2AB3},
+	{ _t("prap"),							0x2AB7},
+	{ _t("prcue"),							0x227C},
+	{ _t("pre"),							0x2AAF},
+	{ _t("prec"),							0x227A},
+	{ _t("precapprox"),						0x2AB7},
+	{ _t("preccurlyeq"),					0x227C},
+	{ _t("preceq"),							0x2AAF},
+	{ _t("precnapprox"),					0x2AB9},
+	{ _t("precneqq"),						0x2AB5},
+	{ _t("precnsim"),						0x22E8},
+	{ _t("precsim"),						0x227E},
+	{ _t("prime"),							0x2032},
+	{ _t("primes"),							0x2119},
+	{ _t("prnE"),							0x2AB5},
+	{ _t("prnap"),							0x2AB9},
+	{ _t("prnsim"),							0x22E8},
+	{ _t("prod"),							0x220F},
+	{ _t("profalar"),						0x232E},
+	{ _t("profline"),						0x2312},
+	{ _t("profsurf"),						0x2313},
+	{ _t("prop"),							0x221D},
+	{ _t("propto"),							0x221D},
+	{ _t("prsim"),							0x227E},
+	{ _t("prurel"),							0x22B0},
+	{ _t("pscr"),							0x1D4C5},
+	{ _t("psi"),							0x03C8},
+	{ _t("puncsp"),							0x2008},
+	{ _t("qfr"),							0x1D52E},
+	{ _t("qint"),							0x2A0C},
+	{ _t("qopf"),							0x1D562},
+	{ _t("qprime"),							0x2057},
+	{ _t("qscr"),							0x1D4C6},
+	{ _t("quaternions"),					0x210D},
+	{ _t("quatint"),						0x2A16},
+	{ _t("quest"),							0x003F},
+	{ _t("questeq"),						0x225F},
+	{ _t("quot"),							0x0022},
+	{ _t("rAarr"),							0x21DB},
+	{ _t("rArr"),							0x21D2},
+	{ _t("rAtail"),							0x291C},
+	{ _t("rBarr"),							0x290F},
+	{ _t("rHar"),							0x2964},
+	{ _t("racute"),							0x0155},
+	{ _t("radic"),							0x221A},
+	{ _t("raemptyv"),						0x29B3},
+	{ _t("rang"),							0x232A},
+	{ _t("rangd"),							0x2992},
+	{ _t("range"),							0x29A5},
+	{ _t("rangle"),							0x27E9},
+	{ _t("raquo"),							0x00BB},
+	{ _t("rarr"),							0x2192},
+	{ _t("rarrap"),							0x2975},
+	{ _t("rarrb"),							0x21E5},
+	{ _t("rarrbfs"),						0x2920},
+	{ _t("rarrc"),							0x2933},
+	{ _t("rarrfs"),							0x291E},
+	{ _t("rarrhk"),							0x21AA},
+	{ _t("rarrlp"),							0x21AC},
+	{ _t("rarrpl"),							0x2945},
+	{ _t("rarrsim"),						0x2974},
+	{ _t("rarrtl"),							0x21A3},
+	{ _t("rarrw"),							0x219D},
+	{ _t("ratail"),							0x291A},
+	{ _t("ratio"),							0x2236},
+	{ _t("rationals"),						0x211A},
+	{ _t("rbarr"),							0x290D},
+	{ _t("rbbrk"),							0x2773},
+	{ _t("rbrace"),							0x007D},
+	{ _t("rbrack"),							0x005D},
+	{ _t("rbrke"),							0x298C},
+	{ _t("rbrksld"),						0x298E},
+	{ _t("rbrkslu"),						0x2990},
+	{ _t("rcaron"),							0x0159},
+	{ _t("rcedil"),							0x0157},
+	{ _t("rceil"),							0x2309},
+	{ _t("rcub"),							0x007D},
+	{ _t("rcy"),							0x0440},
+	{ _t("rdca"),							0x2937},
+	{ _t("rdldhar"),						0x2969},
+	{ _t("rdquo"),							0x201D},
+	{ _t("rdquor"),							0x201D},
+	{ _t("rdsh"),							0x21B3},
+	{ _t("real"),							0x211C},
+	{ _t("realine"),						0x211B},
+	{ _t("realpart"),						0x211C},
+	{ _t("reals"),							0x211D},
+	{ _t("rect"),							0x25AD},
+	{ _t("reg"),							0x00AE},
+	{ _t("rfisht"),							0x297D},
+	{ _t("rfloor"),							0x230B},
+	{ _t("rfr"),							0x1D52F},
+	{ _t("rhard"),							0x21C1},
+	{ _t("rharu"),							0x21C0},
+	{ _t("rharul"),							0x296C},
+	{ _t("rho"),							0x03C1},
+	{ _t("rhov"),							0x03F1},
+	{ _t("rightarrow"),						0x2192},
+	{ _t("rightarrowtail"),					0x21A3},
+	{ _t("rightharpoondown"),				0x21C1},
+	{ _t("rightharpoonup"),					0x21C0},
+	{ _t("rightleftarrows"),				0x21C4},
+	{ _t("rightleftharpoons"),				0x21CC},
+	{ _t("rightrightarrows"),				0x21C9},
+	{ _t("rightsquigarrow"),				0x219D},
+	{ _t("rightthreetimes"),				0x22CC},
+	{ _t("ring"),							0x02DA},
+	{ _t("risingdotseq"),					0x2253},
+	{ _t("rlarr"),							0x21C4},
+	{ _t("rlhar"),							0x21CC},
+	{ _t("rlm"),							0x200F},
+	{ _t("rmoust"),							0x23B1},
+	{ _t("rmoustache"),						0x23B1},
+	{ _t("rnmid"),							0x2AEE},
+	{ _t("roang"),							0x27ED},
+	{ _t("roarr"),							0x21FE},
+	{ _t("robrk"),							0x27E7},
+	{ _t("ropar"),							0x2986},
+	{ _t("ropf"),							0x1D563},
+	{ _t("roplus"),							0x2A2E},
+	{ _t("rotimes"),						0x2A35},
+	{ _t("rpar"),							0x0029},
+	{ _t("rpargt"),							0x2994},
+	{ _t("rppolint"),						0x2A12},
+	{ _t("rrarr"),							0x21C9},
+	{ _t("rsaquo"),							0x00BB},
+	{ _t("rscr"),							0x1D4C7},
+	{ _t("rsh"),							0x21B1},
+	{ _t("rsqb"),							0x005D},
+	{ _t("rsquo"),							0x2019},
+	{ _t("rsquor"),							0x2019},
+	{ _t("rthree"),							0x22CC},
+	{ _t("rtimes"),							0x22CA},
+	{ _t("rtri"),							0x25B9},
+	{ _t("rtrie"),							0x22B5},
+	{ _t("rtrif"),							0x25B8},
+	{ _t("rtriltri"),						0x29CE},
+	{ _t("ruluhar"),						0x2968},
+	{ _t("rx"),								0x211E},
+	{ _t("sacute"),							0x015B},
+	{ _t("sbquo"),							0x201A},
+	{ _t("sc"),								0x227B},
+	{ _t("scE"),							0x2AB4},
+	{ _t("scap"),							0x2AB8},
+	{ _t("scaron"),							0x0161},
+	{ _t("sccue"),							0x227D},
+	{ _t("sce"),							0x2AB0},
+	{ _t("scedil"),							0x015F},
+	{ _t("scirc"),							0x015D},
+	{ _t("scnE"),							0x2AB6},
+	{ _t("scnap"),							0x2ABA},
+	{ _t("scnsim"),							0x22E9},
+	{ _t("scpolint"),						0x2A13},
+	{ _t("scsim"),							0x227F},
+	{ _t("scy"),							0x0441},
+	{ _t("sdot"),							0x22C5},
+	{ _t("sdotb"),							0x22A1},
+	{ _t("sdote"),							0x2A66},
+	{ _t("seArr"),							0x21D8},
+	{ _t("searhk"),							0x2925},
+	{ _t("searr"),							0x2198},
+	{ _t("searrow"),						0x2198},
+	{ _t("sect"),							0x00A7},
+	{ _t("semi"),							0x003B},
+	{ _t("seswar"),							0x2929},
+	{ _t("setminus"),						0x2216},
+	{ _t("setmn"),							0x2216},
+	{ _t("sext"),							0x2736},
+	{ _t("sfr"),							0x1D530},
+	{ _t("sfrown"),							0x2322},
+	{ _t("sharp"),							0x266F},
+	{ _t("shchcy"),							0x0449},
+	{ _t("shcy"),							0x0448},
+	{ _t("shortmid"),						0x2223},
+	{ _t("shortparallel"),					0x2225},
+	{ _t("shy"),							0x00AD},
+	{ _t("sigma"),							0x03C3},
+	{ _t("sigmaf"),							0x03C2},
+	{ _t("sigmav"),							0x03C2},
+	{ _t("sim"),							0x223C},
+	{ _t("simdot"),							0x2A6A},
+	{ _t("sime"),							0x2243},
+	{ _t("simeq"),							0x2243},
+	{ _t("simg"),							0x2A9E},
+	{ _t("simgE"),							0x2AA0},
+	{ _t("siml"),							0x2A9D},
+	{ _t("simlE"),							0x2A9F},
+	{ _t("simne"),							0x2246},
+	{ _t("simplus"),						0x2A24},
+	{ _t("simrarr"),						0x2972},
+	{ _t("slarr"),							0x2190},
+	{ _t("smallsetminus"),					0x2216},
+	{ _t("smashp"),							0x2A33},
+	{ _t("smeparsl"),						0x29E4},
+	{ _t("smid"),							0x2223},
+	{ _t("smile"),							0x2323},
+	{ _t("smt"),							0x2AAA},
+	{ _t("smte"),							0x2AAC},
+	{ _t("softcy"),							0x044C},
+	{ _t("sol"),							0x002F},
+	{ _t("solb"),							0x29C4},
+	{ _t("solbar"),							0x233F},
+	{ _t("sopf"),							0x1D564},
+	{ _t("spades"),							0x2660},
+	{ _t("spadesuit"),						0x2660},
+	{ _t("spar"),							0x2225},
+	{ _t("sqcap"),							0x2293},
+	{ _t("sqcup"),							0x2294},
+	{ _t("sqsub"),							0x228F},
+	{ _t("sqsube"),							0x2291},
+	{ _t("sqsubset"),						0x228F},
+	{ _t("sqsubseteq"),						0x2291},
+	{ _t("sqsup"),							0x2290},
+	{ _t("sqsupe"),							0x2292},
+	{ _t("sqsupset"),						0x2290},
+	{ _t("sqsupseteq"),						0x2292},
+	{ _t("squ"),							0x25A1},
+	{ _t("square"),							0x25A1},
+	{ _t("squarf"),							0x25AA},
+	{ _t("squf"),							0x25AA},
+	{ _t("srarr"),							0x2192},
+	{ _t("sscr"),							0x1D4C8},
+	{ _t("ssetmn"),							0x2216},
+	{ _t("ssmile"),							0x2323},
+	{ _t("sstarf"),							0x22C6},
+	{ _t("star"),							0x2606},
+	{ _t("starf"),							0x2605},
+	{ _t("straightepsilon"),				0x03F5},
+	{ _t("straightphi"),					0x03D5},
+	{ _t("strns"),							0x00AF},
+	{ _t("sub"),							0x2282},
+	{ _t("subE"),							0x2AC5},
+	{ _t("subdot"),							0x2ABD},
+	{ _t("sube"),							0x2286},
+	{ _t("subedot"),						0x2AC3},
+	{ _t("submult"),						0x2AC1},
+	{ _t("subnE"),							0x2ACB},
+	{ _t("subne"),							0x228A},
+	{ _t("subplus"),						0x2ABF},
+	{ _t("subrarr"),						0x2979},
+	{ _t("subset"),							0x2282},
+	{ _t("subseteq"),						0x2286},
+	{ _t("subseteqq"),						0x2AC5},
+	{ _t("subsetneq"),						0x228A},
+	{ _t("subsetneqq"),						0x2ACB},
+	{ _t("subsim"),							0x2AC7},
+	{ _t("subsub"),							0x2AD5},
+	{ _t("subsup"),							0x2AD3},
+	{ _t("succ"),							0x227B},
+	{ _t("succapprox"),						0x2AB8},
+	{ _t("succcurlyeq"),					0x227D},
+	{ _t("succeq"),							0x2AB0},
+	{ _t("succnapprox"),					0x2ABA},
+	{ _t("succneqq"),						0x2AB6},
+	{ _t("succnsim"),						0x22E9},
+	{ _t("succsim"),						0x227F},
+	{ _t("sum"),							0x2211},
+	{ _t("sung"),							0x266A},
+	{ _t("sup"),							0x2283},
+	{ _t("sup1"),							0x00B9},
+	{ _t("sup2"),							0x00B2},
+	{ _t("sup3"),							0x00B3},
+	{ _t("supE"),							0x2AC6},
+	{ _t("supdot"),							0x2ABE},
+	{ _t("supdsub"),						0x2AD8},
+	{ _t("supe"),							0x2287},
+	{ _t("supedot"),						0x2AC4},
+	{ _t("suphsol"),						0x27C9},
+	{ _t("suphsub"),						0x2AD7},
+	{ _t("suplarr"),						0x297B},
+	{ _t("supmult"),						0x2AC2},
+	{ _t("supnE"),							0x2ACC},
+	{ _t("supne"),							0x228B},
+	{ _t("supplus"),						0x2AC0},
+	{ _t("supset"),							0x2283},
+	{ _t("supseteq"),						0x2287},
+	{ _t("supseteqq"),						0x2AC6},
+	{ _t("supsetneq"),						0x228B},
+	{ _t("supsetneqq"),						0x2ACC},
+	{ _t("supsim"),							0x2AC8},
+	{ _t("supsub"),							0x2AD4},
+	{ _t("supsup"),							0x2AD6},
+	{ _t("swArr"),							0x21D9},
+	{ _t("swarhk"),							0x2926},
+	{ _t("swarr"),							0x2199},
+	{ _t("swarrow"),						0x2199},
+	{ _t("swnwar"),							0x292A},
+	{ _t("szlig"),							0x00DF},
+	{ _t("target"),							0x2316},
+	{ _t("tau"),							0x03C4},
+	{ _t("tbrk"),							0x23B4},
+	{ _t("tcaron"),							0x0165},
+	{ _t("tcedil"),							0x0163},
+	{ _t("tcy"),							0x0442},
+	{ _t("tdot"),							0x20DB},
+	{ _t("telrec"),							0x2315},
+	{ _t("tfr"),							0x1D531},
+	{ _t("there4"),							0x2234},
+	{ _t("therefore"),						0x2234},
+	{ _t("theta"),							0x03B8},
+	{ _t("thetasym"),						0x03D1},
+	{ _t("thetav"),							0x03D1},
+	{ _t("thickapprox"),					0x2248},
+	{ _t("thicksim"),						0x223C},
+	{ _t("thinsp"),							0x2009},
+	{ _t("thkap"),							0x2248},
+	{ _t("thksim"),							0x223C},
+	{ _t("thorn"),							0x00FE},
+	{ _t("tilde"),							0x02DC},
+	{ _t("times"),							0x00D7},
+	{ _t("timesb"),							0x22A0},
+	{ _t("timesbar"),						0x2A31},
+	{ _t("timesd"),							0x2A30},
+	{ _t("tint"),							0x222D},
+	{ _t("toea"),							0x2928},
+	{ _t("top"),							0x22A4},
+	{ _t("topbot"),							0x2336},
+	{ _t("topcir"),							0x2AF1},
+	{ _t("topf"),							0x1D565},
+	{ _t("topfork"),						0x2ADA},
+	{ _t("tosa"),							0x2929},
+	{ _t("tprime"),							0x2034},
+	{ _t("trade"),							0x2122},
+	{ _t("triangle"),						0x25B5},
+	{ _t("triangledown"),					0x25BF},
+	{ _t("triangleleft"),					0x25C3},
+	{ _t("trianglelefteq"),					0x22B4},
+	{ _t("triangleq"),						0x225C},
+	{ _t("triangleright"),					0x25B9},
+	{ _t("trianglerighteq"),				0x22B5},
+	{ _t("tridot"),							0x25EC},
+	{ _t("trie"),							0x225C},
+	{ _t("triminus"),						0x2A3A},
+	{ _t("triplus"),						0x2A39},
+	{ _t("trisb"),							0x29CD},
+	{ _t("tritime"),						0x2A3B},
+	{ _t("trpezium"),						0x23E2},
+	{ _t("tscr"),							0x1D4C9},
+	{ _t("tscy"),							0x0446},
+	{ _t("tshcy"),							0x045B},
+	{ _t("tstrok"),							0x0167},
+	{ _t("twixt"),							0x226C},
+	{ _t("twoheadleftarrow"),				0x219E},
+	{ _t("twoheadrightarrow"),				0x21A0},
+	{ _t("uArr"),							0x21D1},
+	{ _t("uHar"),							0x2963},
+	{ _t("uacute"),							0x00FA},
+	{ _t("uarr"),							0x2191},
+	{ _t("ubrcy"),							0x045E},
+	{ _t("ubreve"),							0x016D},
+	{ _t("ucirc"),							0x00FB},
+	{ _t("ucy"),							0x0443},
+	{ _t("udarr"),							0x21C5},
+	{ _t("udblac"),							0x0171},
+	{ _t("udhar"),							0x296E},
+	{ _t("ufisht"),							0x297E},
+	{ _t("ufr"),							0x1D532},
+	{ _t("ugrave"),							0x00F9},
+	{ _t("uharl"),							0x21BF},
+	{ _t("uharr"),							0x21BE},
+	{ _t("uhblk"),							0x2580},
+	{ _t("ulcorn"),							0x231C},
+	{ _t("ulcorner"),						0x231C},
+	{ _t("ulcrop"),							0x230F},
+	{ _t("ultri"),							0x25F8},
+	{ _t("umacr"),							0x016B},
+	{ _t("uml"),							0x00A8},
+	{ _t("uogon"),							0x0173},
+	{ _t("uopf"),							0x1D566},
+	{ _t("uparrow"),						0x2191},
+	{ _t("updownarrow"),					0x2195},
+	{ _t("upharpoonleft"),					0x21BF},
+	{ _t("upharpoonright"),					0x21BE},
+	{ _t("uplus"),							0x228E},
+	{ _t("upsi"),							0x03C5},
+	{ _t("upsih"),							0x03D2},
+	{ _t("upsilon"),						0x03C5},
+	{ _t("upuparrows"),						0x21C8},
+	{ _t("urcorn"),							0x231D},
+	{ _t("urcorner"),						0x231D},
+	{ _t("urcrop"),							0x230E},
+	{ _t("uring"),							0x016F},
+	{ _t("urtri"),							0x25F9},
+	{ _t("uscr"),							0x1D4CA},
+	{ _t("utdot"),							0x22F0},
+	{ _t("utilde"),							0x0169},
+	{ _t("utri"),							0x25B5},
+	{ _t("utrif"),							0x25B4},
+	{ _t("uuarr"),							0x21C8},
+	{ _t("uuml"),							0x00FC},
+	{ _t("uwangle"),						0x29A7},
+	{ _t("vArr"),							0x21D5},
+	{ _t("vBar"),							0x2AE8},
+	{ _t("vBarv"),							0x2AE9},
+	{ _t("vDash"),							0x22A8},
+	{ _t("vangrt"),							0x299C},
+	{ _t("varepsilon"),						0x03F5},
+	{ _t("varkappa"),						0x03F0},
+	{ _t("varnothing"),						0x2205},
+	{ _t("varphi"),							0x03D5},
+	{ _t("varpi"),							0x03D6},
+	{ _t("varpropto"),						0x221D},
+	{ _t("varr"),							0x2195},
+	{ _t("varrho"),							0x03F1},
+	{ _t("varsigma"),						0x03C2},
+	{ _t("vartheta"),						0x03D1},
+	{ _t("vartriangleleft"),				0x22B2},
+	{ _t("vartriangleright"),				0x22B3},
+	{ _t("vcy"),							0x0432},
+	{ _t("vdash"),							0x22A2},
+	{ _t("vee"),							0x2228},
+	{ _t("veebar"),							0x22BB},
+	{ _t("veeeq"),							0x225A},
+	{ _t("vellip"),							0x22EE},
+	{ _t("verbar"),							0x007C},
+	{ _t("vert"),							0x007C},
+	{ _t("vfr"),							0x1D533},
+	{ _t("vltri"),							0x22B2},
+	{ _t("vopf"),							0x1D567},
+	{ _t("vprop"),							0x221D},
+	{ _t("vrtri"),							0x22B3},
+	{ _t("vscr"),							0x1D4CB},
+	{ _t("vzigzag"),						0x299A},
+	{ _t("wcirc"),							0x0175},
+	{ _t("wedbar"),							0x2A5F},
+	{ _t("wedge"),							0x2227},
+	{ _t("wedgeq"),							0x2259},
+	{ _t("weierp"),							0x2118},
+	{ _t("wfr"),							0x1D534},
+	{ _t("wopf"),							0x1D568},
+	{ _t("wp"),								0x2118},
+	{ _t("wr"),								0x2240},
+	{ _t("wreath"),							0x2240},
+	{ _t("wscr"),							0x1D4CC},
+	{ _t("xcap"),							0x22C2},
+	{ _t("xcirc"),							0x25EF},
+	{ _t("xcup"),							0x22C3},
+	{ _t("xdtri"),							0x25BD},
+	{ _t("xfr"),							0x1D535},
+	{ _t("xhArr"),							0x27FA},
+	{ _t("xharr"),							0x27F7},
+	{ _t("xi"),								0x03BE},
+	{ _t("xlArr"),							0x27F8},
+	{ _t("xlarr"),							0x27F5},
+	{ _t("xmap"),							0x27FC},
+	{ _t("xnis"),							0x22FB},
+	{ _t("xodot"),							0x2A00},
+	{ _t("xopf"),							0x1D569},
+	{ _t("xoplus"),							0x2A01},
+	{ _t("xotime"),							0x2A02},
+	{ _t("xrArr"),							0x27F9},
+	{ _t("xrarr"),							0x27F6},
+	{ _t("xscr"),							0x1D4CD},
+	{ _t("xsqcup"),							0x2A06},
+	{ _t("xuplus"),							0x2A04},
+	{ _t("xutri"),							0x25B3},
+	{ _t("xvee"),							0x22C1},
+	{ _t("xwedge"),							0x22C0},
+	{ _t("yacute"),							0x00FD},
+	{ _t("yacy"),							0x044F},
+	{ _t("ycirc"),							0x0177},
+	{ _t("ycy"),							0x044B},
+	{ _t("yen"),							0x00A5},
+	{ _t("yfr"),							0x1D536},
+	{ _t("yicy"),							0x0457},
+	{ _t("yopf"),							0x1D56A},
+	{ _t("yscr"),							0x1D4CE},
+	{ _t("yucy"),							0x044E},
+	{ _t("yuml"),							0x00FF},
+	{ _t("zacute"),							0x017A},
+	{ _t("zcaron"),							0x017E},
+	{ _t("zcy"),							0x0437},
+	{ _t("zdot"),							0x017C},
+	{ _t("zeetrf"),							0x2128},
+	{ _t("zeta"),							0x03B6},
+	{ _t("zfr"),							0x1D537},
+	{ _t("zhcy"),							0x0436},
+	{ _t("zigrarr"),						0x21DD},
+	{ _t("zopf"),							0x1D56B},
+	{ _t("zscr"),							0x1D4CF},
+	{ _t("zwj"),							0x200D},
+	{ _t("zwnj"),							0x200C},
 };
 
 litehtml::ucode_t litehtml::scanner::resolve_entity( const tchar_t* buf, int buf_size )
+{
+	return find_entity(buf, buf_size);
+}
+
+litehtml::ucode_t litehtml::scanner::find_entity( const tchar_t* buf, int buf_size )
 {
 	ucode_t wres = 0;
 	if(buf[0] == '#')
@@ -696,16 +2478,28 @@ litehtml::ucode_t litehtml::scanner::resolve_entity( const tchar_t* buf, int buf
 		}
 	} else
 	{
-		tstring str = _t("&");
-		str.append(buf, buf_size);
-		str += _t(";");
-		for(int i = 0; m_HTMLCodes[i].szCode[0]; i++)
+		int first	= 0;
+		int last	= (int) (sizeof(m_HTMLCodes) / sizeof(m_HTMLCodes[0])) - 1;
+		while(first <= last)
 		{
-			if(!t_strcmp(m_HTMLCodes[i].szCode, str.c_str()))
+			int mid = (first + last) / 2;
+			int res = t_strncmp(m_HTMLCodes[mid].szCode, buf, buf_size);
+			if(!res && m_HTMLCodes[mid].szCode[buf_size])
 			{
-				wres = m_HTMLCodes[i].Code;
+				res = 1;
+			}
+			if(!res)
+			{
+				wres = m_HTMLCodes[mid].Code;
 				break;
 			}
+			if(res < 0)
+			{
+				first = mid + 1;
+			} else
+			{
+				last = mid - 1;
+			}
 		}
 	}
 	return wres;
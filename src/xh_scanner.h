@@ -12,7 +12,7 @@ namespace litehtml
 
 	struct html_entities
 	{
-		tchar_t		szCode[20];
+		const tchar_t*	szCode;
 		ucode_t 	Code;
 	};
 
@@ -57,16 +57,22 @@ namespace litehtml
 
 		  // get value of TT_WORD, TT_SPACE, TT_ATTR and TT_DATA
 		  const tchar_t*    get_value();
+		  size_t            get_value_length() const      { return m_value.length();     }
 
 		  // get attribute name
 		  const tchar_t*    get_attr_name();
+		  size_t            get_attr_name_length() const  { return m_attr_name.length(); }
 
 		  // get tag name
 		  const tchar_t*    get_tag_name();
+		  size_t            get_tag_name_length() const   { return m_tag_name.length();  }
 
 		  // should be override to resolve entities, e.g. &nbsp;
 		  virtual ucode_t   resolve_entity(const tchar_t* buf, int buf_size);
 
+		  // resolve numeric and named HTML entities
+		  static ucode_t    find_entity(const tchar_t* buf, int buf_size);
+
 	private: /* methods */
 
 		typedef token_type (scanner::*scan)();
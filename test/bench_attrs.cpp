@@ -0,0 +1,207 @@
+// Heap allocations and bytes of the attribute storage of html_tag.
+//
+// The tags and attributes of every page are read with litehtml::scanner
+// and stored three ways, one store per tag as in the DOM:
+//   map     std::map<tstring, tstring>, the storage before attr_list
+//   list    attr_list with its values on the heap
+//   arena   attr_list with its values in a document arena
+// Only the set() calls are counted; the names are made atoms beforehand,
+// as the document does once per name. The arena column counts its 64 KB
+// blocks. The last columns are the whole createFromUTF8() without and with
+// context::set_use_arena().
+//
+//   g++ -O2 bench_attrs.cpp ../src/*.cpp -o bench_attrs -lpthread
+//   ./bench_attrs [-m master.css] page1.html page2.html ...
+
+#include "null_container.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+
+using namespace litehtml;
+
+static bool		g_counting		= false;
+static size_t	g_allocs		= 0;
+static size_t	g_alloc_bytes	= 0;
+
+void* operator new(size_t sz)
+{
+	if(g_counting)
+	{
+		g_allocs++;
+		g_alloc_bytes += sz;
+	}
+	void* p = malloc(sz ? sz : 1);
+	if(!p)
+	{
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void* operator new[](size_t sz)
+{
+	return operator new(sz);
+}
+
+void operator delete(void* p) throw()
+{
+	free(p);
+}
+
+void operator delete[](void* p) throw()
+{
+	free(p);
+}
+
+struct alloc_count
+{
+	size_t	allocs;
+	size_t	bytes;
+};
+
+static void count_begin()
+{
+	g_allocs		= 0;
+	g_alloc_bytes	= 0;
+	g_counting		= true;
+}
+
+static alloc_count count_end()
+{
+	g_counting = false;
+	alloc_count ret = { g_allocs, g_alloc_bytes };
+	return ret;
+}
+
+struct attribute
+{
+	atom		name;
+	tstring		name_str;
+	tstring		value;
+};
+
+typedef std::vector<attribute>	tag_attrs;
+
+static void read_tags(const std::string& html, atom_pool& atoms, std::vector<tag_attrs>& tags)
+{
+	utf8_instream si((const byte*) html.c_str());
+	scanner sc(si);
+	scanner::token_type tt;
+	while((tt = sc.get_token()) != scanner::TT_EOF)
+	{
+		if(tt == scanner::TT_TAG_START)
+		{
+			tags.push_back(tag_attrs());
+		} else if(tt == scanner::TT_ATTR && !tags.empty())
+		{
+			attribute attr;
+			attr.name_str	= sc.get_attr_name();
+			attr.name		= atoms.get(attr.name_str.c_str());
+			attr.value		= sc.get_value();
+			tags.back().push_back(attr);
+		}
+	}
+}
+
+static alloc_count store_map(const std::vector<tag_attrs>& tags)
+{
+	std::vector< std::map<tstring, tstring> > stores(tags.size());
+	count_begin();
+	for(size_t i = 0; i < tags.size(); i++)
+	{
+		for(tag_attrs::const_iterator attr = tags[i].begin(); attr != tags[i].end(); attr++)
+		{
+			stores[i][attr->name_str] = attr->value;
+		}
+	}
+	return count_end();
+}
+
+static alloc_count store_list(const std::vector<tag_attrs>& tags, arena* owner)
+{
+	std::vector<attr_list*> stores;
+	for(size_t i = 0; i < tags.size(); i++)
+	{
+		stores.push_back(new attr_list);
+		stores.back()->set_arena(owner);
+	}
+	count_begin();
+	for(size_t i = 0; i < tags.size(); i++)
+	{
+		for(tag_attrs::const_iterator attr = tags[i].begin(); attr != tags[i].end(); attr++)
+		{
+			stores[i]->set(attr->name, attr->value.c_str(), attr->value.length());
+		}
+	}
+	alloc_count ret = count_end();
+	for(size_t i = 0; i < stores.size(); i++)
+	{
+		delete stores[i];
+	}
+	return ret;
+}
+
+static alloc_count create_document(context& ctx, const std::string& html, bool use_arena)
+{
+	null_container cont;
+	ctx.set_use_arena(use_arena);
+	count_begin();
+	document::ptr doc = document::createFromUTF8((const byte*) html.c_str(), &cont, &ctx);
+	return count_end();
+}
+
+int main(int argc, char* argv[])
+{
+	const char* master	= MASTER_CSS;
+	int first_page		= 1;
+	if(argc > 2 && !strcmp(argv[1], "-m"))
+	{
+		master		= argv[2];
+		first_page	= 3;
+	}
+	if(first_page >= argc)
+	{
+		printf("usage: bench_attrs [-m master.css] page.html ...\n");
+		return 1;
+	}
+
+	context ctx;
+	if(!load_master_css(ctx, master))
+	{
+		return 1;
+	}
+
+	printf("%-24s %7s | %14s %14s %14s | %16s %16s\n", "page", "attrs",
+		"map", "list", "arena", "document", "document arena");
+	printf("%-24s %7s | %14s %14s %14s | %16s %16s\n", "", "",
+		"allocs/KB", "allocs/KB", "allocs/KB", "allocs/KB", "allocs/KB");
+	for(int i = first_page; i < argc; i++)
+	{
+		std::string html = read_file(argv[i]);
+
+		atom_pool atoms;
+		std::vector<tag_attrs> tags;
+		read_tags(html, atoms, tags);
+		int attrs = 0;
+		for(size_t t = 0; t < tags.size(); t++)
+		{
+			attrs += (int) tags[t].size();
+		}
+
+		alloc_count map		= store_map(tags);
+		alloc_count list	= store_list(tags, 0);
+		arena::ptr owner	= new arena;
+		alloc_count in_arena	= store_list(tags, owner);
+		alloc_count doc		= create_document(ctx, html, false);
+		alloc_count doc_arena	= create_document(ctx, html, true);
+
+		printf("%-24s %7d | %7d/%-6d %7d/%-6d %7d/%-6d | %8d/%-7d %8d/%-7d\n", argv[i], attrs,
+			(int) map.allocs, (int) (map.bytes / 1024),
+			(int) list.allocs, (int) (list.bytes / 1024),
+			(int) in_arena.allocs, (int) (in_arena.bytes / 1024),
+			(int) doc.allocs, (int) (doc.bytes / 1024),
+			(int) doc_arena.allocs, (int) (doc_arena.bytes / 1024));
+	}
+	return 0;
+}
@@ -0,0 +1,90 @@
+// Scaling of the parallel cascade (context::set_cascade_threads) and layout
+// (context::set_layout_threads) with the number of threads.
+//
+// Every page is parsed and rendered with 1, 2, ... max_threads threads on the
+// same context, so the threads of its pool are started once. The times are
+// the best of bench_loops documents, the speedup is against one thread.
+//
+//   g++ -O2 bench_cascade.cpp ../src/*.cpp -o bench_cascade -lpthread
+//   ./bench_cascade [-t max_threads] page1.html page2.html ...
+
+#include "null_container.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace litehtml;
+
+static const int bench_loops = 5;
+
+struct timing
+{
+	double	create;		// parsing and the cascade
+	double	render;
+};
+
+static timing run(context& ctx, const std::string& html, int threads)
+{
+	ctx.set_cascade_threads(threads);
+	ctx.set_layout_threads(threads);
+
+	timing best = { 0, 0 };
+	for(int i = 0; i < bench_loops; i++)
+	{
+		null_container cont;
+
+		double start = now_ms();
+		document::ptr doc = document::createFromUTF8((const byte*) html.c_str(), &cont, &ctx);
+		double created = now_ms();
+		doc->render(cont.client_width);
+		double rendered = now_ms();
+
+		if(!i || created - start < best.create)
+		{
+			best.create = created - start;
+		}
+		if(!i || rendered - created < best.render)
+		{
+			best.render = rendered - created;
+		}
+	}
+	return best;
+}
+
+int main(int argc, char* argv[])
+{
+	int max_threads	= 8;
+	int first_page	= 1;
+	if(argc > 2 && !strcmp(argv[1], "-t"))
+	{
+		max_threads	= atoi(argv[2]);
+		first_page	= 3;
+	}
+	if(first_page >= argc || max_threads < 1)
+	{
+		printf("usage: bench_cascade [-t max_threads] page.html ...\n");
+		return 1;
+	}
+
+	std::string master = read_file("../include/master.css");
+	context ctx;
+	ctx.load_master_stylesheet(master.c_str());
+
+	printf("%-32s %8s %12s %8s %12s %8s\n", "page", "threads", "create ms", "speedup", "render ms", "speedup");
+	for(int i = first_page; i < argc; i++)
+	{
+		std::string html = read_file(argv[i]);
+		timing serial;
+		for(int threads = 1; threads <= max_threads; threads++)
+		{
+			timing t = run(ctx, html, threads);
+			if(threads == 1)
+			{
+				serial = t;
+			}
+			printf("%-32s %8d %12.1f %8.2f %12.1f %8.2f\n", argv[i], threads,
+				t.create, t.create > 0 ? serial.create / t.create : 0,
+				t.render, t.render > 0 ? serial.render / t.render : 0);
+		}
+	}
+	return 0;
+}
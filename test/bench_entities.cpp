@@ -0,0 +1,200 @@
+// Lookup of named entities (scanner::find_entity) on entity-dense text.
+//
+// Compares the sorted table searched by find_entity() with the linear scan
+// it replaced: the old table of about 250 "&name;" strings walked with
+// t_strcmp() after building the wrapped name. The linear scan is plugged in
+// through scanner::resolve_entity(), so both columns tokenize the same
+// text. The default page repeats every name of the old table; pages given
+// on the command line are measured too. Pass -o to write the default page.
+//
+//   g++ -O2 bench_entities.cpp ../src/*.cpp -o bench_entities -lpthread
+//   ./bench_entities [-o] [page.html ...]
+
+#include "null_container.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace litehtml;
+
+static const int bench_loops	= 20;
+static const int page_repeats	= 200;
+
+// the table before the sorted HTML5 one
+static const html_entities linear_codes[] =
+{
+	{ _t("&quot;"), 0x0022 }, { _t("&amp;"), 0x0026 }, { _t("&lt;"), 0x003C }, { _t("&gt;"), 0x003E },
+	{ _t("&nbsp;"), 0x00A0 }, { _t("&iexcl;"), 0x00A1 }, { _t("&cent;"), 0x00A2 }, { _t("&pound;"), 0x00A3 },
+	{ _t("&curren;"), 0x00A4 }, { _t("&yen;"), 0x00A5 }, { _t("&brvbar;"), 0x00A6 }, { _t("&sect;"), 0x00A7 },
+	{ _t("&uml;"), 0x00A8 }, { _t("&copy;"), 0x00A9 }, { _t("&ordf;"), 0x00AA }, { _t("&laquo;"), 0x00AB },
+	{ _t("&lsaquo;"), 0x00AB }, { _t("&not;"), 0x00AC }, { _t("&shy;"), 0x00AD }, { _t("&reg;"), 0x00AE },
+	{ _t("&macr;"), 0x00AF }, { _t("&deg;"), 0x00B0 }, { _t("&plusmn;"), 0x00B1 }, { _t("&sup2;"), 0x00B2 },
+	{ _t("&sup3;"), 0x00B3 }, { _t("&acute;"), 0x00B4 }, { _t("&micro;"), 0x00B5 }, { _t("&para;"), 0x00B6 },
+	{ _t("&middot;"), 0x00B7 }, { _t("&cedil;"), 0x00B8 }, { _t("&sup1;"), 0x00B9 }, { _t("&ordm;"), 0x00BA },
+	{ _t("&raquo;"), 0x00BB }, { _t("&rsaquo;"), 0x00BB }, { _t("&frac14;"), 0x00BC }, { _t("&frac12;"), 0x00BD },
+	{ _t("&frac34;"), 0x00BE }, { _t("&iquest;"), 0x00BF }, { _t("&Agrave;"), 0x00C0 }, { _t("&Aacute;"), 0x00C1 },
+	{ _t("&Acirc;"), 0x00C2 }, { _t("&Atilde;"), 0x00C3 }, { _t("&Auml;"), 0x00C4 }, { _t("&Aring;"), 0x00C5 },
+	{ _t("&AElig;"), 0x00C6 }, { _t("&Ccedil;"), 0x00C7 }, { _t("&Egrave;"), 0x00C8 }, { _t("&Eacute;"), 0x00C9 },
+	{ _t("&Ecirc;"), 0x00CA }, { _t("&Euml;"), 0x00CB }, { _t("&Igrave;"), 0x00CC }, { _t("&Iacute;"), 0x00CD },
+	{ _t("&Icirc;"), 0x00CE }, { _t("&Iuml;"), 0x00CF }, { _t("&ETH;"), 0x00D0 }, { _t("&Ntilde;"), 0x00D1 },
+	{ _t("&Ograve;"), 0x00D2 }, { _t("&Oacute;"), 0x00D3 }, { _t("&Ocirc;"), 0x00D4 }, { _t("&Otilde;"), 0x00D5 },
+	{ _t("&Ouml;"), 0x00D6 }, { _t("&times;"), 0x00D7 }, { _t("&Oslash;"), 0x00D8 }, { _t("&Ugrave;"), 0x00D9 },
+	{ _t("&Uacute;"), 0x00DA }, { _t("&Ucirc;"), 0x00DB }, { _t("&Uuml;"), 0x00DC }, { _t("&Yacute;"), 0x00DD },
+	{ _t("&THORN;"), 0x00DE }, { _t("&szlig;"), 0x00DF }, { _t("&agrave;"), 0x00E0 }, { _t("&aacute;"), 0x00E1 },
+	{ _t("&acirc;"), 0x00E2 }, { _t("&atilde;"), 0x00E3 }, { _t("&auml;"), 0x00E4 }, { _t("&aring;"), 0x00E5 },
+	{ _t("&aelig;"), 0x00E6 }, { _t("&ccedil;"), 0x00E7 }, { _t("&egrave;"), 0x00E8 }, { _t("&eacute;"), 0x00E9 },
+	{ _t("&ecirc;"), 0x00EA }, { _t("&euml;"), 0x00EB }, { _t("&igrave;"), 0x00EC }, { _t("&iacute;"), 0x00ED },
+	{ _t("&icirc;"), 0x00EE }, { _t("&iuml;"), 0x00EF }, { _t("&eth;"), 0x00F0 }, { _t("&ntilde;"), 0x00F1 },
+	{ _t("&ograve;"), 0x00F2 }, { _t("&oacute;"), 0x00F3 }, { _t("&ocirc;"), 0x00F4 }, { _t("&otilde;"), 0x00F5 },
+	{ _t("&ouml;"), 0x00F6 }, { _t("&divide;"), 0x00F7 }, { _t("&oslash;"), 0x00F8 }, { _t("&ugrave;"), 0x00F9 },
+	{ _t("&uacute;"), 0x00FA }, { _t("&ucirc;"), 0x00FB }, { _t("&uuml;"), 0x00FC }, { _t("&yacute;"), 0x00FD },
+	{ _t("&thorn;"), 0x00FE }, { _t("&yuml;"), 0x00FF }, { _t("&OElig;"), 0x0152 }, { _t("&oelig;"), 0x0153 },
+	{ _t("&Scaron;"), 0x0160 }, { _t("&scaron;"), 0x0161 }, { _t("&Yuml;"), 0x0178 }, { _t("&fnof;"), 0x0192 },
+	{ _t("&circ;"), 0x02C6 }, { _t("&tilde;"), 0x02DC }, { _t("&Alpha;"), 0x0391 }, { _t("&Beta;"), 0x0392 },
+	{ _t("&Gamma;"), 0x0393 }, { _t("&Delta;"), 0x0394 }, { _t("&Epsilon;"), 0x0395 }, { _t("&Zeta;"), 0x0396 },
+	{ _t("&Eta;"), 0x0397 }, { _t("&Theta;"), 0x0398 }, { _t("&Iota;"), 0x0399 }, { _t("&Kappa;"), 0x039A },
+	{ _t("&Lambda;"), 0x039B }, { _t("&Mu;"), 0x039C }, { _t("&Nu;"), 0x039D }, { _t("&Xi;"), 0x039E },
+	{ _t("&Omicron;"), 0x039F }, { _t("&Pi;"), 0x03A0 }, { _t("&Rho;"), 0x03A1 }, { _t("&Sigma;"), 0x03A3 },
+	{ _t("&Tau;"), 0x03A4 }, { _t("&Upsilon;"), 0x03A5 }, { _t("&Phi;"), 0x03A6 }, { _t("&Chi;"), 0x03A7 },
+	{ _t("&Psi;"), 0x03A8 }, { _t("&Omega;"), 0x03A9 }, { _t("&alpha;"), 0x03B1 }, { _t("&beta;"), 0x03B2 },
+	{ _t("&gamma;"), 0x03B3 }, { _t("&delta;"), 0x03B4 }, { _t("&epsilon;"), 0x03B5 }, { _t("&zeta;"), 0x03B6 },
+	{ _t("&eta;"), 0x03B7 }, { _t("&theta;"), 0x03B8 }, { _t("&iota;"), 0x03B9 }, { _t("&kappa;"), 0x03BA },
+	{ _t("&lambda;"), 0x03BB }, { _t("&mu;"), 0x03BC }, { _t("&nu;"), 0x03BD }, { _t("&xi;"), 0x03BE },
+	{ _t("&omicron;"), 0x03BF }, { _t("&pi;"), 0x03C0 }, { _t("&rho;"), 0x03C1 }, { _t("&sigmaf;"), 0x03C2 },
+	{ _t("&sigma;"), 0x03C3 }, { _t("&tau;"), 0x03C4 }, { _t("&upsilon;"), 0x03C5 }, { _t("&phi;"), 0x03C6 },
+	{ _t("&chi;"), 0x03C7 }, { _t("&psi;"), 0x03C8 }, { _t("&omega;"), 0x03C9 }, { _t("&thetasym;"), 0x03D1 },
+	{ _t("&upsih;"), 0x03D2 }, { _t("&piv;"), 0x03D6 }, { _t("&ensp;"), 0x2002 }, { _t("&emsp;"), 0x2003 },
+	{ _t("&thinsp;"), 0x2009 }, { _t("&zwnj;"), 0x200C }, { _t("&zwj;"), 0x200D }, { _t("&lrm;"), 0x200E },
+	{ _t("&rlm;"), 0x200F }, { _t("&ndash;"), 0x2013 }, { _t("&mdash;"), 0x2014 }, { _t("&lsquo;"), 0x2018 },
+	{ _t("&rsquo;"), 0x2019 }, { _t("&sbquo;"), 0x201A }, { _t("&ldquo;"), 0x201C }, { _t("&rdquo;"), 0x201D },
+	{ _t("&bdquo;"), 0x201E }, { _t("&dagger;"), 0x2020 }, { _t("&Dagger;"), 0x2021 }, { _t("&bull;"), 0x2022 },
+	{ _t("&hellip;"), 0x2026 }, { _t("&permil;"), 0x2030 }, { _t("&prime;"), 0x2032 }, { _t("&Prime;"), 0x2033 },
+	{ _t("&lsaquo;"), 0x2039 }, { _t("&rsaquo;"), 0x203A }, { _t("&oline;"), 0x203E }, { _t("&frasl;"), 0x2044 },
+	{ _t("&euro;"), 0x20AC }, { _t("&image;"), 0x2111 }, { _t("&weierp;"), 0x2118 }, { _t("&real;"), 0x211C },
+	{ _t("&trade;"), 0x2122 }, { _t("&alefsym;"), 0x2135 }, { _t("&larr;"), 0x2190 }, { _t("&uarr;"), 0x2191 },
+	{ _t("&rarr;"), 0x2192 }, { _t("&darr;"), 0x2193 }, { _t("&harr;"), 0x2194 }, { _t("&crarr;"), 0x21B5 },
+	{ _t("&lArr;"), 0x21D0 }, { _t("&uArr;"), 0x21D1 }, { _t("&rArr;"), 0x21D2 }, { _t("&dArr;"), 0x21D3 },
+	{ _t("&hArr;"), 0x21D4 }, { _t("&forall;"), 0x2200 }, { _t("&part;"), 0x2202 }, { _t("&exist;"), 0x2203 },
+	{ _t("&empty;"), 0x2205 }, { _t("&nabla;"), 0x2207 }, { _t("&isin;"), 0x2208 }, { _t("&notin;"), 0x2209 },
+	{ _t("&ni;"), 0x220B }, { _t("&prod;"), 0x220F }, { _t("&sum;"), 0x2211 }, { _t("&minus;"), 0x2212 },
+	{ _t("&lowast;"), 0x2217 }, { _t("&radic;"), 0x221A }, { _t("&prop;"), 0x221D }, { _t("&infin;"), 0x221E },
+	{ _t("&ang;"), 0x2220 }, { _t("&and;"), 0x2227 }, { _t("&or;"), 0x2228 }, { _t("&cap;"), 0x2229 },
+	{ _t("&cup;"), 0x222A }, { _t("&int;"), 0x222B }, { _t("&there4;"), 0x2234 }, { _t("&sim;"), 0x223C },
+	{ _t("&cong;"), 0x2245 }, { _t("&asymp;"), 0x2248 }, { _t("&ne;"), 0x2260 }, { _t("&equiv;"), 0x2261 },
+	{ _t("&le;"), 0x2264 }, { _t("&ge;"), 0x2265 }, { _t("&sub;"), 0x2282 }, { _t("&sup;"), 0x2283 },
+	{ _t("&nsub;"), 0x2284 }, { _t("&sube;"), 0x2286 }, { _t("&supe;"), 0x2287 }, { _t("&oplus;"), 0x2295 },
+	{ _t("&otimes;"), 0x2297 }, { _t("&perp;"), 0x22A5 }, { _t("&sdot;"), 0x22C5 }, { _t("&lceil;"), 0x2308 },
+	{ _t("&rceil;"), 0x2309 }, { _t("&lfloor;"), 0x230A }, { _t("&rfloor;"), 0x230B }, { _t("&lang;"), 0x2329 },
+	{ _t("&rang;"), 0x232A }, { _t("&loz;"), 0x25CA }, { _t("&spades;"), 0x2660 }, { _t("&clubs;"), 0x2663 },
+	{ _t("&hearts;"), 0x2665 }, { _t("&diams;"), 0x2666 },
+	{ _t(""), 0 }
+};
+
+class linear_scanner : public scanner
+{
+public:
+	linear_scanner(instream& is) : scanner(is) {}
+
+	virtual ucode_t resolve_entity(const tchar_t* buf, int buf_size)
+	{
+		if(buf[0] == '#')
+		{
+			return find_entity(buf, buf_size);
+		}
+		tstring str = _t("&");
+		str.append(buf, buf_size);
+		str += _t(";");
+		for(int i = 0; linear_codes[i].szCode[0]; i++)
+		{
+			if(!t_strcmp(linear_codes[i].szCode, str.c_str()))
+			{
+				return linear_codes[i].Code;
+			}
+		}
+		return 0;
+	}
+};
+
+static std::string make_page()
+{
+	std::string html = "<html><body><p>";
+	for(int i = 0; i < page_repeats; i++)
+	{
+		for(int j = 0; linear_codes[j].szCode[0]; j++)
+		{
+			html += linear_codes[j].szCode;
+			html += (j % 8) ? " " : " word ";
+		}
+	}
+	html += "</p></body></html>";
+	return html;
+}
+
+template<class T>
+static int scan(const std::string& html, std::string& text)
+{
+	utf8_instream si((const byte*) html.c_str());
+	T sc(si);
+	int tokens = 0;
+	text.clear();
+	scanner::token_type tt;
+	while((tt = sc.get_token()) != scanner::TT_EOF)
+	{
+		if(tt == scanner::TT_WORD)
+		{
+			text += sc.get_value();
+		}
+		tokens++;
+	}
+	return tokens;
+}
+
+// returns MB/s
+template<class T>
+static double run(const std::string& html, std::string& text)
+{
+	double start = now_ms();
+	for(int i = 0; i < bench_loops; i++)
+	{
+		scan<T>(html, text);
+	}
+	double ms = now_ms() - start;
+	if(ms <= 0)
+	{
+		return 0;
+	}
+	return (double) html.length() * bench_loops / (ms / 1000) / (1024 * 1024);
+}
+
+static void bench(const char* name, const std::string& html)
+{
+	std::string sorted_text;
+	std::string linear_text;
+	double sorted = run<scanner>(html, sorted_text);
+	double linear = run<linear_scanner>(html, linear_text);
+	printf("%-32s %10d %12.1f %12.1f %8.2f%s\n", name, (int) html.length(), sorted, linear,
+		linear > 0 ? sorted / linear : 0, sorted_text == linear_text ? "" : "  text differs");
+}
+
+int main(int argc, char* argv[])
+{
+	int first_page = 1;
+	std::string html = make_page();
+	if(argc > 1 && !strcmp(argv[1], "-o"))
+	{
+		first_page = 2;
+		FILE* f = fopen("entities.html", "wb");
+		if(f)
+		{
+			fwrite(html.c_str(), 1, html.length(), f);
+			fclose(f);
+		}
+	}
+
+	printf("%-32s %10s %12s %12s %8s\n", "page", "bytes", "sorted MB/s", "linear MB/s", "speedup");
+	bench("entities", html);
+	for(int i = first_page; i < argc; i++)
+	{
+		bench(argv[i], read_file(argv[i]));
+	}
+	return 0;
+}
@@ -0,0 +1,111 @@
+// Layout time of pages with many floats.
+//
+// The pages are generated: a column of blocks, each one holding floats of
+// several heights next to text. In the "nested" page every float sits in
+// blocks whose top margins collapse, which moves the floats after they are
+// placed (see html_tag::update_floats). Pass -o to write the pages out.
+//
+//   g++ -O2 bench_floats.cpp ../src/*.cpp -o bench_floats -lpthread
+//   ./bench_floats [-o] [floats ...]
+
+#include "null_container.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace litehtml;
+
+static const int bench_loops = 5;
+
+static std::string make_page(int floats, bool nested)
+{
+	std::string html = "<html><body>";
+	char buf[256];
+	for(int i = 0; i < floats; i++)
+	{
+		snprintf(buf, sizeof(buf), "<div style=\"float:%s;width:%dpx;height:%dpx\"></div>",
+			i % 3 ? "left" : "right", 20 + i % 7 * 10, 10 + i % 11 * 15);
+		if(nested)
+		{
+			html += "<div style=\"margin-top:8px\"><p style=\"margin-top:16px\">";
+			html += buf;
+			html += "text next to the float</p></div>";
+		} else
+		{
+			html += buf;
+			html += "<p>text next to the float</p>";
+		}
+	}
+	html += "</body></html>";
+	return html;
+}
+
+static double run(context& ctx, const std::string& html, int& height)
+{
+	double best = 0;
+	for(int i = 0; i < bench_loops; i++)
+	{
+		null_container cont;
+		document::ptr doc = document::createFromUTF8((const byte*) html.c_str(), &cont, &ctx);
+
+		double start = now_ms();
+		doc->render(cont.client_width);
+		double ms = now_ms() - start;
+
+		height = doc->height();
+		if(!i || ms < best)
+		{
+			best = ms;
+		}
+	}
+	return best;
+}
+
+int main(int argc, char* argv[])
+{
+	bool write_pages = false;
+	std::vector<int> counts;
+	for(int i = 1; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "-o"))
+		{
+			write_pages = true;
+		} else
+		{
+			counts.push_back(atoi(argv[i]));
+		}
+	}
+	if(counts.empty())
+	{
+		counts.push_back(100);
+		counts.push_back(300);
+		counts.push_back(1000);
+	}
+
+	std::string master = read_file("../include/master.css");
+	context ctx;
+	ctx.load_master_stylesheet(master.c_str());
+
+	printf("%-8s %8s %12s %10s\n", "page", "floats", "render ms", "height");
+	for(size_t i = 0; i < counts.size(); i++)
+	{
+		for(int nested = 0; nested < 2; nested++)
+		{
+			std::string html = make_page(counts[i], nested != 0);
+			if(write_pages)
+			{
+				char name[64];
+				snprintf(name, sizeof(name), "floats_%s_%d.html", nested ? "nested" : "flat", counts[i]);
+				FILE* f = fopen(name, "wb");
+				if(f)
+				{
+					fwrite(html.c_str(), 1, html.length(), f);
+					fclose(f);
+				}
+			}
+			int height = 0;
+			double ms = run(ctx, html, height);
+			printf("%-8s %8d %12.1f %10d\n", nested ? "nested" : "flat", counts[i], ms, height);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,163 @@
+// Reference count traffic of object_ptr: selector sorting and DOM building.
+//
+// Times std::sort over a css_selector::vector (what css::sort_selectors()
+// does before indexing), the whole css::sort_selectors() and
+// createFromUTF8() of a page with wide element lists. Without the object_ptr
+// move operations every swap and vector relocation is an addRef/release
+// pair. Build it once as is and once with LITEHTML_NO_RVALUE_REFS defined
+// to compare (see os_types.h), both as C++11 so only object_ptr differs.
+// With LITEHTML_COUNT_REFS the addRef() calls of every step are counted
+// too, they don't depend on the machine load like the times:
+//
+//   g++ -O2 -std=c++11 -DLITEHTML_COUNT_REFS bench_object_ptr.cpp ../src/*.cpp -o bench_object_ptr -lpthread
+//   g++ -O2 -std=c++11 -DLITEHTML_COUNT_REFS -DLITEHTML_NO_RVALUE_REFS bench_object_ptr.cpp ../src/*.cpp -o bench_object_ptr_copy -lpthread
+//   ./bench_object_ptr [-m master.css] [rules [elements]]
+
+#include "null_container.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+
+using namespace litehtml;
+
+static const int bench_loops = 15;
+
+// rules with mixed specificity in a fixed pseudo-random order
+static std::string make_stylesheet(int rules)
+{
+	std::string css;
+	char buf[256];
+	unsigned int seed = 12345;
+	for(int i = 0; i < rules; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		switch((seed >> 16) % 4)
+		{
+		case 0:
+			snprintf(buf, sizeof(buf), "div.c%u p { color: red }\n", (seed >> 8) % 500);
+			break;
+		case 1:
+			snprintf(buf, sizeof(buf), "#i%u > span.k%u { margin: 1px }\n", (seed >> 8) % 500, seed % 7);
+			break;
+		case 2:
+			snprintf(buf, sizeof(buf), "ul li a { padding: 2px }\n");
+			break;
+		default:
+			snprintf(buf, sizeof(buf), ".a%u.b%u { width: 10px }\n", (seed >> 8) % 500, seed % 11);
+			break;
+		}
+		css += buf;
+	}
+	return css;
+}
+
+// elements lists that grow one child at a time
+static std::string make_page(int elements)
+{
+	std::string html = "<html><body>";
+	for(int i = 0; i < elements; i++)
+	{
+		html += (i % 50) ? "<span>word</span> " : "<div>";
+		if(i % 50 == 49)
+		{
+			html += "</div>";
+		}
+	}
+	html += "</body></html>";
+	return html;
+}
+
+struct timing
+{
+	double	sort;			// std::sort of the selectors
+	double	sort_selectors;
+	double	create;
+	long	sort_refs;		// addRef() calls of the last loop
+	long	sort_selectors_refs;
+	long	create_refs;
+};
+
+static long addref_calls()
+{
+#ifdef LITEHTML_COUNT_REFS
+	return object::addref_calls();
+#else
+	return 0;
+#endif
+}
+
+static timing run(context& ctx, const std::string& css_text, const std::string& html)
+{
+	timing best = { 0, 0, 0, 0, 0, 0 };
+	for(int i = 0; i < bench_loops; i++)
+	{
+		media_query_list::ptr media;
+		css sheet;
+		sheet.parse_stylesheet(css_text.c_str(), 0, 0, media);
+
+		css_selector::vector selectors = sheet.selectors();
+		long refs = addref_calls();
+		double start = now_ms();
+		std::sort(selectors.begin(), selectors.end(), std::less<css_selector::ptr>());
+		double sort_ms = now_ms() - start;
+		best.sort_refs = addref_calls() - refs;
+
+		refs = addref_calls();
+		start = now_ms();
+		sheet.sort_selectors();
+		double sort_selectors_ms = now_ms() - start;
+		best.sort_selectors_refs = addref_calls() - refs;
+
+		null_container cont;
+		refs = addref_calls();
+		start = now_ms();
+		document::ptr doc = document::createFromUTF8((const byte*) html.c_str(), &cont, &ctx);
+		double create_ms = now_ms() - start;
+		best.create_refs = addref_calls() - refs;
+
+		if(!i || sort_ms < best.sort)
+		{
+			best.sort = sort_ms;
+		}
+		if(!i || sort_selectors_ms < best.sort_selectors)
+		{
+			best.sort_selectors = sort_selectors_ms;
+		}
+		if(!i || create_ms < best.create)
+		{
+			best.create = create_ms;
+		}
+	}
+	return best;
+}
+
+int main(int argc, char* argv[])
+{
+	const char* master	= MASTER_CSS;
+	int first_arg		= 1;
+	if(argc > 2 && !strcmp(argv[1], "-m"))
+	{
+		master		= argv[2];
+		first_arg	= 3;
+	}
+	int rules		= argc > first_arg ? atoi(argv[first_arg]) : 20000;
+	int elements	= argc > first_arg + 1 ? atoi(argv[first_arg + 1]) : 20000;
+
+	context ctx;
+	if(!load_master_css(ctx, master))
+	{
+		return 1;
+	}
+
+#ifdef LITEHTML_RVALUE_REFS
+	printf("object_ptr with move operations\n");
+#else
+	printf("object_ptr without move operations\n");
+#endif
+	timing t = run(ctx, make_stylesheet(rules), make_page(elements));
+	printf("%-28s %8s %10s %12s\n", "", "items", "ms", "addRef()");
+	printf("%-28s %8d %10.2f %12ld\n", "std::sort of the selectors", rules, t.sort, t.sort_refs);
+	printf("%-28s %8d %10.2f %12ld\n", "css::sort_selectors()", rules, t.sort_selectors, t.sort_selectors_refs);
+	printf("%-28s %8d %10.2f %12ld\n", "createFromUTF8()", elements, t.create, t.create_refs);
+	return 0;
+}
@@ -0,0 +1,89 @@
+// Tokenizer throughput on the given pages.
+//
+// Compares the stream scanner (litehtml::scanner over utf8_instream, one
+// code point at a time) with utf8_scanner. Build the library once as is and
+// once with LITEHTML_NO_SSE2 defined to see the share of the SSE2 run skipping:
+//
+//   g++ -O2 bench_scanner.cpp ../src/*.cpp -o bench_scanner -lpthread
+//   ./bench_scanner page1.html page2.html ...
+
+#include "../include/litehtml.h"
+#include "../src/utf8_scanner.h"
+#include <stdio.h>
+#include <time.h>
+#include <fstream>
+#include <sstream>
+
+using namespace litehtml;
+
+static const int bench_loops = 20;
+
+static std::string read_file(const char* path)
+{
+	std::ifstream f(path, std::ios::binary);
+	std::stringstream ss;
+	ss << f.rdbuf();
+	return ss.str();
+}
+
+static int scan_stream(const std::string& html)
+{
+	utf8_instream si((const byte*) html.c_str());
+	scanner sc(si);
+	int tokens = 0;
+	while(sc.get_token() != scanner::TT_EOF)
+	{
+		tokens++;
+	}
+	return tokens;
+}
+
+static int scan_utf8(const std::string& html)
+{
+	utf8_scanner sc(html.c_str());
+	int tokens = 0;
+	while(sc.get_token() != scanner::TT_EOF)
+	{
+		tokens++;
+	}
+	return tokens;
+}
+
+static double run(int (*scan)(const std::string&), const std::string& html, int& tokens)
+{
+	clock_t start = clock();
+	for(int i = 0; i < bench_loops; i++)
+	{
+		tokens = scan(html);
+	}
+	double sec = (double) (clock() - start) / CLOCKS_PER_SEC;
+	if(sec <= 0)
+	{
+		return 0;
+	}
+	return (double) html.length() * bench_loops / sec / (1024 * 1024);
+}
+
+int main(int argc, char* argv[])
+{
+	if(argc < 2)
+	{
+		printf("usage: bench_scanner page.html ...\n");
+		return 1;
+	}
+#ifdef LITEHTML_NO_SSE2
+	printf("utf8_scanner without SSE2\n");
+#endif
+	printf("%-32s %10s %10s %12s %12s\n", "page", "bytes", "tokens", "stream MB/s", "utf8 MB/s");
+	for(int i = 1; i < argc; i++)
+	{
+		std::string html = read_file(argv[i]);
+		int stream_tokens = 0;
+		int utf8_tokens = 0;
+		double stream_speed	= run(scan_stream, html, stream_tokens);
+		double utf8_speed	= run(scan_utf8, html, utf8_tokens);
+		printf("%-32s %10d %10d %12.1f %12.1f%s\n", argv[i], (int) html.length(), utf8_tokens, stream_speed, utf8_speed,
+			stream_tokens != utf8_tokens ? " (token count differs)" : "");
+	}
+	return 0;
+}
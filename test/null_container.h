@@ -0,0 +1,136 @@
+#pragma once
+
+// document_container for the test programs: fixed size fonts, no images and
+// no drawing. Text is measured as 8 pixels a character, so the layout does
+// not depend on the fonts installed.
+
+#include "../include/litehtml.h"
+#include <string.h>
+#include <stdio.h>
+#if defined( WIN32 ) || defined( WINCE )
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+#include <string>
+#include <fstream>
+#include <sstream>
+
+class null_container : public litehtml::document_container
+{
+public:
+	int		client_width;
+	int		client_height;
+
+	null_container() : client_width(800), client_height(600) {}
+
+	virtual litehtml::uint_ptr create_font(const litehtml::tchar_t* faceName, int size, int weight, litehtml::font_style italic, unsigned int decoration, litehtml::font_metrics* fm)
+	{
+		if(fm)
+		{
+			fm->ascent		= size * 4 / 5;
+			fm->descent		= size - fm->ascent;
+			fm->height		= size;
+			fm->x_height	= size / 2;
+		}
+		return (litehtml::uint_ptr) (size_t) size;
+	}
+	virtual void delete_font(litehtml::uint_ptr hFont) {}
+	virtual int text_width(const litehtml::tchar_t* text, litehtml::uint_ptr hFont)
+	{
+		return (int) t_strlen(text) * 8;
+	}
+	virtual void draw_text(litehtml::uint_ptr hdc, const litehtml::tchar_t* text, litehtml::uint_ptr hFont, litehtml::web_color color, const litehtml::position& pos) {}
+	virtual int pt_to_px(int pt)									{ return pt * 96 / 72; }
+	virtual int get_default_font_size()								{ return 16; }
+	virtual const litehtml::tchar_t* get_default_font_name()		{ return _t("serif"); }
+	virtual void draw_list_marker(litehtml::uint_ptr hdc, const litehtml::list_marker& marker) {}
+	virtual void load_image(const litehtml::tchar_t* src, const litehtml::tchar_t* baseurl, bool redraw_on_ready) {}
+	virtual void get_image_size(const litehtml::tchar_t* src, const litehtml::tchar_t* baseurl, litehtml::size& sz)
+	{
+		sz.width	= 0;
+		sz.height	= 0;
+	}
+	virtual void draw_background(litehtml::uint_ptr hdc, const litehtml::background_paint& bg) {}
+	virtual void draw_borders(litehtml::uint_ptr hdc, const litehtml::css_borders& borders, const litehtml::position& draw_pos, bool root) {}
+	virtual void set_caption(const litehtml::tchar_t* caption) {}
+	virtual void set_base_url(const litehtml::tchar_t* base_url) {}
+	virtual void link(litehtml::document* doc, litehtml::element::ptr el) {}
+	virtual void on_anchor_click(const litehtml::tchar_t* url, litehtml::element::ptr el) {}
+	virtual void set_cursor(const litehtml::tchar_t* cursor) {}
+	virtual void transform_text(litehtml::tstring& text, litehtml::text_transform tt) {}
+	virtual void import_css(litehtml::tstring& text, const litehtml::tstring& url, litehtml::tstring& baseurl) {}
+	virtual void set_clip(const litehtml::position& pos, bool valid_x, bool valid_y) {}
+	virtual void del_clip() {}
+	virtual void get_client_rect(litehtml::position& client)
+	{
+		client.x		= 0;
+		client.y		= 0;
+		client.width	= client_width;
+		client.height	= client_height;
+	}
+	virtual litehtml::element* create_element(const litehtml::tchar_t* tag_name)
+	{
+		return 0;
+	}
+	virtual void get_media_features(litehtml::media_features& media)
+	{
+		media.type			= litehtml::media_type_screen;
+		media.width			= client_width;
+		media.height		= client_height;
+		media.device_width	= client_width;
+		media.device_height	= client_height;
+		media.color			= 8;
+		media.color_index	= 0;
+		media.monochrome	= 0;
+		media.resolution	= 96;
+	}
+};
+
+inline std::string read_file(const char* path)
+{
+	std::ifstream f(path, std::ios::binary);
+	std::stringstream ss;
+	ss << f.rdbuf();
+	return ss.str();
+}
+
+// The tests load the master stylesheet from MASTER_CSS unless given another
+// path. The default works when they are run from test/, build them with
+// -DMASTER_CSS=\"path/master.css\" to run them from elsewhere.
+#ifndef MASTER_CSS
+#define MASTER_CSS "../include/master.css"
+#endif
+
+// returns false if path can't be read, the layout without the master
+// stylesheet would not test much
+inline bool load_master_css(litehtml::context& ctx, const char* path)
+{
+	std::ifstream f(path, std::ios::binary);
+	if(!f)
+	{
+		fprintf(stderr, "can't read the master stylesheet %s\n", path);
+		return false;
+	}
+	std::stringstream ss;
+	ss << f.rdbuf();
+	if(ss.str().empty())
+	{
+		fprintf(stderr, "the master stylesheet %s is empty\n", path);
+		return false;
+	}
+	ctx.load_master_stylesheet(ss.str().c_str());
+	return true;
+}
+
+// wall clock milliseconds, clock() adds up the time of all threads
+inline double now_ms()
+{
+#if defined( WIN32 ) || defined( WINCE )
+	return (double) GetTickCount();
+#else
+	timeval tv;
+	gettimeofday(&tv, 0);
+	return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+#endif
+}
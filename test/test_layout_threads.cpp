@@ -0,0 +1,143 @@
+// The layout with context::set_layout_threads(4) must be the same as the
+// serial one.
+//
+// Every page is rendered with 1 and 4 layout threads at a few widths, then
+// the placement and margins of all elements are compared. The built in
+// pages have the blocks laid out ahead of the document (inline-blocks,
+// floats, overflow blocks, absolute boxes and table cells); more pages can
+// be given on the command line. Returns 1 if any element differs or the
+// master stylesheet (MASTER_CSS or -m) can't be read.
+//
+//   g++ -O2 test_layout_threads.cpp ../src/*.cpp -o test_layout_threads -lpthread
+//   ./test_layout_threads [-m master.css] [page.html ...]
+
+#include "null_container.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace litehtml;
+
+static const int test_threads	= 4;
+static const int test_widths[]	= { 800, 517, 240 };
+
+static const char* test_pages[] =
+{
+	"<html><body>"
+		"<p>text <span style=\"display:inline-block;width:120px\">inline block with some text in it</span> text "
+		"<span style=\"display:inline-block;width:60px;height:40px;margin:4px\"></span> more text after it</p>"
+		"<div style=\"display:inline-block;width:300px\"><div style=\"float:left;width:100px\">float</div>"
+		"text next to the float inside the inline block</div>"
+	"</body></html>",
+
+	"<html><body>"
+		"<div style=\"float:left;width:200px\"><p>left float</p><p style=\"margin-top:20px\">second paragraph</p></div>"
+		"<div style=\"float:right;width:150px;height:90px\"></div>"
+		"<p>text next to the floats that wraps around them a few times at the smaller widths</p>"
+		"<div style=\"overflow:hidden;width:250px\"><div style=\"float:right;width:50px;height:30px\"></div>text in the overflow block</div>"
+		"<div style=\"clear:both;margin-top:10px\">cleared</div>"
+	"</body></html>",
+
+	"<html><body><div style=\"position:relative\">"
+		"<div style=\"position:absolute;left:10px;top:20px;width:180px\"><p>absolute box with text</p></div>"
+		"<div style=\"position:absolute;right:0;width:100px;height:50px\"></div>"
+		"<p>text under the absolute boxes</p>"
+	"</div></body></html>",
+
+	"<html><body><table border=\"1\" cellpadding=\"3\">"
+		"<tr><td style=\"width:120px\">fixed cell</td><td>cell with some longer text in it</td><td valign=\"bottom\">b</td></tr>"
+		"<tr><td colspan=\"2\"><div style=\"float:left;width:40px;height:40px\"></div>cell with a float</td><td>c</td></tr>"
+		"<tr><td><table><tr><td>nested</td><td style=\"width:50px\">table</td></tr></table></td><td>d</td><td>e</td></tr>"
+	"</table></body></html>",
+};
+
+static int compare(element::ptr a, element::ptr b, const std::string& path)
+{
+	int diffs = 0;
+	position pa = a->get_placement();
+	position pb = b->get_placement();
+	margins ma = a->get_margins();
+	margins mb = b->get_margins();
+	if(pa.x != pb.x || pa.y != pb.y || pa.width != pb.width || pa.height != pb.height ||
+		ma.left != mb.left || ma.right != mb.right || ma.top != mb.top || ma.bottom != mb.bottom)
+	{
+		printf("  %s: %d,%d %dx%d margins %d,%d,%d,%d != %d,%d %dx%d margins %d,%d,%d,%d\n", path.c_str(),
+			pa.x, pa.y, pa.width, pa.height, ma.left, ma.right, ma.top, ma.bottom,
+			pb.x, pb.y, pb.width, pb.height, mb.left, mb.right, mb.top, mb.bottom);
+		diffs++;
+	}
+	if(a->get_children_count() != b->get_children_count())
+	{
+		printf("  %s: %d children != %d\n", path.c_str(), (int) a->get_children_count(), (int) b->get_children_count());
+		return diffs + 1;
+	}
+	for(int i = 0; i < (int) a->get_children_count(); i++)
+	{
+		element::ptr child = a->get_child(i);
+		std::string child_path = path + "/";
+		child_path += child->get_tagName();
+		diffs += compare(child, b->get_child(i), child_path);
+	}
+	return diffs;
+}
+
+static int test_page(context& ctx, const std::string& html, const char* name)
+{
+	int diffs = 0;
+	for(int i = 0; i < (int) (sizeof(test_widths) / sizeof(test_widths[0])); i++)
+	{
+		null_container cont;
+
+		ctx.set_layout_threads(1);
+		document::ptr serial = document::createFromUTF8((const byte*) html.c_str(), &cont, &ctx);
+		serial->render(test_widths[i]);
+
+		ctx.set_layout_threads(test_threads);
+		document::ptr threaded = document::createFromUTF8((const byte*) html.c_str(), &cont, &ctx);
+		threaded->render(test_widths[i]);
+
+		int n = compare(serial->root(), threaded->root(), "html");
+		if(n)
+		{
+			printf("%s at %dpx: %d elements differ\n", name, test_widths[i], n);
+		}
+		diffs += n;
+	}
+	return diffs;
+}
+
+int main(int argc, char* argv[])
+{
+	const char* master	= MASTER_CSS;
+	int first_page		= 1;
+	if(argc > 2 && !strcmp(argv[1], "-m"))
+	{
+		master		= argv[2];
+		first_page	= 3;
+	}
+
+	context ctx;
+	if(!load_master_css(ctx, master))
+	{
+		return 1;
+	}
+
+	int diffs = 0;
+	char name[32];
+	for(int i = 0; i < (int) (sizeof(test_pages) / sizeof(test_pages[0])); i++)
+	{
+		snprintf(name, sizeof(name), "page %d", i + 1);
+		diffs += test_page(ctx, test_pages[i], name);
+	}
+	for(int i = first_page; i < argc; i++)
+	{
+		diffs += test_page(ctx, read_file(argv[i]), argv[i]);
+	}
+
+	if(diffs)
+	{
+		printf("FAILED: %d differences\n", diffs);
+		return 1;
+	}
+	printf("passed\n");
+	return 0;
+}
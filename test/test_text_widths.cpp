@@ -0,0 +1,102 @@
+// The words queued by document::queue_text_width() must get their widths
+// even when init() removes their elements before the flush.
+//
+// Inline elements don't flush the queue, their block does, after init() of
+// the inline element has dropped the collapsed white space. The words and
+// spaces in the span of every page below must add up to 8 pixels a
+// character with the runs of spaces in each element collapsed to one. Build it with -fsanitize=address to
+// catch reads of the dropped elements too.
+//
+//   g++ -O2 test_text_widths.cpp ../src/*.cpp -o test_text_widths -lpthread
+//   ./test_text_widths [-m master.css]
+
+#include "null_container.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace litehtml;
+
+struct text_test
+{
+	const char*	html;
+	int			width;		// of the text in the span
+};
+
+static const text_test text_tests[] =
+{
+	{ "<p><span>a   b</span></p>",											3 * 8 },
+	{ "<p><span>a \t\n b  c</span></p>",									5 * 8 },
+	{ "<p><b><span>one    two     three</span></b></p>",					13 * 8 },
+	{ "<div><span>a  <i>b  </i>  c</span></div>",							6 * 8 },
+	{ "<p><span>  leading and trailing  </span></p>",						22 * 8 },
+};
+
+static int text_width(element::ptr el)
+{
+	if(!el->get_children_count())
+	{
+		return el->get_placement().width;
+	}
+	int width = 0;
+	for(int i = 0; i < (int) el->get_children_count(); i++)
+	{
+		width += text_width(el->get_child(i));
+	}
+	return width;
+}
+
+static element::ptr find_span(element::ptr el)
+{
+	if(!t_strcmp(el->get_tagName(), _t("span")))
+	{
+		return el;
+	}
+	for(int i = 0; i < (int) el->get_children_count(); i++)
+	{
+		element::ptr span = find_span(el->get_child(i));
+		if(span)
+		{
+			return span;
+		}
+	}
+	return 0;
+}
+
+int main(int argc, char* argv[])
+{
+	const char* master = MASTER_CSS;
+	if(argc > 2 && !strcmp(argv[1], "-m"))
+	{
+		master = argv[2];
+	}
+
+	context ctx;
+	if(!load_master_css(ctx, master))
+	{
+		return 1;
+	}
+
+	int failed = 0;
+	for(int i = 0; i < (int) (sizeof(text_tests) / sizeof(text_tests[0])); i++)
+	{
+		null_container cont;
+		document::ptr doc = document::createFromUTF8((const byte*) text_tests[i].html, &cont, &ctx);
+		doc->render(cont.client_width);
+
+		element::ptr span = find_span(doc->root());
+		int width = span ? text_width(span) : -1;
+		if(width != text_tests[i].width)
+		{
+			printf("%s: text width %d, expected %d\n", text_tests[i].html, width, text_tests[i].width);
+			failed++;
+		}
+	}
+
+	if(failed)
+	{
+		printf("FAILED: %d pages\n", failed);
+		return 1;
+	}
+	printf("passed\n");
+	return 0;
+}